@@ -17,6 +17,9 @@ public sealed class HistoricalClientBuilder
     private string? _userAgent;
     private TimeSpan _timeout = TimeSpan.FromSeconds(30);
     private ILogger<IHistoricalClient>? _logger;
+    private int _poolSize = HistoricalClient.DefaultPoolSize;
+    private TimeSpan _idleTimeout = HistoricalClient.DefaultIdleTimeout;
+    private int _prewarmConnections = 0;
 
     /// <summary>
     /// Set the Databento API key
@@ -83,6 +86,27 @@ public sealed class HistoricalClientBuilder
         return this;
     }
 
+    /// <summary>
+    /// Configure the connection pool shared by concurrent calls on the client
+    /// </summary>
+    /// <param name="maxConnections">Maximum concurrent connections (1-256); calls beyond this wait</param>
+    /// <param name="idleTimeout">Close connections idle longer than this (TimeSpan.Zero = never)</param>
+    /// <param name="prewarmConnections">Connections to open during Build so the first queries skip the handshake</param>
+    public HistoricalClientBuilder WithConnectionPool(int maxConnections, TimeSpan? idleTimeout = null, int prewarmConnections = 0)
+    {
+        if (maxConnections < 1 || maxConnections > 256)
+            throw new ArgumentOutOfRangeException(nameof(maxConnections), "Pool size must be between 1 and 256");
+        if (idleTimeout.HasValue && idleTimeout.Value < TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(idleTimeout), "Idle timeout cannot be negative");
+        if (prewarmConnections < 0)
+            throw new ArgumentOutOfRangeException(nameof(prewarmConnections), "Prewarm count cannot be negative");
+
+        _poolSize = maxConnections;
+        _idleTimeout = idleTimeout ?? HistoricalClient.DefaultIdleTimeout;
+        _prewarmConnections = prewarmConnections;
+        return this;
+    }
+
     /// <summary>
     /// Set the logger for operational diagnostics and debugging
     /// </summary>
@@ -116,6 +140,9 @@ public sealed class HistoricalClientBuilder
             _upgradePolicy,
             _userAgent,
             _timeout,
-            _logger);
+            _logger,
+            _poolSize,
+            _idleTimeout,
+            _prewarmConnections);
     }
 }
@@ -0,0 +1,19 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Expected access pattern for a memory-mapped DBN file (forwarded to madvise)
+/// </summary>
+public enum DbnAccessPattern
+{
+    /// <summary>No special treatment</summary>
+    Normal = 0,
+
+    /// <summary>Records are read front to back; enables aggressive read-ahead</summary>
+    Sequential = 1,
+
+    /// <summary>Records are read out of order; disables read-ahead</summary>
+    Random = 2,
+
+    /// <summary>The range will be needed soon; start paging it in now</summary>
+    WillNeed = 3
+}
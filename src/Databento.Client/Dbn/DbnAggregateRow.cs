@@ -0,0 +1,67 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Statistics of one group of records
+/// </summary>
+/// <remarks>
+/// Grouping keys not in use are null. Volume, notional and the price fields cover trades
+/// only (records with action 'T': trades, MBP, consolidated and MBO trade events); book
+/// updates, fills, BBO snapshots, bars and statistics don't contribute. Price fields are
+/// null when the group had no trade; spread fields are null without top-of-book quotes.
+/// </remarks>
+public sealed record DbnAggregateRow
+{
+    /// <summary>Instrument ID, when grouped by instrument</summary>
+    public uint? InstrumentId { get; init; }
+
+    /// <summary>Publisher ID, when grouped by publisher</summary>
+    public ushort? PublisherId { get; init; }
+
+    /// <summary>Start of the ts_event bucket, when grouped by time</summary>
+    public DateTimeOffset? BucketStart { get; init; }
+
+    /// <summary>Number of records</summary>
+    public ulong Count { get; init; }
+
+    /// <summary>Sum of trade sizes</summary>
+    public ulong Volume { get; init; }
+
+    /// <summary>Sum of trade price times size</summary>
+    public double Notional { get; init; }
+
+    /// <summary>Volume-weighted average trade price</summary>
+    public decimal? Vwap { get; init; }
+
+    /// <summary>Price of the earliest trade by ts_event</summary>
+    public decimal? Open { get; init; }
+
+    /// <summary>Highest trade price</summary>
+    public decimal? High { get; init; }
+
+    /// <summary>Lowest trade price</summary>
+    public decimal? Low { get; init; }
+
+    /// <summary>Price of the latest trade by ts_event</summary>
+    public decimal? Close { get; init; }
+
+    /// <summary>ts_event of the earliest trade</summary>
+    public DateTimeOffset? FirstEventTime { get; init; }
+
+    /// <summary>ts_event of the latest trade</summary>
+    public DateTimeOffset? LastEventTime { get; init; }
+
+    /// <summary>Records with both a bid and an ask at the top of the book</summary>
+    public ulong SpreadCount { get; init; }
+
+    /// <summary>Mean bid/ask spread</summary>
+    public decimal? SpreadMean { get; init; }
+
+    /// <summary>Narrowest bid/ask spread</summary>
+    public decimal? SpreadMin { get; init; }
+
+    /// <summary>Widest bid/ask spread</summary>
+    public decimal? SpreadMax { get; init; }
+
+    /// <summary>Estimated trade prices at the requested quantiles, in request order</summary>
+    public IReadOnlyList<decimal?> PriceQuantiles { get; init; } = Array.Empty<decimal?>();
+}
@@ -0,0 +1,57 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// What <see cref="DbnAggregator"/> computes and how it groups records
+/// </summary>
+public sealed class DbnAggregationOptions
+{
+    /// <summary>Grouping keys</summary>
+    public DbnGroupBy GroupBy { get; init; } = DbnGroupBy.Instrument;
+
+    /// <summary>Width of time buckets; required when grouping by <see cref="DbnGroupBy.TimeBucket"/></summary>
+    public TimeSpan? BucketSize { get; init; }
+
+    /// <summary>
+    /// Records to aggregate (null = all records)
+    /// </summary>
+    /// <remarks>
+    /// Price statistics use every record with a price field, so restrict to trades
+    /// (for example <c>Action = Action.Trade</c>) for trade VWAP over order book data.
+    /// </remarks>
+    public DbnRecordFilter? Filter { get; init; }
+
+    /// <summary>Price quantiles to estimate, each between 0 and 1 (within 1% relative error)</summary>
+    public IReadOnlyList<double>? Quantiles { get; init; }
+
+    /// <summary>Worker threads (0 = one per core)</summary>
+    public int Threads { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON specification understood by the native aggregator
+    /// </summary>
+    internal string ToJson()
+    {
+        var groupBy = new JsonArray();
+        if (GroupBy.HasFlag(DbnGroupBy.Instrument))
+            groupBy.Add("instrument_id");
+        if (GroupBy.HasFlag(DbnGroupBy.Publisher))
+            groupBy.Add("publisher_id");
+        if (GroupBy.HasFlag(DbnGroupBy.TimeBucket))
+        {
+            if (BucketSize is not { Ticks: > 0 })
+                throw new ArgumentException("Grouping by time bucket requires a positive BucketSize", nameof(BucketSize));
+            groupBy.Add("bucket");
+        }
+
+        var json = new JsonObject { ["group_by"] = groupBy };
+        if (BucketSize.HasValue)
+            json["bucket_ns"] = BucketSize.Value.Ticks * 100;
+        if (Filter != null)
+            json["filter"] = JsonNode.Parse(Filter.ToJson());
+        if (Quantiles != null)
+            json["quantiles"] = new JsonArray(Quantiles.Select(q => (JsonNode)q).ToArray());
+        return json.ToJsonString();
+    }
+}
@@ -0,0 +1,12 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Result of a <see cref="DbnAggregator"/> run
+/// </summary>
+/// <param name="Rows">One row per group, ordered by instrument, publisher and bucket</param>
+/// <param name="RecordsScanned">Records read from the files</param>
+/// <param name="RecordsPassed">Records that passed the filter and were aggregated</param>
+public sealed record DbnAggregationResult(
+    IReadOnlyList<DbnAggregateRow> Rows,
+    ulong RecordsScanned,
+    ulong RecordsPassed);
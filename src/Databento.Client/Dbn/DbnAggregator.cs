@@ -0,0 +1,149 @@
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Interop;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Summarizes DBN files natively on all cores
+/// </summary>
+/// <remarks>
+/// Files are split into blocks at their index checkpoints (the <c>.idx</c> sidecar, built
+/// automatically for uncompressed files) and scanned in parallel; each worker keeps its
+/// own tables, merged once at the end. Compressed files without an index are scanned
+/// by a single worker each; run <see cref="DbnFileReader.BuildIndex"/> to split them.
+/// </remarks>
+public static class DbnAggregator
+{
+    /// <summary>
+    /// Aggregate records from one or more DBN files
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="options">Grouping, filter and statistics to compute (null = per instrument)</param>
+    /// <returns>Aggregated rows</returns>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DbentoException">If a file cannot be read or the options are invalid</exception>
+    public static DbnAggregationResult Aggregate(IEnumerable<string> filePaths, DbnAggregationOptions? options = null)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        options ??= new DbnAggregationOptions();
+        ArgumentOutOfRangeException.ThrowIfNegative(options.Threads);
+
+        string[] paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            throw new ArgumentException("At least one file is required", nameof(filePaths));
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_aggregate(
+            paths,
+            (nuint)paths.Length,
+            options.ToJson(),
+            options.Threads,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to aggregate DBN files: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            using var document = JsonDocument.Parse(json);
+            return ParseResult(document.RootElement);
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Aggregate records from one or more DBN files without blocking the caller
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="options">Grouping, filter and statistics to compute (null = per instrument)</param>
+    /// <param name="cancellationToken">Cancels before the scan starts; a running scan completes</param>
+    /// <returns>Aggregated rows</returns>
+    public static Task<DbnAggregationResult> AggregateAsync(
+        IEnumerable<string> filePaths,
+        DbnAggregationOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => Aggregate(filePaths, options), cancellationToken);
+    }
+
+    private static DbnAggregationResult ParseResult(JsonElement root)
+    {
+        int rowCount = root.GetProperty("row_count").GetInt32();
+        var columns = root.GetProperty("columns");
+
+        JsonElement? Column(string name) => columns.TryGetProperty(name, out var column) ? column : null;
+        var instrumentIds = Column("instrument_id");
+        var publisherIds = Column("publisher_id");
+        var buckets = Column("bucket_start");
+        var counts = columns.GetProperty("count");
+        var volumes = columns.GetProperty("volume");
+        var notionals = columns.GetProperty("notional");
+        var vwaps = columns.GetProperty("vwap");
+        var opens = columns.GetProperty("open");
+        var highs = columns.GetProperty("high");
+        var lows = columns.GetProperty("low");
+        var closes = columns.GetProperty("close");
+        var firstTs = columns.GetProperty("first_ts");
+        var lastTs = columns.GetProperty("last_ts");
+        var spreadCounts = columns.GetProperty("spread_count");
+        var spreadMeans = columns.GetProperty("spread_mean");
+        var spreadMins = columns.GetProperty("spread_min");
+        var spreadMaxs = columns.GetProperty("spread_max");
+        var quantiles = Column("price_quantiles")?.EnumerateArray().Select(q => q.GetProperty("values")).ToArray()
+            ?? Array.Empty<JsonElement>();
+
+        var rows = new DbnAggregateRow[rowCount];
+        for (int i = 0; i < rowCount; i++)
+        {
+            rows[i] = new DbnAggregateRow
+            {
+                InstrumentId = instrumentIds?[i].GetUInt32(),
+                PublisherId = publisherIds?[i].GetUInt16(),
+                BucketStart = buckets is { } b ? Utilities.DateTimeHelpers.FromUnixNanos(b[i].GetInt64()) : null,
+                Count = counts[i].GetUInt64(),
+                Volume = volumes[i].GetUInt64(),
+                Notional = notionals[i].GetDouble(),
+                Vwap = Price(vwaps[i]),
+                Open = Price(opens[i]),
+                High = Price(highs[i]),
+                Low = Price(lows[i]),
+                Close = Price(closes[i]),
+                FirstEventTime = Timestamp(firstTs[i]),
+                LastEventTime = Timestamp(lastTs[i]),
+                SpreadCount = spreadCounts[i].GetUInt64(),
+                SpreadMean = Price(spreadMeans[i]),
+                SpreadMin = Price(spreadMins[i]),
+                SpreadMax = Price(spreadMaxs[i]),
+                PriceQuantiles = quantiles.Select(values => Price(values[i])).ToArray()
+            };
+        }
+
+        return new DbnAggregationResult(
+            rows,
+            root.GetProperty("records_scanned").GetUInt64(),
+            root.GetProperty("records_passed").GetUInt64());
+    }
+
+    private static decimal? Price(JsonElement value) =>
+        value.ValueKind == JsonValueKind.Null ? null : value.GetInt64() / 1_000_000_000m;
+
+    private static DateTimeOffset? Timestamp(JsonElement value) =>
+        value.ValueKind == JsonValueKind.Null ? null : Utilities.DateTimeHelpers.FromUnixNanos(value.GetInt64());
+}
@@ -0,0 +1,46 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Settings for appending to an existing DBN file with <see cref="DbnFileWriter.OpenAppend"/>
+/// </summary>
+/// <remarks>
+/// Appended records are compressed like the existing file: zstd files stay zstd and plain
+/// files stay plain.
+/// </remarks>
+public sealed class DbnAppendOptions
+{
+    /// <summary>zstd level for the appended frames, 1 to 22</summary>
+    public int CompressionLevel { get; init; } = 3;
+
+    /// <summary>Uncompressed bytes per independent zstd frame (0 = 4 MiB)</summary>
+    public int FrameSize { get; init; }
+
+    /// <summary>Compress and write on a background thread, as with <see cref="DbnAsyncWriterOptions"/></summary>
+    public bool Background { get; init; }
+
+    /// <summary>Threads compressing frames when <see cref="Background"/> is set</summary>
+    public int CompressionThreads { get; init; } = 1;
+
+    /// <summary>Queue capacity in bytes when <see cref="Background"/> is set (0 = 64 MiB)</summary>
+    public long QueueSize { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native writer
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject
+        {
+            ["compression_level"] = CompressionLevel,
+            ["async"] = Background,
+            ["compression_threads"] = CompressionThreads
+        };
+        if (FrameSize > 0)
+            json["frame_size"] = FrameSize;
+        if (QueueSize > 0)
+            json["queue_size"] = QueueSize;
+        return json.ToJsonString();
+    }
+}
@@ -0,0 +1,46 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Background compression and queueing for a <see cref="DbnFileWriter"/>
+/// </summary>
+/// <remarks>
+/// Writes are copied into a bounded queue and compressed and written by a background
+/// thread, so the writing thread never waits on the disk unless the queue is full.
+/// </remarks>
+public sealed class DbnAsyncWriterOptions
+{
+    /// <summary>Compress with zstd; false writes plain DBN</summary>
+    public bool Compress { get; init; } = true;
+
+    /// <summary>zstd level, 1 to 22</summary>
+    public int CompressionLevel { get; init; } = 3;
+
+    /// <summary>Uncompressed bytes per independent zstd frame (0 = 4 MiB)</summary>
+    public int FrameSize { get; init; }
+
+    /// <summary>Threads compressing frames (1 = the background writer thread alone)</summary>
+    public int CompressionThreads { get; init; } = 1;
+
+    /// <summary>Queue capacity in bytes (0 = 64 MiB)</summary>
+    public long QueueSize { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native writer
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject
+        {
+            ["compression"] = Compress ? "zstd" : "none",
+            ["compression_level"] = CompressionLevel,
+            ["compression_threads"] = CompressionThreads
+        };
+        if (FrameSize > 0)
+            json["frame_size"] = FrameSize;
+        if (QueueSize > 0)
+            json["queue_size"] = QueueSize;
+        return json.ToJsonString();
+    }
+}
@@ -0,0 +1,20 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Statistics of one column within one row group
+/// </summary>
+/// <remarks>
+/// Minimum and maximum cover every value, including sentinels such as undefined prices.
+/// Use them to skip row groups that can't match a query.
+/// </remarks>
+/// <param name="Min">Smallest value</param>
+/// <param name="Max">Largest value</param>
+/// <param name="Encoding">Encoding of the chunk</param>
+/// <param name="EncodedSize">Bytes after decompression</param>
+/// <param name="StoredSize">Bytes in the file</param>
+public sealed record DbnColumnChunkStats(
+    Int128 Min,
+    Int128 Max,
+    string Encoding,
+    long EncodedSize,
+    long StoredSize);
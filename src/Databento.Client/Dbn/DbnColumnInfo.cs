@@ -0,0 +1,14 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// A column of a DBN columnar file
+/// </summary>
+/// <param name="Name">Field name (for example "ts_event", "price" or "bid_px_00")</param>
+/// <param name="Width">Bytes per value: 1, 2, 4 or 8</param>
+/// <param name="IsSigned">Whether values are signed integers</param>
+/// <param name="Encoding">Preferred encoding: delta_of_delta, delta, varint, dictionary or plain</param>
+public sealed record DbnColumnInfo(
+    string Name,
+    int Width,
+    bool IsSigned,
+    string Encoding);
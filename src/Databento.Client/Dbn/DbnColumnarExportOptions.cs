@@ -0,0 +1,34 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// How <see cref="DbnColumnarExporter"/> lays out and compresses columnar files
+/// </summary>
+public sealed class DbnColumnarExportOptions
+{
+    /// <summary>Rows per row group (null = 1,048,576, capped at 64 MiB of records)</summary>
+    public int? RowGroupSize { get; init; }
+
+    /// <summary>zstd level for column chunks, 1 to 22 (null = 3)</summary>
+    public int? CompressionLevel { get; init; }
+
+    /// <summary>Compress column chunks with zstd; false stores encoded chunks uncompressed</summary>
+    public bool Compress { get; init; } = true;
+
+    /// <summary>Worker threads, each exporting one input file at a time (0 = one per core)</summary>
+    public int Threads { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native exporter
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject { ["compression"] = Compress ? "zstd" : "none" };
+        if (RowGroupSize.HasValue)
+            json["row_group_size"] = RowGroupSize.Value;
+        if (CompressionLevel.HasValue)
+            json["compression_level"] = CompressionLevel.Value;
+        return json.ToJsonString();
+    }
+}
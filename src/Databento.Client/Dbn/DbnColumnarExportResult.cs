@@ -0,0 +1,12 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Result of a <see cref="DbnColumnarExporter"/> run
+/// </summary>
+/// <param name="Outputs">Columnar files written, grouped by input file in the order given</param>
+/// <param name="RowsExported">Rows written across all outputs</param>
+/// <param name="RecordsSkipped">Records of types without a columnar layout (definitions, imbalance, control records)</param>
+public sealed record DbnColumnarExportResult(
+    IReadOnlyList<DbnColumnarOutput> Outputs,
+    ulong RowsExported,
+    ulong RecordsSkipped);
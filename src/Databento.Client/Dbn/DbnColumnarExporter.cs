@@ -0,0 +1,119 @@
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Interop;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Exports DBN files natively to compressed columnar files
+/// </summary>
+/// <remarks>
+/// Each input <c>name.dbn[.zst]</c> produces <c>name.&lt;schema&gt;.dbnc</c> for every record
+/// type it contains. Timestamps are stored as delta-of-delta varints, prices as delta
+/// varints and enums as dictionaries, with each column chunk compressed by zstd and
+/// per-chunk min/max statistics in the footer. Read the files with <see cref="DbnColumnarReader"/>.
+/// </remarks>
+public static class DbnColumnarExporter
+{
+    /// <summary>
+    /// Export DBN files to columnar files
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="outputDirectory">Existing directory for the columnar files</param>
+    /// <param name="options">Row group size, compression and parallelism (null = defaults)</param>
+    /// <returns>Files written</returns>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DirectoryNotFoundException">If the output directory does not exist</exception>
+    /// <exception cref="DbentoException">If a file cannot be read or written, or the options are invalid</exception>
+    public static DbnColumnarExportResult Export(
+        IEnumerable<string> filePaths,
+        string outputDirectory,
+        DbnColumnarExportOptions? options = null)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        ArgumentException.ThrowIfNullOrWhiteSpace(outputDirectory);
+        options ??= new DbnColumnarExportOptions();
+        ArgumentOutOfRangeException.ThrowIfNegative(options.Threads);
+
+        string[] paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            throw new ArgumentException("At least one file is required", nameof(filePaths));
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+        if (!Directory.Exists(outputDirectory))
+            throw new DirectoryNotFoundException($"Output directory not found: {outputDirectory}");
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_columnar_export(
+            paths,
+            (nuint)paths.Length,
+            outputDirectory,
+            options.ToJson(),
+            options.Threads,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to export DBN files: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            using var document = JsonDocument.Parse(json);
+            return ParseResult(document.RootElement);
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Export DBN files to columnar files without blocking the caller
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="outputDirectory">Existing directory for the columnar files</param>
+    /// <param name="options">Row group size, compression and parallelism (null = defaults)</param>
+    /// <param name="cancellationToken">Cancels before the export starts; a running export completes</param>
+    /// <returns>Files written</returns>
+    public static Task<DbnColumnarExportResult> ExportAsync(
+        IEnumerable<string> filePaths,
+        string outputDirectory,
+        DbnColumnarExportOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => Export(filePaths, outputDirectory, options), cancellationToken);
+    }
+
+    private static DbnColumnarExportResult ParseResult(JsonElement root)
+    {
+        var outputs = new List<DbnColumnarOutput>();
+        foreach (var file in root.GetProperty("files").EnumerateArray())
+        {
+            string input = file.GetProperty("input").GetString() ?? string.Empty;
+            foreach (var output in file.GetProperty("outputs").EnumerateArray())
+            {
+                outputs.Add(new DbnColumnarOutput(
+                    input,
+                    output.GetProperty("path").GetString() ?? string.Empty,
+                    output.GetProperty("schema").GetString() ?? string.Empty,
+                    output.GetProperty("rows").GetUInt64(),
+                    output.GetProperty("row_groups").GetInt32(),
+                    output.GetProperty("bytes").GetInt64()));
+            }
+        }
+        return new DbnColumnarExportResult(
+            outputs,
+            root.GetProperty("rows_exported").GetUInt64(),
+            root.GetProperty("records_skipped").GetUInt64());
+    }
+}
@@ -0,0 +1,18 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// One columnar file written by <see cref="DbnColumnarExporter"/>
+/// </summary>
+/// <param name="InputPath">DBN file the rows came from</param>
+/// <param name="Path">Path of the columnar file</param>
+/// <param name="Schema">Schema of the rows (for example "mbo" or "ohlcv-1m")</param>
+/// <param name="Rows">Rows written</param>
+/// <param name="RowGroups">Row groups written</param>
+/// <param name="Bytes">Size of the file in bytes</param>
+public sealed record DbnColumnarOutput(
+    string InputPath,
+    string Path,
+    string Schema,
+    ulong Rows,
+    int RowGroups,
+    long Bytes);
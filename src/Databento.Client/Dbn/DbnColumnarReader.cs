@@ -0,0 +1,269 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Client.Models.Dbn;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Reader for columnar files written by <see cref="DbnColumnarExporter"/>
+/// </summary>
+/// <remarks>
+/// The file is memory-mapped natively and only the footer is parsed on open; each
+/// column chunk is decompressed and decoded straight into the returned array.
+/// Values keep their DBN representation: prices are fixed-point (1e-9), timestamps
+/// are nanoseconds since the UNIX epoch and enums are their raw character codes.
+/// Not safe for concurrent reads from multiple threads.
+/// </remarks>
+public sealed class DbnColumnarReader : IDbnColumnarReader
+{
+    // Native result when the value buffer is too small for the row group
+    private const int BufferTooSmallResult = -3;
+
+    private readonly DbnColumnarReaderHandle _handle;
+    private readonly Dictionary<string, int> _columnIndex;
+    // Atomic disposal state (0=active, 1=disposing, 2=disposed)
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Open a columnar file
+    /// </summary>
+    /// <param name="filePath">Path to the .dbnc file</param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnColumnarReader(string filePath)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException($"Columnar file not found: {filePath}", filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_columnar_open(
+            filePath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open columnar file: {error}");
+        }
+
+        _handle = new DbnColumnarReaderHandle(handlePtr);
+        try
+        {
+            var jsonPtr = NativeMethods.dbento_dbn_columnar_get_schema(
+                _handle,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (jsonPtr == IntPtr.Zero)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Failed to read columnar file layout: {error}");
+            }
+
+            try
+            {
+                var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+                using var document = JsonDocument.Parse(json);
+                var root = document.RootElement;
+                Schema = root.GetProperty("schema").GetString() ?? string.Empty;
+                RowCount = root.GetProperty("row_count").GetUInt64();
+                Metadata = JsonSerializer.Deserialize<DbnMetadata>(root.GetProperty("metadata").GetRawText())
+                    ?? throw new DbentoException("Failed to deserialize DBN file metadata");
+                Columns = root.GetProperty("columns").EnumerateArray()
+                    .Select(c => new DbnColumnInfo(
+                        c.GetProperty("name").GetString() ?? string.Empty,
+                        c.GetProperty("width").GetInt32(),
+                        c.GetProperty("signed").GetBoolean(),
+                        c.GetProperty("encoding").GetString() ?? string.Empty))
+                    .ToArray();
+                RowGroups = root.GetProperty("row_groups").EnumerateArray()
+                    .Select(ParseRowGroup)
+                    .ToArray();
+            }
+            finally
+            {
+                NativeMethods.dbento_free_string(jsonPtr);
+            }
+        }
+        catch
+        {
+            _handle.Dispose();
+            throw;
+        }
+
+        _columnIndex = new Dictionary<string, int>(StringComparer.Ordinal);
+        for (int i = 0; i < Columns.Count; i++)
+            _columnIndex[Columns[i].Name] = i;
+    }
+
+    /// <summary>
+    /// Schema of the rows (for example "mbo" or "ohlcv-1m")
+    /// </summary>
+    public string Schema { get; }
+
+    /// <summary>
+    /// Total rows in the file
+    /// </summary>
+    public ulong RowCount { get; }
+
+    /// <summary>
+    /// Columns in file order
+    /// </summary>
+    public IReadOnlyList<DbnColumnInfo> Columns { get; }
+
+    /// <summary>
+    /// Row groups with per-column statistics
+    /// </summary>
+    public IReadOnlyList<DbnColumnarRowGroup> RowGroups { get; }
+
+    /// <summary>
+    /// Metadata of the DBN file the rows were exported from
+    /// </summary>
+    public DbnMetadata Metadata { get; }
+
+    /// <summary>
+    /// Index of a column by name
+    /// </summary>
+    /// <param name="name">Column name</param>
+    /// <returns>Column index, or -1 if there is no such column</returns>
+    public int GetColumnIndex(string name)
+    {
+        ArgumentNullException.ThrowIfNull(name);
+        return _columnIndex.TryGetValue(name, out int index) ? index : -1;
+    }
+
+    /// <summary>
+    /// Decode one column of one row group
+    /// </summary>
+    /// <typeparam name="T">Value type; must be as wide as the column (for example long for prices)</typeparam>
+    /// <param name="rowGroup">Row group index</param>
+    /// <param name="column">Column index</param>
+    /// <returns>One value per row</returns>
+    public T[] ReadColumn<T>(int rowGroup, int column) where T : unmanaged
+    {
+        ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegative(rowGroup);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(rowGroup, RowGroups.Count);
+        ArgumentOutOfRangeException.ThrowIfNegative(column);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(column, Columns.Count);
+        CheckWidth<T>(Columns[column]);
+
+        var values = new T[RowGroups[rowGroup].Rows];
+        ReadInto(rowGroup, column, values);
+        return values;
+    }
+
+    /// <summary>
+    /// Decode one column across all row groups
+    /// </summary>
+    /// <typeparam name="T">Value type; must be as wide as the column (for example long for prices)</typeparam>
+    /// <param name="column">Column name</param>
+    /// <returns>One value per row in the file</returns>
+    public T[] ReadColumn<T>(string column) where T : unmanaged
+    {
+        ThrowIfDisposed();
+        int index = GetColumnIndex(column);
+        if (index < 0)
+            throw new ArgumentException($"No column named '{column}'", nameof(column));
+        CheckWidth<T>(Columns[index]);
+
+        var values = new T[checked((int)RowCount)];
+        for (int group = 0; group < RowGroups.Count; group++)
+        {
+            var rowGroup = RowGroups[group];
+            ReadInto(group, index, values.AsSpan((int)rowGroup.FirstRow, rowGroup.Rows));
+        }
+        return values;
+    }
+
+    private unsafe void ReadInto<T>(int rowGroup, int column, Span<T> destination) where T : unmanaged
+    {
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        nuint rowCount;
+        fixed (T* values = destination)
+        {
+            result = NativeMethods.dbento_dbn_columnar_read_column(
+                _handle,
+                (nuint)rowGroup,
+                (nuint)column,
+                (byte*)values,
+                (nuint)(destination.Length * sizeof(T)),
+                out rowCount,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result == BufferTooSmallResult)
+            throw new DbentoException($"Row group {rowGroup} has {rowCount} rows, expected {destination.Length}");
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to read column '{Columns[column].Name}': {error}");
+        }
+    }
+
+    private static void CheckWidth<T>(DbnColumnInfo column) where T : unmanaged
+    {
+        if (Unsafe.SizeOf<T>() != column.Width)
+            throw new ArgumentException(
+                $"Column '{column.Name}' holds {column.Width}-byte values; {typeof(T).Name} is {Unsafe.SizeOf<T>()} bytes");
+    }
+
+    private static DbnColumnarRowGroup ParseRowGroup(JsonElement group)
+    {
+        var stats = group.GetProperty("columns").EnumerateArray()
+            .Select(c => new DbnColumnChunkStats(
+                ParseStat(c.GetProperty("min")),
+                ParseStat(c.GetProperty("max")),
+                c.GetProperty("encoding").GetString() ?? string.Empty,
+                c.GetProperty("encoded_size").GetInt64(),
+                c.GetProperty("stored_size").GetInt64()))
+            .ToArray();
+        return new DbnColumnarRowGroup(
+            group.GetProperty("first_row").GetUInt64(),
+            group.GetProperty("rows").GetInt32(),
+            stats);
+    }
+
+    private static Int128 ParseStat(JsonElement value)
+    {
+        // Unsigned columns may exceed long.MaxValue (e.g. undefined timestamps)
+        return value.TryGetInt64(out long signed) ? signed : value.GetUInt64();
+    }
+
+    private void ThrowIfDisposed()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+    }
+
+    /// <summary>
+    /// Dispose the reader and unmap the file
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+
+    /// <summary>
+    /// Asynchronously dispose the reader and unmap the file
+    /// </summary>
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
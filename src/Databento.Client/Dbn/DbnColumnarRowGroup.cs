@@ -0,0 +1,12 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// A row group of a DBN columnar file
+/// </summary>
+/// <param name="FirstRow">Index of the group's first row in the file</param>
+/// <param name="Rows">Rows in the group</param>
+/// <param name="Columns">Statistics for each column, in column order</param>
+public sealed record DbnColumnarRowGroup(
+    ulong FirstRow,
+    int Rows,
+    IReadOnlyList<DbnColumnChunkStats> Columns);
@@ -14,6 +14,12 @@ namespace Databento.Client.Dbn;
 /// </summary>
 public sealed class DbnFileReader : IDbnFileReader
 {
+    // Records requested per native call and the packed buffer they are read into
+    private const int DefaultBatchSize = 4096;
+    private const int BatchBufferSize = 1024 * 1024;
+    // Native result when the buffer can't hold even one record
+    private const int BufferTooSmallResult = -3;
+
     private readonly DbnFileReaderHandle _handle;
     private DbnMetadata? _cachedMetadata;
     // MEDIUM FIX: Use atomic int for disposal state (0=active, 1=disposing, 2=disposed)
@@ -26,6 +32,40 @@ public sealed class DbnFileReader : IDbnFileReader
     /// <exception cref="FileNotFoundException">If the file does not exist</exception>
     /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
     public DbnFileReader(string filePath)
+        : this(filePath, 0)
+    {
+    }
+
+    /// <summary>
+    /// Open a DBN file for reading with control over parallel decompression
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="decompressionThreads">
+    /// Worker threads for zstd files made of multiple independent frames (0 = automatic, 1 = disabled)
+    /// </param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnFileReader(string filePath, int decompressionThreads)
+        : this(filePath, null, decompressionThreads)
+    {
+    }
+
+    /// <summary>
+    /// Open a DBN file, keeping only records that match a filter
+    /// </summary>
+    /// <remarks>
+    /// The filter runs natively over raw records, so rejected records are never copied or
+    /// materialized. Current-version files are scanned without the decoder and batch reads
+    /// evaluate runs of same-type records at once.
+    /// </remarks>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="filter">Records to keep (null = all records)</param>
+    /// <param name="decompressionThreads">
+    /// Worker threads for zstd files made of multiple independent frames (0 = automatic, 1 = disabled)
+    /// </param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnFileReader(string filePath, DbnRecordFilter? filter, int decompressionThreads = 0)
     {
         if (string.IsNullOrWhiteSpace(filePath))
             throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
@@ -35,14 +75,64 @@ public sealed class DbnFileReader : IDbnFileReader
 
         // MEDIUM FIX: Increased from 512 to 2048 for full error context
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
-        var handlePtr = NativeMethods.dbento_dbn_file_open(
+        ArgumentOutOfRangeException.ThrowIfNegative(decompressionThreads);
+
+        var handlePtr = filter == null
+            ? NativeMethods.dbento_dbn_file_open_ex(
+                filePath,
+                decompressionThreads,
+                errorBuffer,
+                (nuint)errorBuffer.Length)
+            : NativeMethods.dbento_dbn_file_open_filtered(
+                filePath,
+                decompressionThreads,
+                filter.ToJson(),
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            // HIGH FIX: Use safe error string extraction
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open DBN file: {error}");
+        }
+
+        _handle = new DbnFileReaderHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Open a DBN file with reads issued ahead of decoding
+    /// </summary>
+    /// <remarks>
+    /// Overlaps disk reads with decoding, which helps most on a cold page cache, NVMe drives
+    /// and network filesystems. Multi-frame zstd files are not decompressed in parallel in this
+    /// mode. Check <see cref="IoBackend"/> for the backend that was actually used.
+    /// </remarks>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="prefetch">Buffer size and number of reads in flight</param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnFileReader(string filePath, DbnPrefetchOptions prefetch)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        ArgumentNullException.ThrowIfNull(prefetch);
+        ArgumentOutOfRangeException.ThrowIfNegative(prefetch.BufferSize);
+        ArgumentOutOfRangeException.ThrowIfNegative(prefetch.QueueDepth);
+
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_file_open_prefetched(
             filePath,
+            (nuint)prefetch.BufferSize,
+            (nuint)prefetch.QueueDepth,
             errorBuffer,
             (nuint)errorBuffer.Length);
 
         if (handlePtr == IntPtr.Zero)
         {
-            // HIGH FIX: Use safe error string extraction
             var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
             throw new DbentoException($"Failed to open DBN file: {error}");
         }
@@ -96,27 +186,50 @@ public sealed class DbnFileReader : IDbnFileReader
     /// <returns>Async enumerable of records</returns>
     public async IAsyncEnumerable<Record> ReadRecordsAsync(
         [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        // Records are fetched in batches to amortize native call overhead
+        await foreach (var batch in ReadRecordBatchesAsync(DefaultBatchSize, cancellationToken))
+        {
+            foreach (var record in batch)
+            {
+                yield return record;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Read records in batches, fetching many records per native call
+    /// </summary>
+    /// <param name="maxBatchSize">Maximum records per batch</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of record batches in file order</returns>
+    public async IAsyncEnumerable<IReadOnlyList<Record>> ReadRecordBatchesAsync(
+        int maxBatchSize = DefaultBatchSize,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
     {
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxBatchSize);
 
-        // Use a reasonably large buffer for records
-        byte[] recordBuffer = new byte[Utilities.Constants.RecordBufferSize];
-        // Error buffer for native calls
+        byte[] recordBuffer = new byte[BatchBufferSize];
+        nuint[] offsets = new nuint[maxBatchSize];
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
 
         await Task.Yield(); // Make it properly async
 
-        // MEDIUM FIX: Track record number for better error messages
+        // Track record number for better error messages
         ulong recordNumber = 0;
 
-        while (!cancellationToken.IsCancellationRequested)
+        while (true)
         {
-            int result = NativeMethods.dbento_dbn_file_next_record(
+            cancellationToken.ThrowIfCancellationRequested();
+
+            int result = NativeMethods.dbento_dbn_file_next_records(
                 _handle,
                 recordBuffer,
                 (nuint)recordBuffer.Length,
-                out nuint recordLength,
-                out byte recordType,
+                offsets,
+                (nuint)offsets.Length,
+                out nuint recordCount,
                 errorBuffer,
                 (nuint)errorBuffer.Length);
 
@@ -126,42 +239,162 @@ public sealed class DbnFileReader : IDbnFileReader
                 yield break;
             }
 
+            if (result == BufferTooSmallResult && recordBuffer.Length < Utilities.Constants.MaxReasonableRecordSize)
+            {
+                // Next record is larger than the whole buffer; it is kept natively, so grow and retry
+                recordBuffer = new byte[Math.Min(recordBuffer.Length * 2, Utilities.Constants.MaxReasonableRecordSize)];
+                continue;
+            }
+
             if (result < 0)
             {
-                // Error occurred
-                // HIGH FIX: Use safe error string extraction
-                // MEDIUM FIX: Include record number in error message
                 var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
                 throw new DbentoException($"Error reading DBN file record #{recordNumber}: {error}");
             }
 
-            // Success - parse the record
-            if (recordLength > 0)
+            var batch = new Record[(int)recordCount];
+            for (int i = 0; i < batch.Length; i++)
             {
-                byte[] recordBytes = new byte[recordLength];
-                Array.Copy(recordBuffer, recordBytes, (int)recordLength);
-
-                // MEDIUM FIX: Wrap deserialization to provide better error context
-                Record record;
+                int offset = (int)offsets[i];
+                int length = recordBuffer[offset] * 4;
                 try
                 {
-                    record = Record.FromBytes(recordBytes, recordType);
+                    // FromBytes copies the record, so the buffer can be reused for the next batch
+                    batch[i] = Record.FromBytes(recordBuffer.AsSpan(offset, length), recordBuffer[offset + 1]);
                 }
                 catch (Exception ex)
                 {
-                    // Include record number in error for better debugging
                     throw new DbentoException($"Error deserializing DBN file record #{recordNumber}: {ex.Message}", ex);
                 }
-
                 recordNumber++;
-                yield return record;
             }
 
-            // Allow cancellation between records
-            cancellationToken.ThrowIfCancellationRequested();
+            yield return batch;
         }
     }
 
+    /// <summary>
+    /// Records scanned and passed by the filter given at open (zero without a filter)
+    /// </summary>
+    public DbnFilterStats FilterStats
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            if (NativeMethods.dbento_dbn_file_get_filter_stats(_handle, out ulong scanned, out ulong passed) < 0)
+                throw new DbentoException("Failed to get DBN filter statistics");
+            return new DbnFilterStats(scanned, passed);
+        }
+    }
+
+    /// <summary>
+    /// How this reader gets bytes from disk
+    /// </summary>
+    public DbnIoBackend IoBackend
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            int backend = NativeMethods.dbento_dbn_file_get_io_backend(_handle);
+            if (backend < 0)
+                throw new DbentoException("Failed to get DBN reader I/O backend");
+            return (DbnIoBackend)backend;
+        }
+    }
+
+    /// <summary>
+    /// Position the reader at the first record with ts_event at or after a timestamp
+    /// </summary>
+    /// <remarks>
+    /// Uses the <c>.idx</c> sidecar index next to the file, building it first if it is missing or stale.
+    /// Reading continues from the new position; don't call this while an enumeration is in progress.
+    /// </remarks>
+    /// <param name="timestamp">Target event time</param>
+    /// <returns>False if no record is at or after the timestamp</returns>
+    public bool SeekToTime(DateTimeOffset timestamp)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_seek_time(
+            _handle,
+            Utilities.DateTimeHelpers.ToUnixNanos(timestamp),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to seek DBN file: {error}", result);
+        }
+
+        return result == 0;
+    }
+
+    /// <summary>
+    /// Restrict reading to the given instruments and restart from the beginning of the file
+    /// </summary>
+    /// <remarks>
+    /// Only index blocks containing a selected instrument are decompressed and decoded, so read time
+    /// scales with the selection rather than the file size. Builds the <c>.idx</c> sidecar if it is missing.
+    /// </remarks>
+    /// <param name="instrumentIds">Instrument IDs to keep (empty = all instruments)</param>
+    public void SelectInstruments(IEnumerable<uint> instrumentIds)
+    {
+        ArgumentNullException.ThrowIfNull(instrumentIds);
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        uint[] ids = instrumentIds.ToArray();
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_select_instruments(
+            _handle,
+            ids,
+            (nuint)ids.Length,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to select instruments: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Build (or rebuild) the index sidecar used by <see cref="SeekToTime"/> and <see cref="SelectInstruments"/>
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="recordInterval">Records between checkpoints (0 with byteInterval 0 = defaults)</param>
+    /// <param name="byteInterval">Decompressed bytes between checkpoints (0 = no byte limit)</param>
+    /// <returns>Number of checkpoints written</returns>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be indexed</exception>
+    public static long BuildIndex(string filePath, long recordInterval = 0, long byteInterval = 0)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
+        ArgumentOutOfRangeException.ThrowIfNegative(recordInterval);
+        ArgumentOutOfRangeException.ThrowIfNegative(byteInterval);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        long checkpoints = NativeMethods.dbento_dbn_build_index(
+            filePath,
+            (ulong)recordInterval,
+            (ulong)byteInterval,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (checkpoints < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to build DBN index: {error}");
+        }
+
+        return checkpoints;
+    }
+
     /// <summary>
     /// Dispose the file reader and free resources
     /// </summary>
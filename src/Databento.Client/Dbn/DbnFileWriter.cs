@@ -1,3 +1,4 @@
+using System.Buffers;
 using System.Runtime.InteropServices;
 using System.Text.Json;
 using Databento.Client.Models;
@@ -13,6 +14,9 @@ namespace Databento.Client.Dbn;
 /// </summary>
 public sealed class DbnFileWriter : IDbnFileWriter
 {
+    // Bytes packed per native call by WriteRecords(IEnumerable<Record>)
+    private const int BatchSize = 1024 * 1024;
+
     private readonly DbnFileWriterHandle _handle;
     private readonly string _filePath;
     // MEDIUM FIX: Use atomic int for disposal state (0=active, 1=disposing, 2=disposed)
@@ -26,6 +30,24 @@ public sealed class DbnFileWriter : IDbnFileWriter
     /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
     /// <exception cref="DbentoException">If the file cannot be created</exception>
     public DbnFileWriter(string filePath, DbnMetadata metadata)
+        : this(filePath, metadata, Compression.None)
+    {
+    }
+
+    /// <summary>
+    /// Create a new DBN file writer with optional zstd compression
+    /// </summary>
+    /// <param name="filePath">Path where the DBN file will be created</param>
+    /// <param name="metadata">Metadata for the DBN file</param>
+    /// <param name="compression">None or Zstd</param>
+    /// <param name="compressionLevel">zstd compression level</param>
+    /// <param name="frameSize">
+    /// Uncompressed bytes per independent zstd frame (0 = 4 MiB default). Smaller frames let readers
+    /// decompress in parallel with finer granularity at a small cost in compression ratio.
+    /// </param>
+    /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be created</exception>
+    public DbnFileWriter(string filePath, DbnMetadata metadata, Compression compression, int compressionLevel = 3, int frameSize = 0)
     {
         if (string.IsNullOrWhiteSpace(filePath))
             throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
@@ -39,9 +61,16 @@ public sealed class DbnFileWriter : IDbnFileWriter
 
         // MEDIUM FIX: Increased from 512 to 2048 for full error context
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
-        var handlePtr = NativeMethods.dbento_dbn_file_create(
+        if (compression == Compression.Gzip)
+            throw new ArgumentException("Gzip is not supported for DBN files", nameof(compression));
+        ArgumentOutOfRangeException.ThrowIfNegative(frameSize);
+
+        var handlePtr = NativeMethods.dbento_dbn_file_create_ex(
             filePath,
             metadataJson,
+            compression == Compression.Zstd ? 1 : 0,
+            compressionLevel,
+            (nuint)frameSize,
             errorBuffer,
             (nuint)errorBuffer.Length);
 
@@ -55,6 +84,107 @@ public sealed class DbnFileWriter : IDbnFileWriter
         _handle = new DbnFileWriterHandle(handlePtr);
     }
 
+    /// <summary>
+    /// Create a DBN file writer that compresses and writes on a background thread
+    /// </summary>
+    /// <remarks>
+    /// Writes return once the records are queued. Call <see cref="Flush"/> or <see cref="Sync"/>
+    /// to wait for them to reach the OS or the disk; errors on the background thread are
+    /// thrown by the next write, flush or dispose. Not safe for concurrent writes from
+    /// multiple threads.
+    /// </remarks>
+    /// <param name="filePath">Path where the DBN file will be created</param>
+    /// <param name="metadata">Metadata for the DBN file</param>
+    /// <param name="options">Compression and queue settings</param>
+    /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be created</exception>
+    public DbnFileWriter(string filePath, DbnMetadata metadata, DbnAsyncWriterOptions options)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        ArgumentNullException.ThrowIfNull(metadata);
+        ArgumentNullException.ThrowIfNull(options);
+        ArgumentOutOfRangeException.ThrowIfNegative(options.FrameSize);
+        ArgumentOutOfRangeException.ThrowIfNegative(options.QueueSize);
+        ArgumentOutOfRangeException.ThrowIfLessThan(options.CompressionThreads, 1);
+
+        _filePath = filePath;
+        string metadataJson = JsonSerializer.Serialize(metadata);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_file_create_async(
+            filePath,
+            metadataJson,
+            options.ToJson(),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to create DBN file: {error}");
+        }
+
+        _handle = new DbnFileWriterHandle(handlePtr);
+    }
+
+    private DbnFileWriter(string filePath, DbnFileWriterHandle handle)
+    {
+        _filePath = filePath;
+        _handle = handle;
+    }
+
+    /// <summary>
+    /// Open an existing DBN file to append records to it
+    /// </summary>
+    /// <remarks>
+    /// The file must be in the current DBN version (see <see cref="DbnUpgrader"/>). Writing
+    /// resumes after the last complete record, so the partial tail of a file cut short by a
+    /// crash is dropped. On dispose the header's end timestamp and limit are raised to cover
+    /// the appended records, and symbols from <paramref name="metadata"/> are merged into the
+    /// header when it keeps its encoded length.
+    /// </remarks>
+    /// <param name="filePath">Existing DBN file, zstd-compressed or not</param>
+    /// <param name="metadata">
+    /// Metadata whose symbols and mappings are merged into the header; its dataset, schema,
+    /// symbology types and ts_out must match the file (null keeps the header)
+    /// </param>
+    /// <param name="options">Compression and background writing settings</param>
+    /// <exception cref="ArgumentException">If file path is invalid</exception>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be appended to</exception>
+    public static DbnFileWriter OpenAppend(string filePath, DbnMetadata? metadata = null, DbnAppendOptions? options = null)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
+        if (options != null)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(options.FrameSize);
+            ArgumentOutOfRangeException.ThrowIfNegative(options.QueueSize);
+            ArgumentOutOfRangeException.ThrowIfLessThan(options.CompressionThreads, 1);
+        }
+
+        string? metadataJson = metadata == null ? null : JsonSerializer.Serialize(metadata);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_file_open_append(
+            filePath,
+            metadataJson,
+            options?.ToJson(),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open DBN file for appending: {error}");
+        }
+
+        return new DbnFileWriter(filePath, new DbnFileWriterHandle(handlePtr));
+    }
+
     /// <summary>
     /// Write a single record to the DBN file
     /// </summary>
@@ -88,31 +218,135 @@ public sealed class DbnFileWriter : IDbnFileWriter
     /// <summary>
     /// Write multiple records to the DBN file
     /// </summary>
+    /// <remarks>
+    /// Records are packed into batches of about 1 MiB, each written with one native call.
+    /// </remarks>
     /// <param name="records">Records to write</param>
     public void WriteRecords(IEnumerable<Record> records)
     {
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
         ArgumentNullException.ThrowIfNull(records);
 
-        foreach (var record in records)
+        byte[] batch = ArrayPool<byte>.Shared.Rent(BatchSize);
+        try
+        {
+            int length = 0;
+            int count = 0;
+            foreach (var record in records)
+            {
+                ArgumentNullException.ThrowIfNull(record, nameof(records));
+                byte[]? bytes = record.RawBytes;
+                if (bytes == null || bytes.Length == 0)
+                    throw new InvalidOperationException("Record does not have raw bytes available for writing. " +
+                        "Only records read from DBN files can be written.");
+
+                if (length + bytes.Length > batch.Length)
+                {
+                    WriteRecords(batch.AsSpan(0, length), count);
+                    length = 0;
+                    count = 0;
+                    if (bytes.Length > batch.Length)
+                    {
+                        WriteRecords(bytes, 1);
+                        continue;
+                    }
+                }
+                bytes.CopyTo(batch, length);
+                length += bytes.Length;
+                count++;
+            }
+            if (count > 0)
+                WriteRecords(batch.AsSpan(0, length), count);
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(batch);
+        }
+    }
+
+    /// <summary>
+    /// Write records stored back to back in DBN format
+    /// </summary>
+    /// <remarks>
+    /// The records are written straight from <paramref name="records"/> without a copy. The
+    /// buffer is validated as a whole first, so a malformed batch writes nothing.
+    /// </remarks>
+    /// <param name="records">Records, each as long as the length in its header</param>
+    /// <param name="count">Number of records in the buffer</param>
+    /// <exception cref="DbentoException">If the buffer does not hold exactly <paramref name="count"/> records</exception>
+    public unsafe void WriteRecords(ReadOnlySpan<byte> records, int count)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (byte* bytes = records)
+        {
+            result = NativeMethods.dbento_dbn_file_write_records(
+                _handle,
+                bytes,
+                (nuint)records.Length,
+                (nuint)count,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result != 0)
         {
-            WriteRecord(record);
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to write records to DBN file: {error}");
         }
     }
 
     /// <summary>
     /// Flush any buffered data to disk
     /// </summary>
+    /// <remarks>
+    /// For background writers this waits until every record written so far is compressed and
+    /// handed to the OS. Other writers write on the calling thread, so this is a no-op.
+    /// </remarks>
     public void Flush()
     {
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
-        // The native layer automatically flushes on write
-        // This method is provided for API consistency
+        FlushNative(sync: false);
+    }
+
+    /// <summary>
+    /// Wait until every record written so far is on stable storage
+    /// </summary>
+    /// <exception cref="DbentoException">
+    /// If the writer was not created with <see cref="DbnAsyncWriterOptions"/> or <see cref="DbnAppendOptions.Background"/>
+    /// </exception>
+    public void Sync()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        FlushNative(sync: true);
+    }
+
+    private void FlushNative(bool sync)
+    {
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_flush(
+            _handle,
+            sync ? 1 : 0,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to flush DBN file: {error}");
+        }
     }
 
     /// <summary>
     /// Dispose the file writer and finalize the file
     /// </summary>
+    /// <exception cref="DbentoException">
+    /// If the file could not be finished, e.g. a background write of the last frame failed;
+    /// the writer is disposed either way
+    /// </exception>
     public void Dispose()
     {
         // MEDIUM FIX: Atomic state transition (0=active -> 1=disposing -> 2=disposed)
@@ -120,10 +354,25 @@ public sealed class DbnFileWriter : IDbnFileWriter
         if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
             return;
 
-        _handle?.Dispose();
+        string? error = null;
+        if (_handle != null && !_handle.IsInvalid && !_handle.IsClosed)
+        {
+            // Close explicitly rather than through the SafeHandle, which cannot report errors
+            byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+            int result = NativeMethods.dbento_dbn_file_close_writer_ex(
+                _handle.DangerousGetHandle(),
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+            _handle.SetHandleAsInvalid();
+            if (result != 0)
+                error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+        }
 
         // Mark as fully disposed
         Interlocked.Exchange(ref _disposeState, 2);
+
+        if (error != null)
+            throw new DbentoException($"Failed to finish DBN file: {error}");
     }
 
     /// <summary>
@@ -0,0 +1,8 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Selectivity of a native record filter
+/// </summary>
+/// <param name="RecordsScanned">Records the filter evaluated</param>
+/// <param name="RecordsPassed">Records that matched</param>
+public readonly record struct DbnFilterStats(ulong RecordsScanned, ulong RecordsPassed);
@@ -0,0 +1,20 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Keys that aggregation results are grouped by
+/// </summary>
+[Flags]
+public enum DbnGroupBy
+{
+    /// <summary>One group over all records</summary>
+    None = 0,
+
+    /// <summary>Group by instrument ID</summary>
+    Instrument = 1,
+
+    /// <summary>Group by publisher ID</summary>
+    Publisher = 2,
+
+    /// <summary>Group by ts_event bucket (see <see cref="DbnAggregationOptions.BucketSize"/>)</summary>
+    TimeBucket = 4
+}
@@ -0,0 +1,16 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// How a DBN file reader gets bytes from disk
+/// </summary>
+public enum DbnIoBackend
+{
+    /// <summary>Reads are issued synchronously on the consuming thread</summary>
+    Synchronous = 0,
+
+    /// <summary>A background thread reads ahead into a queue of buffers</summary>
+    ReadAheadThread = 1,
+
+    /// <summary>Reads are queued to the kernel through io_uring (Linux)</summary>
+    IoUring = 2
+}
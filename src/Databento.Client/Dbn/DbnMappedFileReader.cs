@@ -0,0 +1,269 @@
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Zero-copy reader for uncompressed DBN files backed by a memory mapping
+/// </summary>
+/// <remarks>
+/// Spans returned by this reader point directly into the mapping and must not be used after Dispose.
+/// Records are returned exactly as stored, so files in an older DBN version are rejected;
+/// upgrade them first with <see cref="DbnUpgrader"/>.
+/// Use <see cref="DbnFileReader"/> for zstd-compressed files.
+/// </remarks>
+public sealed class DbnMappedFileReader : IDbnMappedFileReader
+{
+    // Upper bound on a single borrow when materializing records
+    private const int ReadChunkBytes = 1024 * 1024;
+
+    private readonly DbnMmapReaderHandle _handle;
+    // Reused across reads so the per-record path doesn't allocate (reader is single-threaded)
+    private readonly byte[] _errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+    private DbnMetadata? _cachedMetadata;
+    // Atomic disposal state (0=active, 1=disposing, 2=disposed)
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Map an uncompressed DBN file for reading
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="pattern">Expected access pattern for the whole file</param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be mapped, is compressed, or is invalid</exception>
+    public DbnMappedFileReader(string filePath, DbnAccessPattern pattern = DbnAccessPattern.Sequential)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_mmap_open(
+            filePath,
+            (int)pattern,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to map DBN file: {error}");
+        }
+
+        _handle = new DbnMmapReaderHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Read position as a byte offset into the record section
+    /// </summary>
+    /// <remarks>Only offsets previously read from this property are valid to assign</remarks>
+    public long Position
+    {
+        get
+        {
+            ThrowIfDisposed();
+            long position = NativeMethods.dbento_dbn_mmap_tell(_handle);
+            if (position < 0)
+                throw new DbentoException("Failed to get mapped reader position");
+            return position;
+        }
+        set
+        {
+            ThrowIfDisposed();
+            ArgumentOutOfRangeException.ThrowIfNegative(value);
+            int result = NativeMethods.dbento_dbn_mmap_seek(_handle, (nuint)value);
+            if (result == -2)
+                throw new ArgumentOutOfRangeException(nameof(value), "Offset is out of range or not a record boundary");
+            if (result < 0)
+                throw new DbentoException("Failed to seek mapped reader", result);
+        }
+    }
+
+    /// <summary>
+    /// Get metadata about the DBN file
+    /// </summary>
+    /// <returns>DBN file metadata</returns>
+    public DbnMetadata GetMetadata()
+    {
+        ThrowIfDisposed();
+
+        if (_cachedMetadata != null)
+            return _cachedMetadata;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_mmap_get_metadata(
+            _handle,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to get DBN file metadata: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            _cachedMetadata = JsonSerializer.Deserialize<DbnMetadata>(json)
+                ?? throw new DbentoException("Failed to deserialize DBN file metadata");
+            return _cachedMetadata;
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Borrow the next record without copying
+    /// </summary>
+    /// <param name="record">Raw record bytes inside the mapping</param>
+    /// <param name="recordType">Record type identifier</param>
+    /// <returns>False at end of file</returns>
+    public unsafe bool TryReadNext(out ReadOnlySpan<byte> record, out byte recordType)
+    {
+        ThrowIfDisposed();
+
+        int result = NativeMethods.dbento_dbn_mmap_next_record(
+            _handle,
+            out byte* recordPtr,
+            out nuint recordLength,
+            out recordType,
+            _errorBuffer,
+            (nuint)_errorBuffer.Length);
+
+        if (result == 1)
+        {
+            record = default;
+            return false;
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(_errorBuffer);
+            throw new DbentoException($"Error reading mapped DBN record: {error}", result);
+        }
+
+        record = new ReadOnlySpan<byte>(recordPtr, (int)recordLength);
+        return true;
+    }
+
+    /// <summary>
+    /// Borrow a contiguous run of whole records without copying
+    /// </summary>
+    /// <param name="maxBytes">Maximum length of the run in bytes</param>
+    /// <param name="maxRecords">Maximum number of records in the run</param>
+    /// <param name="recordCount">Number of records in the returned run</param>
+    /// <returns>Packed records (each begins with its header); empty at end of file</returns>
+    public unsafe ReadOnlySpan<byte> BorrowRecords(int maxBytes, int maxRecords, out int recordCount)
+    {
+        ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxBytes);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxRecords);
+
+        int result = NativeMethods.dbento_dbn_mmap_borrow_records(
+            _handle,
+            (nuint)maxBytes,
+            (nuint)maxRecords,
+            out byte* records,
+            out nuint totalLength,
+            out nuint count,
+            _errorBuffer,
+            (nuint)_errorBuffer.Length);
+
+        if (result == 1)
+        {
+            recordCount = 0;
+            return ReadOnlySpan<byte>.Empty;
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(_errorBuffer);
+            throw new DbentoException($"Error borrowing mapped DBN records: {error}", result);
+        }
+
+        recordCount = (int)count;
+        return new ReadOnlySpan<byte>(records, (int)totalLength);
+    }
+
+    /// <summary>
+    /// Read all remaining records, materializing each one
+    /// </summary>
+    /// <returns>Enumerable of records</returns>
+    public IEnumerable<Record> ReadRecords()
+    {
+        ThrowIfDisposed();
+
+        var batch = new List<Record>();
+        while (true)
+        {
+            // Spans can't live across yield, so each borrowed run is materialized first
+            if (!MaterializeNextRun(batch))
+                yield break;
+
+            foreach (var record in batch)
+                yield return record;
+        }
+    }
+
+    private bool MaterializeNextRun(List<Record> batch)
+    {
+        batch.Clear();
+        var run = BorrowRecords(ReadChunkBytes, int.MaxValue, out int count);
+        if (count == 0)
+            return false;
+
+        int offset = 0;
+        for (int i = 0; i < count; i++)
+        {
+            int length = run[offset] * 4;
+            batch.Add(Record.FromBytes(run.Slice(offset, length), run[offset + 1]));
+            offset += length;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Advise the operating system about the access pattern for part of the record section
+    /// </summary>
+    /// <param name="pattern">Expected access pattern</param>
+    /// <param name="offset">Offset in bytes from the first record</param>
+    /// <param name="length">Length in bytes, or -1 for the rest of the file</param>
+    public void Advise(DbnAccessPattern pattern, long offset = 0, long length = -1)
+    {
+        ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegative(offset);
+
+        nuint nativeLength = length < 0 ? nuint.MaxValue : (nuint)length;
+        int result = NativeMethods.dbento_dbn_mmap_advise(_handle, (int)pattern, (nuint)offset, nativeLength);
+        if (result < 0)
+            throw new DbentoException("Failed to advise mapped DBN file", result);
+    }
+
+    private void ThrowIfDisposed()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+    }
+
+    /// <summary>
+    /// Dispose the reader and unmap the file
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+}
@@ -0,0 +1,13 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Timestamp used to order records when merging several DBN files
+/// </summary>
+public enum DbnMergeOrder
+{
+    /// <summary>Order by ts_event</summary>
+    EventTime = 0,
+
+    /// <summary>Order by ts_recv, falling back to ts_event for schemas without it</summary>
+    ReceiveTime = 1
+}
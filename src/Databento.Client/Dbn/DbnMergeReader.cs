@@ -0,0 +1,267 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Reader that merges several DBN files into one timestamp-ordered stream
+/// </summary>
+/// <remarks>
+/// Each file must already be sorted by the chosen timestamp, as DBN files from Databento are.
+/// Records with equal timestamps are returned in the order their files were given.
+/// Records are upgraded to DBN v3. Files may be plain or zstd-compressed.
+/// </remarks>
+public sealed class DbnMergeReader : IDbnMergeReader
+{
+    // Records requested per native call and the packed buffer they are read into
+    private const int DefaultBatchSize = 4096;
+    private const int BatchBufferSize = 1024 * 1024;
+    // Native result when the buffer can't hold even one record
+    private const int BufferTooSmallResult = -3;
+
+    private readonly DbnMergeReaderHandle _handle;
+    private readonly DbnMetadata?[] _cachedMetadata;
+    // Atomic disposal state (0=active, 1=disposing, 2=disposed)
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Open several DBN files for merged reading
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="order">Timestamp to order records by</param>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DbentoException">If a file cannot be opened or is invalid</exception>
+    public DbnMergeReader(IEnumerable<string> filePaths, DbnMergeOrder order = DbnMergeOrder.EventTime)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        string[] paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            throw new ArgumentException("At least one file is required", nameof(filePaths));
+
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_merge_open(
+            paths,
+            (nuint)paths.Length,
+            (int)order,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open DBN files for merging: {error}");
+        }
+
+        _handle = new DbnMergeReaderHandle(handlePtr);
+        _cachedMetadata = new DbnMetadata?[paths.Length];
+    }
+
+    /// <summary>
+    /// Number of input files
+    /// </summary>
+    public int FileCount => _cachedMetadata.Length;
+
+    /// <summary>
+    /// Get metadata of one input file
+    /// </summary>
+    /// <param name="fileIndex">Index of the file in the list given to the reader</param>
+    /// <returns>DBN file metadata</returns>
+    public DbnMetadata GetMetadata(int fileIndex)
+    {
+        ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegative(fileIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(fileIndex, _cachedMetadata.Length);
+
+        if (_cachedMetadata[fileIndex] is { } cached)
+            return cached;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_merge_get_metadata(
+            _handle,
+            (nuint)fileIndex,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to get DBN file metadata: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            var metadata = JsonSerializer.Deserialize<DbnMetadata>(json)
+                ?? throw new DbentoException("Failed to deserialize DBN file metadata");
+            _cachedMetadata[fileIndex] = metadata;
+            return metadata;
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Read all records in merge order as an async stream
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records</returns>
+    public async IAsyncEnumerable<Record> ReadRecordsAsync(
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        await foreach (var batch in ReadRecordBatchesAsync(DefaultBatchSize, cancellationToken))
+        {
+            foreach (var record in batch)
+            {
+                yield return record;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Read records in merge order along with the index of the file each came from
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records and their source files</returns>
+    public async IAsyncEnumerable<DbnMergedRecord> ReadMergedRecordsAsync(
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        uint[] sources = new uint[DefaultBatchSize];
+        await foreach (var batch in ReadBatchesAsync(DefaultBatchSize, sources, cancellationToken))
+        {
+            for (int i = 0; i < batch.Length; i++)
+            {
+                yield return new DbnMergedRecord(batch[i], (int)sources[i]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Read records in batches, fetching many records per native call
+    /// </summary>
+    /// <param name="maxBatchSize">Maximum records per batch</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of record batches in merge order</returns>
+    public async IAsyncEnumerable<IReadOnlyList<Record>> ReadRecordBatchesAsync(
+        int maxBatchSize = DefaultBatchSize,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        await foreach (var batch in ReadBatchesAsync(maxBatchSize, null, cancellationToken))
+        {
+            yield return batch;
+        }
+    }
+
+    private async IAsyncEnumerable<Record[]> ReadBatchesAsync(
+        int maxBatchSize,
+        uint[]? sources,
+        [EnumeratorCancellation] CancellationToken cancellationToken)
+    {
+        ThrowIfDisposed();
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxBatchSize);
+
+        byte[] recordBuffer = new byte[BatchBufferSize];
+        nuint[] offsets = new nuint[maxBatchSize];
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+
+        await Task.Yield(); // Make it properly async
+
+        ulong recordNumber = 0;
+
+        while (true)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            int result = NativeMethods.dbento_dbn_merge_next_records(
+                _handle,
+                recordBuffer,
+                (nuint)recordBuffer.Length,
+                offsets,
+                sources,
+                (nuint)offsets.Length,
+                out nuint recordCount,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result == 1)
+            {
+                // All inputs exhausted
+                yield break;
+            }
+
+            if (result == BufferTooSmallResult && recordBuffer.Length < Utilities.Constants.MaxReasonableRecordSize)
+            {
+                // Next record is larger than the whole buffer; it stays queued natively, so grow and retry
+                recordBuffer = new byte[Math.Min(recordBuffer.Length * 2, Utilities.Constants.MaxReasonableRecordSize)];
+                continue;
+            }
+
+            if (result < 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Error reading merged DBN record #{recordNumber}: {error}");
+            }
+
+            var batch = new Record[(int)recordCount];
+            for (int i = 0; i < batch.Length; i++)
+            {
+                int offset = (int)offsets[i];
+                int length = recordBuffer[offset] * 4;
+                try
+                {
+                    // FromBytes copies the record, so the buffer can be reused for the next batch
+                    batch[i] = Record.FromBytes(recordBuffer.AsSpan(offset, length), recordBuffer[offset + 1]);
+                }
+                catch (Exception ex)
+                {
+                    throw new DbentoException($"Error deserializing merged DBN record #{recordNumber}: {ex.Message}", ex);
+                }
+                recordNumber++;
+            }
+
+            yield return batch;
+        }
+    }
+
+    private void ThrowIfDisposed()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+    }
+
+    /// <summary>
+    /// Dispose the reader and close all input files
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+
+    /// <summary>
+    /// Asynchronously dispose the reader and close all input files
+    /// </summary>
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
@@ -0,0 +1,10 @@
+using Databento.Client.Models;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Record produced by a merge reader together with the file it came from
+/// </summary>
+/// <param name="Record">The record</param>
+/// <param name="FileIndex">Index of the source file in the list given to the reader</param>
+public readonly record struct DbnMergedRecord(Record Record, int FileIndex);
@@ -0,0 +1,17 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Keys that <see cref="DbnSplitter"/> partitions records by
+/// </summary>
+[Flags]
+public enum DbnPartitionBy
+{
+    /// <summary>One output file per instrument ID</summary>
+    Instrument = 1,
+
+    /// <summary>One output file per UTC date of the record's index timestamp</summary>
+    Date = 2,
+
+    /// <summary>One output file per schema</summary>
+    Schema = 4
+}
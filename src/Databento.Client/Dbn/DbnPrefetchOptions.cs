@@ -0,0 +1,19 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Read-ahead settings for a DBN file reader
+/// </summary>
+/// <remarks>
+/// The file is read front to back into <see cref="QueueDepth"/> buffers of
+/// <see cref="BufferSize"/> bytes, so reads for upcoming data are in flight while
+/// records are decoded. On Linux the reads go through io_uring when the kernel
+/// permits it; otherwise a background thread fills the buffers.
+/// </remarks>
+public sealed class DbnPrefetchOptions
+{
+    /// <summary>Bytes per read (0 = 4 MiB, otherwise at least 4096)</summary>
+    public int BufferSize { get; init; }
+
+    /// <summary>Reads kept in flight (0 = 4, at most 256)</summary>
+    public int QueueDepth { get; init; }
+}
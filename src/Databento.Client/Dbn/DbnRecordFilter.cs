@@ -0,0 +1,71 @@
+using System.Text.Json.Nodes;
+using Databento.Client.Models;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Record filter evaluated natively while a DBN file is read
+/// </summary>
+/// <remarks>
+/// All configured conditions must hold. Records whose type lacks a field being tested
+/// (for example a side condition on OHLCV bars) are excluded. OHLCV bars expose their
+/// close price and volume; statistics expose price and quantity.
+/// </remarks>
+public sealed class DbnRecordFilter
+{
+    /// <summary>Keep records with ts_event at or after this time</summary>
+    public DateTimeOffset? StartTime { get; init; }
+
+    /// <summary>Keep records with ts_event before this time</summary>
+    public DateTimeOffset? EndTime { get; init; }
+
+    /// <summary>Keep only these instrument IDs</summary>
+    public IReadOnlyCollection<uint>? InstrumentIds { get; init; }
+
+    /// <summary>Keep only these record types</summary>
+    public IReadOnlyCollection<RType>? RecordTypes { get; init; }
+
+    /// <summary>Minimum price, inclusive</summary>
+    public decimal? MinPrice { get; init; }
+
+    /// <summary>Maximum price, inclusive</summary>
+    public decimal? MaxPrice { get; init; }
+
+    /// <summary>Minimum size (volume for OHLCV, quantity for statistics)</summary>
+    public ulong? MinSize { get; init; }
+
+    /// <summary>Keep only this side</summary>
+    public Side? Side { get; init; }
+
+    /// <summary>Keep only this action</summary>
+    public Models.Action? Action { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON specification understood by the native reader
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject();
+        if (StartTime.HasValue)
+            json["start"] = Utilities.DateTimeHelpers.ToUnixNanos(StartTime.Value);
+        if (EndTime.HasValue)
+            json["end"] = Utilities.DateTimeHelpers.ToUnixNanos(EndTime.Value);
+        if (InstrumentIds != null)
+            json["instrument_ids"] = new JsonArray(InstrumentIds.Select(id => (JsonNode)id).ToArray());
+        if (RecordTypes != null)
+            json["rtypes"] = new JsonArray(RecordTypes.Select(rtype => (JsonNode)(byte)rtype).ToArray());
+        if (MinPrice.HasValue)
+            json["min_price"] = ToFixedPrice(MinPrice.Value);
+        if (MaxPrice.HasValue)
+            json["max_price"] = ToFixedPrice(MaxPrice.Value);
+        if (MinSize.HasValue)
+            json["min_size"] = MinSize.Value;
+        if (Side.HasValue)
+            json["side"] = ((char)Side.Value).ToString();
+        if (Action.HasValue)
+            json["action"] = ((char)Action.Value).ToString();
+        return json.ToJsonString();
+    }
+
+    private static long ToFixedPrice(decimal price) => (long)(price * 1_000_000_000m);
+}
@@ -0,0 +1,61 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// How <see cref="DbnSplitter"/> partitions, buffers and compresses its outputs
+/// </summary>
+public sealed class DbnSplitOptions
+{
+    /// <summary>Partition keys</summary>
+    public DbnPartitionBy PartitionBy { get; init; } = DbnPartitionBy.Instrument | DbnPartitionBy.Date;
+
+    /// <summary>Compress outputs with zstd; false writes plain DBN</summary>
+    public bool Compress { get; init; } = true;
+
+    /// <summary>zstd level, 1 to 22 (null = 3)</summary>
+    public int? CompressionLevel { get; init; }
+
+    /// <summary>Bytes buffered per output before they are compressed as one frame (null = 1 MiB)</summary>
+    public int? ChunkSize { get; init; }
+
+    /// <summary>Memory cap for records waiting to be compressed (null = 256 MiB)</summary>
+    public long? MaxBufferedBytes { get; init; }
+
+    /// <summary>Output files kept open at once (null = 256); others are reopened as needed</summary>
+    public int? MaxOpenFiles { get; init; }
+
+    /// <summary>Compression threads (0 = one per core)</summary>
+    public int Threads { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native splitter
+    /// </summary>
+    internal string ToJson()
+    {
+        var partitionBy = new JsonArray();
+        if (PartitionBy.HasFlag(DbnPartitionBy.Instrument))
+            partitionBy.Add("instrument");
+        if (PartitionBy.HasFlag(DbnPartitionBy.Date))
+            partitionBy.Add("date");
+        if (PartitionBy.HasFlag(DbnPartitionBy.Schema))
+            partitionBy.Add("schema");
+        if (partitionBy.Count == 0)
+            throw new ArgumentException("At least one partition key is required", nameof(PartitionBy));
+
+        var json = new JsonObject
+        {
+            ["partition_by"] = partitionBy,
+            ["compression"] = Compress ? "zstd" : "none"
+        };
+        if (CompressionLevel.HasValue)
+            json["compression_level"] = CompressionLevel.Value;
+        if (ChunkSize.HasValue)
+            json["chunk_size"] = ChunkSize.Value;
+        if (MaxBufferedBytes.HasValue)
+            json["max_buffered_bytes"] = MaxBufferedBytes.Value;
+        if (MaxOpenFiles.HasValue)
+            json["max_open_files"] = MaxOpenFiles.Value;
+        return json.ToJsonString();
+    }
+}
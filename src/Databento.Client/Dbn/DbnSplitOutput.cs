@@ -0,0 +1,20 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// One file written by <see cref="DbnSplitter"/>
+/// </summary>
+/// <param name="InputPath">DBN file the records came from</param>
+/// <param name="Path">Path of the output file</param>
+/// <param name="InstrumentId">Instrument of the records, when splitting by instrument</param>
+/// <param name="Date">UTC date of the records, when splitting by date</param>
+/// <param name="Schema">Schema of the records (for example "mbo"), when splitting by schema</param>
+/// <param name="Records">Records written</param>
+/// <param name="Bytes">Size of the file in bytes</param>
+public sealed record DbnSplitOutput(
+    string InputPath,
+    string Path,
+    uint? InstrumentId,
+    DateOnly? Date,
+    string? Schema,
+    ulong Records,
+    long Bytes);
@@ -0,0 +1,12 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Result of a <see cref="DbnSplitter"/> run
+/// </summary>
+/// <param name="Outputs">Files written, grouped by input file in the order given</param>
+/// <param name="Records">Records read across all inputs</param>
+/// <param name="RecordsSkipped">Control records dropped when splitting by schema</param>
+public sealed record DbnSplitResult(
+    IReadOnlyList<DbnSplitOutput> Outputs,
+    ulong Records,
+    ulong RecordsSkipped);
@@ -0,0 +1,127 @@
+using System.Globalization;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Interop;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Splits DBN files natively into one file per instrument, date and/or schema
+/// </summary>
+/// <remarks>
+/// Each input <c>name.dbn[.zst]</c> is read once and its records are written to
+/// <c>[schema/][instrument_id/][yyyyMMdd/]name.dbn[.zst]</c> under the output directory,
+/// without crossing into managed code. Every output has its own metadata header with
+/// start/end, symbols and mappings narrowed to its records, and is compressed into
+/// independent zstd frames on worker threads.
+/// </remarks>
+public static class DbnSplitter
+{
+    /// <summary>
+    /// Split DBN files into partitions
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="outputDirectory">Existing directory for the outputs</param>
+    /// <param name="options">Partition keys, buffering, compression and parallelism (null = per instrument per day)</param>
+    /// <returns>Files written</returns>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DirectoryNotFoundException">If the output directory does not exist</exception>
+    /// <exception cref="DbentoException">If a file cannot be read or written, or the options are invalid</exception>
+    public static DbnSplitResult Split(
+        IEnumerable<string> filePaths,
+        string outputDirectory,
+        DbnSplitOptions? options = null)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        ArgumentException.ThrowIfNullOrWhiteSpace(outputDirectory);
+        options ??= new DbnSplitOptions();
+        ArgumentOutOfRangeException.ThrowIfNegative(options.Threads);
+
+        string[] paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            throw new ArgumentException("At least one file is required", nameof(filePaths));
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+        if (!Directory.Exists(outputDirectory))
+            throw new DirectoryNotFoundException($"Output directory not found: {outputDirectory}");
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_split(
+            paths,
+            (nuint)paths.Length,
+            outputDirectory,
+            options.ToJson(),
+            options.Threads,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to split DBN files: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            using var document = JsonDocument.Parse(json);
+            return ParseResult(document.RootElement);
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Split DBN files into partitions without blocking the caller
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="outputDirectory">Existing directory for the outputs</param>
+    /// <param name="options">Partition keys, buffering, compression and parallelism (null = per instrument per day)</param>
+    /// <param name="cancellationToken">Cancels before the split starts; a running split completes</param>
+    /// <returns>Files written</returns>
+    public static Task<DbnSplitResult> SplitAsync(
+        IEnumerable<string> filePaths,
+        string outputDirectory,
+        DbnSplitOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => Split(filePaths, outputDirectory, options), cancellationToken);
+    }
+
+    private static DbnSplitResult ParseResult(JsonElement root)
+    {
+        var outputs = new List<DbnSplitOutput>();
+        foreach (var file in root.GetProperty("files").EnumerateArray())
+        {
+            string input = file.GetProperty("input").GetString() ?? string.Empty;
+            foreach (var output in file.GetProperty("outputs").EnumerateArray())
+            {
+                var instrumentId = output.GetProperty("instrument_id");
+                var date = output.GetProperty("date");
+                var schema = output.GetProperty("schema");
+                outputs.Add(new DbnSplitOutput(
+                    input,
+                    output.GetProperty("path").GetString() ?? string.Empty,
+                    instrumentId.ValueKind == JsonValueKind.Null ? null : instrumentId.GetUInt32(),
+                    date.ValueKind == JsonValueKind.Null
+                        ? null
+                        : DateOnly.ParseExact(date.GetString()!, "yyyyMMdd", CultureInfo.InvariantCulture),
+                    schema.ValueKind == JsonValueKind.Null ? null : schema.GetString(),
+                    output.GetProperty("records").GetUInt64(),
+                    output.GetProperty("bytes").GetInt64()));
+            }
+        }
+        return new DbnSplitResult(
+            outputs,
+            root.GetProperty("records").GetUInt64(),
+            root.GetProperty("records_skipped").GetUInt64());
+    }
+}
@@ -0,0 +1,13 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Text format produced by <see cref="DbnTranscoder"/>
+/// </summary>
+public enum DbnTextEncoding
+{
+    /// <summary>Comma-separated values with one column set, from the first record type in the input</summary>
+    Csv = 0,
+
+    /// <summary>One JSON object per line, for every record type</summary>
+    Json = 1
+}
@@ -0,0 +1,40 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// How records are formatted as CSV or JSON text
+/// </summary>
+public sealed class DbnTextOptions
+{
+    /// <summary>Output format</summary>
+    public DbnTextEncoding Encoding { get; init; } = DbnTextEncoding.Csv;
+
+    /// <summary>Write prices as decimals instead of fixed-point integers (1e-9)</summary>
+    public bool PrettyPx { get; init; }
+
+    /// <summary>Write timestamps as ISO 8601 instead of nanoseconds since the UNIX epoch</summary>
+    public bool PrettyTs { get; init; }
+
+    /// <summary>Append each record's symbol, from the file's mappings or the live session's symbol mapping records</summary>
+    public bool MapSymbols { get; init; }
+
+    /// <summary>Write a CSV header row</summary>
+    public bool Header { get; init; } = true;
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native transcoder
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject
+        {
+            ["encoding"] = Encoding == DbnTextEncoding.Json ? "json" : "csv",
+            ["pretty_px"] = PrettyPx,
+            ["pretty_ts"] = PrettyTs,
+            ["map_symbols"] = MapSymbols,
+            ["header"] = Header
+        };
+        return json.ToJsonString();
+    }
+}
@@ -0,0 +1,95 @@
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Read-only stream over the text of a native transcoder
+/// </summary>
+/// <remarks>
+/// Not safe for concurrent reads from multiple threads.
+/// </remarks>
+internal sealed class DbnTextStream : Stream
+{
+    // Native result at the end of the file
+    private const int EndOfFileResult = 1;
+
+    private readonly DbnTranscoderHandle _handle;
+    private long _position;
+    private bool _atEnd;
+
+    public DbnTextStream(DbnTranscoderHandle handle)
+    {
+        _handle = handle;
+    }
+
+    public override bool CanRead => !_handle.IsClosed;
+    public override bool CanSeek => false;
+    public override bool CanWrite => false;
+    public override long Length => throw new NotSupportedException();
+
+    public override long Position
+    {
+        get => _position;
+        set => throw new NotSupportedException();
+    }
+
+    public override int Read(byte[] buffer, int offset, int count)
+    {
+        ValidateBufferArguments(buffer, offset, count);
+        return Read(buffer.AsSpan(offset, count));
+    }
+
+    public override unsafe int Read(Span<byte> buffer)
+    {
+        ObjectDisposedException.ThrowIf(_handle.IsClosed, this);
+        if (buffer.IsEmpty || _atEnd)
+            return 0;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        nuint written;
+        fixed (byte* bytes = buffer)
+        {
+            result = NativeMethods.dbento_dbn_transcoder_read(
+                _handle,
+                bytes,
+                (nuint)buffer.Length,
+                out written,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result == EndOfFileResult)
+        {
+            _atEnd = true;
+            return 0;
+        }
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to transcode DBN file: {error}");
+        }
+
+        _position += (long)written;
+        return (int)written;
+    }
+
+    public override void Flush()
+    {
+    }
+
+    public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+    public override void SetLength(long value) => throw new NotSupportedException();
+
+    public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+    protected override void Dispose(bool disposing)
+    {
+        if (disposing)
+            _handle.Dispose();
+        base.Dispose(disposing);
+    }
+}
@@ -0,0 +1,16 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Result of a <see cref="DbnTranscoder"/> run
+/// </summary>
+/// <param name="Records">Records read</param>
+/// <param name="RecordsWritten">Records written as lines</param>
+/// <param name="RecordsSkipped">Records without a text layout, or of another type than the CSV columns</param>
+/// <param name="Bytes">Size of the output file</param>
+/// <param name="Parallel">Whether the file was formatted on several threads</param>
+public sealed record DbnTranscodeResult(
+    ulong Records,
+    ulong RecordsWritten,
+    ulong RecordsSkipped,
+    long Bytes,
+    bool Parallel);
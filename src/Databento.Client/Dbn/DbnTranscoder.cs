@@ -0,0 +1,129 @@
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Converts DBN files natively to CSV or JSON lines
+/// </summary>
+/// <remarks>
+/// Records are upgraded to the current DBN version and formatted without crossing into
+/// managed code. CSV output has the columns of the first record type in the file; other
+/// record types are skipped. JSON output nests header fields under <c>hd</c> and quotes
+/// 64-bit integers so they survive parsers that read numbers as doubles.
+/// </remarks>
+public static class DbnTranscoder
+{
+    /// <summary>
+    /// Transcode a DBN file to a text file
+    /// </summary>
+    /// <param name="inputPath">Path to the DBN file (plain or zstd-compressed)</param>
+    /// <param name="outputPath">Path to the text file (replaced only once the transcode succeeds)</param>
+    /// <param name="options">Encoding and formatting (null = CSV with raw prices and timestamps)</param>
+    /// <param name="threads">
+    /// Worker threads (0 = one per core, 1 = sequential). Indexed files are formatted in
+    /// blocks on several threads and written in file order.
+    /// </param>
+    /// <returns>Record counts and output size</returns>
+    /// <exception cref="FileNotFoundException">If the input file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be read or written</exception>
+    public static DbnTranscodeResult TranscodeFile(
+        string inputPath,
+        string outputPath,
+        DbnTextOptions? options = null,
+        int threads = 0)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(inputPath);
+        ArgumentException.ThrowIfNullOrWhiteSpace(outputPath);
+        ArgumentOutOfRangeException.ThrowIfNegative(threads);
+        if (!File.Exists(inputPath))
+            throw new FileNotFoundException($"DBN file not found: {inputPath}", inputPath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_transcode(
+            inputPath,
+            outputPath,
+            (options ?? new DbnTextOptions()).ToJson(),
+            threads,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to transcode DBN file: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            using var document = JsonDocument.Parse(json);
+            var root = document.RootElement;
+            return new DbnTranscodeResult(
+                root.GetProperty("records").GetUInt64(),
+                root.GetProperty("records_written").GetUInt64(),
+                root.GetProperty("records_skipped").GetUInt64(),
+                root.GetProperty("bytes").GetInt64(),
+                root.GetProperty("parallel").GetBoolean());
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Transcode a DBN file to a text file without blocking the caller
+    /// </summary>
+    /// <param name="inputPath">Path to the DBN file (plain or zstd-compressed)</param>
+    /// <param name="outputPath">Path to the text file (replaced only once the transcode succeeds)</param>
+    /// <param name="options">Encoding and formatting (null = CSV with raw prices and timestamps)</param>
+    /// <param name="threads">Worker threads (0 = one per core, 1 = sequential)</param>
+    /// <param name="cancellationToken">Cancels before the transcode starts; a running transcode completes</param>
+    /// <returns>Record counts and output size</returns>
+    public static Task<DbnTranscodeResult> TranscodeFileAsync(
+        string inputPath,
+        string outputPath,
+        DbnTextOptions? options = null,
+        int threads = 0,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => TranscodeFile(inputPath, outputPath, options, threads), cancellationToken);
+    }
+
+    /// <summary>
+    /// Open a DBN file as a read-only stream of UTF-8 text
+    /// </summary>
+    /// <remarks>
+    /// Text is formatted as the stream is read, so the whole output is never held in memory.
+    /// </remarks>
+    /// <param name="inputPath">Path to the DBN file (plain or zstd-compressed)</param>
+    /// <param name="options">Encoding and formatting (null = CSV with raw prices and timestamps)</param>
+    /// <returns>Stream of the file's text</returns>
+    /// <exception cref="FileNotFoundException">If the input file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened</exception>
+    public static Stream OpenRead(string inputPath, DbnTextOptions? options = null)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(inputPath);
+        if (!File.Exists(inputPath))
+            throw new FileNotFoundException($"DBN file not found: {inputPath}", inputPath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_transcoder_open(
+            inputPath,
+            (options ?? new DbnTextOptions()).ToJson(),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open DBN file for transcoding: {error}");
+        }
+
+        return new DbnTextStream(new DbnTranscoderHandle(handlePtr));
+    }
+}
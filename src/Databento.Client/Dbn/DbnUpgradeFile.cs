@@ -0,0 +1,22 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// One file processed by <see cref="DbnUpgrader"/>
+/// </summary>
+/// <param name="InputPath">File that was read</param>
+/// <param name="OutputPath">File that was written (the input, when skipped)</param>
+/// <param name="Status">Whether the file was upgraded, skipped or failed</param>
+/// <param name="FromVersion">DBN version of the input</param>
+/// <param name="Records">Records written</param>
+/// <param name="Bytes">Size of the output in bytes</param>
+/// <param name="Indexed">Whether an index was written for the output</param>
+/// <param name="Error">Why the file failed</param>
+public sealed record DbnUpgradeFile(
+    string InputPath,
+    string OutputPath,
+    DbnUpgradeStatus Status,
+    int FromVersion,
+    ulong Records,
+    long Bytes,
+    bool Indexed,
+    string? Error);
@@ -0,0 +1,48 @@
+using System.Text.Json.Nodes;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Where and how <see cref="DbnUpgrader"/> writes upgraded files
+/// </summary>
+public sealed class DbnUpgradeOptions
+{
+    /// <summary>Existing directory for the outputs (null = replace the inputs in place)</summary>
+    public string? OutputDirectory { get; init; }
+
+    /// <summary>Compress outputs with zstd (null = keep each input's compression)</summary>
+    public bool? Compress { get; init; }
+
+    /// <summary>zstd level, 1 to 22 (null = 3)</summary>
+    public int? CompressionLevel { get; init; }
+
+    /// <summary>Uncompressed bytes per independent zstd frame (null = 4 MiB)</summary>
+    public int? FrameSize { get; init; }
+
+    /// <summary>Build an index for every output (null = only where the input had one)</summary>
+    public bool? BuildIndex { get; init; }
+
+    /// <summary>Re-encode files that are already at the current DBN version</summary>
+    public bool Force { get; init; }
+
+    /// <summary>Worker threads (0 = one per core)</summary>
+    public int Threads { get; init; }
+
+    /// <summary>
+    /// Serialize to the JSON options understood by the native upgrader
+    /// </summary>
+    internal string ToJson()
+    {
+        var json = new JsonObject
+        {
+            ["compression"] = Compress switch { null => "keep", true => "zstd", false => "none" },
+            ["index"] = BuildIndex switch { null => "auto", true => "always", false => "never" },
+            ["force"] = Force
+        };
+        if (CompressionLevel.HasValue)
+            json["compression_level"] = CompressionLevel.Value;
+        if (FrameSize.HasValue)
+            json["frame_size"] = FrameSize.Value;
+        return json.ToJsonString();
+    }
+}
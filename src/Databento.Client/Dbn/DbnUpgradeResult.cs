@@ -0,0 +1,16 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Result of a <see cref="DbnUpgrader"/> run
+/// </summary>
+/// <param name="Files">Files in the order given</param>
+/// <param name="Upgraded">Files re-encoded</param>
+/// <param name="Skipped">Files already at the current DBN version</param>
+/// <param name="Failed">Files that could not be upgraded</param>
+/// <param name="Records">Records written across all files</param>
+public sealed record DbnUpgradeResult(
+    IReadOnlyList<DbnUpgradeFile> Files,
+    int Upgraded,
+    int Skipped,
+    int Failed,
+    ulong Records);
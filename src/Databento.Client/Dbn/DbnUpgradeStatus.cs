@@ -0,0 +1,16 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Outcome of upgrading one file with <see cref="DbnUpgrader"/>
+/// </summary>
+public enum DbnUpgradeStatus
+{
+    /// <summary>The file was re-encoded at the current DBN version</summary>
+    Upgraded = 0,
+
+    /// <summary>The file was already at the current DBN version and left as is</summary>
+    Skipped = 1,
+
+    /// <summary>The file could not be upgraded and was left untouched</summary>
+    Failed = 2
+}
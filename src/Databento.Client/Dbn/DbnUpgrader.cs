@@ -0,0 +1,162 @@
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Interop;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Re-encodes DBN v1 and v2 files natively at the current DBN version
+/// </summary>
+/// <remarks>
+/// Upgraded files no longer go through the version upgrade when they are read. Files are
+/// converted in parallel, one file per worker, and compressed outputs are written as
+/// independent zstd frames. Every output is verified against its input's record count
+/// before it is renamed into place; a file that fails is left untouched and reported.
+/// </remarks>
+public static class DbnUpgrader
+{
+    /// <summary>
+    /// Upgrade DBN files
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="options">Output location, compression, indexing and parallelism (null = in place, same compression)</param>
+    /// <returns>Outcome per file</returns>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DirectoryNotFoundException">If the output directory does not exist</exception>
+    /// <exception cref="DbentoException">If two inputs map to the same output, or the options are invalid</exception>
+    public static DbnUpgradeResult Upgrade(IEnumerable<string> filePaths, DbnUpgradeOptions? options = null)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        options ??= new DbnUpgradeOptions();
+        ArgumentOutOfRangeException.ThrowIfNegative(options.Threads);
+
+        string[] paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            return new DbnUpgradeResult(Array.Empty<DbnUpgradeFile>(), 0, 0, 0, 0);
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+        if (options.OutputDirectory != null && !Directory.Exists(options.OutputDirectory))
+            throw new DirectoryNotFoundException($"Output directory not found: {options.OutputDirectory}");
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_upgrade(
+            paths,
+            (nuint)paths.Length,
+            options.OutputDirectory,
+            options.ToJson(),
+            options.Threads,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to upgrade DBN files: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            using var document = JsonDocument.Parse(json);
+            return ParseResult(document.RootElement);
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Upgrade every DBN file (<c>*.dbn</c> and <c>*.dbn.zst</c>) in a directory
+    /// </summary>
+    /// <param name="directory">Directory to search</param>
+    /// <param name="options">Output location, compression, indexing and parallelism (null = in place, same compression)</param>
+    /// <param name="recursive">Include subdirectories</param>
+    /// <returns>Outcome per file</returns>
+    /// <exception cref="DirectoryNotFoundException">If the directory does not exist</exception>
+    public static DbnUpgradeResult UpgradeDirectory(
+        string directory,
+        DbnUpgradeOptions? options = null,
+        bool recursive = true)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(directory);
+        if (!Directory.Exists(directory))
+            throw new DirectoryNotFoundException($"Directory not found: {directory}");
+
+        var search = recursive ? SearchOption.AllDirectories : SearchOption.TopDirectoryOnly;
+        var files = Directory.EnumerateFiles(directory, "*.dbn", search)
+            .Concat(Directory.EnumerateFiles(directory, "*.dbn.zst", search))
+            .Where(path => !path.EndsWith(".tmp", StringComparison.Ordinal))
+            .OrderBy(path => path, StringComparer.Ordinal);
+        return Upgrade(files, options);
+    }
+
+    /// <summary>
+    /// Upgrade DBN files without blocking the caller
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="options">Output location, compression, indexing and parallelism (null = in place, same compression)</param>
+    /// <param name="cancellationToken">Cancels before the upgrade starts; a running upgrade completes</param>
+    /// <returns>Outcome per file</returns>
+    public static Task<DbnUpgradeResult> UpgradeAsync(
+        IEnumerable<string> filePaths,
+        DbnUpgradeOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => Upgrade(filePaths, options), cancellationToken);
+    }
+
+    /// <summary>
+    /// Upgrade every DBN file in a directory without blocking the caller
+    /// </summary>
+    /// <param name="directory">Directory to search</param>
+    /// <param name="options">Output location, compression, indexing and parallelism (null = in place, same compression)</param>
+    /// <param name="recursive">Include subdirectories</param>
+    /// <param name="cancellationToken">Cancels before the upgrade starts; a running upgrade completes</param>
+    /// <returns>Outcome per file</returns>
+    public static Task<DbnUpgradeResult> UpgradeDirectoryAsync(
+        string directory,
+        DbnUpgradeOptions? options = null,
+        bool recursive = true,
+        CancellationToken cancellationToken = default)
+    {
+        return Task.Run(() => UpgradeDirectory(directory, options, recursive), cancellationToken);
+    }
+
+    private static DbnUpgradeResult ParseResult(JsonElement root)
+    {
+        var files = new List<DbnUpgradeFile>();
+        foreach (var file in root.GetProperty("files").EnumerateArray())
+        {
+            string input = file.GetProperty("input").GetString() ?? string.Empty;
+            var output = file.GetProperty("output");
+            var error = file.GetProperty("error");
+            files.Add(new DbnUpgradeFile(
+                input,
+                output.ValueKind == JsonValueKind.Null ? input : output.GetString() ?? input,
+                file.GetProperty("status").GetString() switch
+                {
+                    "upgraded" => DbnUpgradeStatus.Upgraded,
+                    "skipped" => DbnUpgradeStatus.Skipped,
+                    _ => DbnUpgradeStatus.Failed
+                },
+                file.GetProperty("from_version").GetInt32(),
+                file.GetProperty("records").GetUInt64(),
+                file.GetProperty("bytes").GetInt64(),
+                file.GetProperty("indexed").GetBoolean(),
+                error.ValueKind == JsonValueKind.Null ? null : error.GetString()));
+        }
+        return new DbnUpgradeResult(
+            files,
+            root.GetProperty("upgraded").GetInt32(),
+            root.GetProperty("skipped").GetInt32(),
+            root.GetProperty("failed").GetInt32(),
+            root.GetProperty("records").GetUInt64());
+    }
+}
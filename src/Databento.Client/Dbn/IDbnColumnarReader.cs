@@ -0,0 +1,58 @@
+using Databento.Client.Models.Dbn;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Reader for columnar files written by <see cref="DbnColumnarExporter"/>
+/// </summary>
+public interface IDbnColumnarReader : IDisposable, IAsyncDisposable
+{
+    /// <summary>
+    /// Schema of the rows (for example "mbo" or "ohlcv-1m")
+    /// </summary>
+    string Schema { get; }
+
+    /// <summary>
+    /// Total rows in the file
+    /// </summary>
+    ulong RowCount { get; }
+
+    /// <summary>
+    /// Columns in file order
+    /// </summary>
+    IReadOnlyList<DbnColumnInfo> Columns { get; }
+
+    /// <summary>
+    /// Row groups with per-column statistics
+    /// </summary>
+    IReadOnlyList<DbnColumnarRowGroup> RowGroups { get; }
+
+    /// <summary>
+    /// Metadata of the DBN file the rows were exported from
+    /// </summary>
+    DbnMetadata Metadata { get; }
+
+    /// <summary>
+    /// Index of a column by name
+    /// </summary>
+    /// <param name="name">Column name</param>
+    /// <returns>Column index, or -1 if there is no such column</returns>
+    int GetColumnIndex(string name);
+
+    /// <summary>
+    /// Decode one column of one row group
+    /// </summary>
+    /// <typeparam name="T">Value type; must be as wide as the column (for example long for prices)</typeparam>
+    /// <param name="rowGroup">Row group index</param>
+    /// <param name="column">Column index</param>
+    /// <returns>One value per row</returns>
+    T[] ReadColumn<T>(int rowGroup, int column) where T : unmanaged;
+
+    /// <summary>
+    /// Decode one column across all row groups
+    /// </summary>
+    /// <typeparam name="T">Value type; must be as wide as the column (for example long for prices)</typeparam>
+    /// <param name="column">Column name</param>
+    /// <returns>One value per row in the file</returns>
+    T[] ReadColumn<T>(string column) where T : unmanaged;
+}
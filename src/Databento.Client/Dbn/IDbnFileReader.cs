@@ -23,4 +23,37 @@ public interface IDbnFileReader : IDisposable, IAsyncDisposable
     /// <param name="cancellationToken">Cancellation token</param>
     /// <returns>Async enumerable of records</returns>
     IAsyncEnumerable<Record> ReadRecordsAsync(CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Read records in batches, fetching many records per native call
+    /// </summary>
+    /// <param name="maxBatchSize">Maximum records per batch</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of record batches in file order</returns>
+    IAsyncEnumerable<IReadOnlyList<Record>> ReadRecordBatchesAsync(
+        int maxBatchSize = 4096,
+        CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Records scanned and passed by the filter given at open (zero without a filter)
+    /// </summary>
+    DbnFilterStats FilterStats { get; }
+
+    /// <summary>
+    /// How this reader gets bytes from disk
+    /// </summary>
+    DbnIoBackend IoBackend { get; }
+
+    /// <summary>
+    /// Position the reader at the first record with ts_event at or after a timestamp
+    /// </summary>
+    /// <param name="timestamp">Target event time</param>
+    /// <returns>False if no record is at or after the timestamp</returns>
+    bool SeekToTime(DateTimeOffset timestamp);
+
+    /// <summary>
+    /// Restrict reading to the given instruments and restart from the beginning of the file
+    /// </summary>
+    /// <param name="instrumentIds">Instrument IDs to keep (empty = all instruments)</param>
+    void SelectInstruments(IEnumerable<uint> instrumentIds);
 }
@@ -23,8 +23,20 @@ public interface IDbnFileWriter : IDisposable, IAsyncDisposable
     /// <param name="records">Records to write</param>
     void WriteRecords(IEnumerable<Record> records);
 
+    /// <summary>
+    /// Write records stored back to back in DBN format, without copying them
+    /// </summary>
+    /// <param name="records">Records, each as long as the length in its header</param>
+    /// <param name="count">Number of records in the buffer</param>
+    void WriteRecords(ReadOnlySpan<byte> records, int count);
+
     /// <summary>
     /// Flush any buffered data to disk
     /// </summary>
     void Flush();
+
+    /// <summary>
+    /// Wait until every record written so far is on stable storage
+    /// </summary>
+    void Sync();
 }
@@ -0,0 +1,56 @@
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Zero-copy reader for uncompressed DBN files backed by a memory mapping
+/// </summary>
+/// <remarks>
+/// Spans returned by this reader point directly into the mapping and must not be used after Dispose.
+/// </remarks>
+public interface IDbnMappedFileReader : IDisposable
+{
+    /// <summary>
+    /// Get metadata about the DBN file
+    /// </summary>
+    /// <returns>DBN file metadata</returns>
+    DbnMetadata GetMetadata();
+
+    /// <summary>
+    /// Read position as a byte offset into the record section
+    /// </summary>
+    /// <remarks>Only offsets previously read from this property are valid to assign</remarks>
+    long Position { get; set; }
+
+    /// <summary>
+    /// Borrow the next record without copying
+    /// </summary>
+    /// <param name="record">Raw record bytes inside the mapping</param>
+    /// <param name="recordType">Record type identifier</param>
+    /// <returns>False at end of file</returns>
+    bool TryReadNext(out ReadOnlySpan<byte> record, out byte recordType);
+
+    /// <summary>
+    /// Borrow a contiguous run of whole records without copying
+    /// </summary>
+    /// <param name="maxBytes">Maximum length of the run in bytes</param>
+    /// <param name="maxRecords">Maximum number of records in the run</param>
+    /// <param name="recordCount">Number of records in the returned run</param>
+    /// <returns>Packed records (each begins with its header); empty at end of file</returns>
+    ReadOnlySpan<byte> BorrowRecords(int maxBytes, int maxRecords, out int recordCount);
+
+    /// <summary>
+    /// Read all remaining records, materializing each one
+    /// </summary>
+    /// <returns>Enumerable of records</returns>
+    IEnumerable<Record> ReadRecords();
+
+    /// <summary>
+    /// Advise the operating system about the access pattern for part of the record section
+    /// </summary>
+    /// <param name="pattern">Expected access pattern</param>
+    /// <param name="offset">Offset in bytes from the first record</param>
+    /// <param name="length">Length in bytes, or -1 for the rest of the file</param>
+    void Advise(DbnAccessPattern pattern, long offset = 0, long length = -1);
+}
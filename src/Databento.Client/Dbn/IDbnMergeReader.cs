@@ -0,0 +1,46 @@
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Reader that merges several DBN files into one timestamp-ordered stream
+/// </summary>
+public interface IDbnMergeReader : IDisposable, IAsyncDisposable
+{
+    /// <summary>
+    /// Number of input files
+    /// </summary>
+    int FileCount { get; }
+
+    /// <summary>
+    /// Get metadata of one input file
+    /// </summary>
+    /// <param name="fileIndex">Index of the file in the list given to the reader</param>
+    /// <returns>DBN file metadata</returns>
+    DbnMetadata GetMetadata(int fileIndex);
+
+    /// <summary>
+    /// Read all records in merge order as an async stream
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records</returns>
+    IAsyncEnumerable<Record> ReadRecordsAsync(CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Read records in merge order along with the index of the file each came from
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records and their source files</returns>
+    IAsyncEnumerable<DbnMergedRecord> ReadMergedRecordsAsync(CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Read records in batches, fetching many records per native call
+    /// </summary>
+    /// <param name="maxBatchSize">Maximum records per batch</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of record batches in merge order</returns>
+    IAsyncEnumerable<IReadOnlyList<Record>> ReadRecordBatchesAsync(
+        int maxBatchSize = 4096,
+        CancellationToken cancellationToken = default);
+}
@@ -34,6 +34,10 @@ public sealed class HistoricalClient : IHistoricalClient
     // CRITICAL FIX: Store active callbacks to prevent GC collection
     private readonly System.Collections.Concurrent.ConcurrentDictionary<Guid, RecordCallbackDelegate> _activeCallbacks = new();
 
+    // Connection pool defaults (connections beyond the first are opened on demand)
+    internal const int DefaultPoolSize = 4;
+    internal static readonly TimeSpan DefaultIdleTimeout = TimeSpan.FromSeconds(60);
+
     // JSON serialization options for enum deserialization
     private static readonly JsonSerializerOptions JsonOptions = new()
     {
@@ -53,7 +57,10 @@ public sealed class HistoricalClient : IHistoricalClient
         VersionUpgradePolicy upgradePolicy,
         string? userAgent,
         TimeSpan timeout,
-        ILogger<IHistoricalClient>? logger = null)
+        ILogger<IHistoricalClient>? logger = null,
+        int poolSize = DefaultPoolSize,
+        TimeSpan? idleTimeout = null,
+        int prewarmConnections = 0)
     {
         if (string.IsNullOrEmpty(apiKey))
             throw new ArgumentException("API key cannot be null or empty", nameof(apiKey));
@@ -67,7 +74,14 @@ public sealed class HistoricalClient : IHistoricalClient
         _logger = logger;
 
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
-        var handlePtr = NativeMethods.dbento_historical_create(apiKey, errorBuffer, (nuint)errorBuffer.Length);
+        // Native handle is safe for concurrent calls; each call leases one pooled connection
+        var handlePtr = NativeMethods.dbento_historical_create_pooled(
+            apiKey,
+            (nuint)poolSize,
+            (long)(idleTimeout ?? DefaultIdleTimeout).TotalMilliseconds,
+            (nuint)prewarmConnections,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
 
         if (handlePtr == IntPtr.Zero)
         {
@@ -80,10 +94,11 @@ public sealed class HistoricalClient : IHistoricalClient
         _handle = new HistoricalClientHandle(handlePtr);
 
         _logger?.LogInformation(
-            "HistoricalClient created successfully. Gateway={Gateway}, UpgradePolicy={UpgradePolicy}, Timeout={Timeout}s",
+            "HistoricalClient created successfully. Gateway={Gateway}, UpgradePolicy={UpgradePolicy}, Timeout={Timeout}s, PoolSize={PoolSize}",
             gateway,
             upgradePolicy,
-            (int)timeout.TotalSeconds);
+            (int)timeout.TotalSeconds,
+            poolSize);
 
         // Note: Gateway, upgrade policy, and other settings are stored for future use
         // when native layer supports configuration. For now, defaults are used.
@@ -1,3 +1,4 @@
+using Databento.Client.Dbn;
 using Databento.Client.Events;
 using Databento.Client.Models;
 
@@ -66,6 +67,13 @@ public interface ILiveClient : IAsyncDisposable
     /// <param name="cancellationToken">Cancellation token</param>
     Task ResubscribeAsync(CancellationToken cancellationToken = default);
 
+    /// <summary>
+    /// Write received records to a CSV or JSON lines file, formatted natively on the receive thread
+    /// </summary>
+    /// <param name="outputPath">File to write (overwritten), or null to stop writing</param>
+    /// <param name="options">Encoding and formatting (null = CSV with raw prices and timestamps)</param>
+    void SetTextOutput(string? outputPath, DbnTextOptions? options = null);
+
     /// <summary>
     /// Stream records as an async enumerable
     /// </summary>
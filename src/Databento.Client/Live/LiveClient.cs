@@ -2,6 +2,7 @@ using System.Buffers;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Threading.Channels;
+using Databento.Client.Dbn;
 using Databento.Client.Events;
 using Databento.Client.Models;
 using Databento.Interop;
@@ -376,6 +377,30 @@ public sealed class LiveClient : ILiveClient
         await Task.CompletedTask;
     }
 
+    /// <summary>
+    /// Write received records to a CSV or JSON lines file, formatted natively on the receive thread
+    /// </summary>
+    /// <param name="outputPath">File to write (overwritten), or null to stop writing</param>
+    /// <param name="options">Encoding and formatting (null = CSV with raw prices and timestamps)</param>
+    public void SetTextOutput(string? outputPath, DbnTextOptions? options = null)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var result = NativeMethods.dbento_live_set_text_output(
+            _handle,
+            string.IsNullOrEmpty(outputPath) ? null : outputPath,
+            (options ?? new DbnTextOptions()).ToJson(),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to set text output: {error}");
+        }
+    }
+
     /// <summary>
     /// Stream records as an async enumerable
     /// </summary>
@@ -55,9 +55,73 @@ public interface IPitSymbolMap : IDisposable
     /// <param name="record">Record containing symbol mapping information</param>
     void OnRecord(Record record);
 
+    /// <summary>
+    /// Update symbol map from a batch of raw DBN records laid out back to back (for live data)
+    /// </summary>
+    /// <param name="records">Raw record bytes; only symbol mappings and instrument definitions update the map</param>
+    /// <returns>Number of records that updated the map</returns>
+    int OnRecords(ReadOnlySpan<byte> records);
+
     /// <summary>
     /// Update symbol map from a SymbolMappingMessage (type-safe version)
     /// </summary>
     /// <param name="symbolMapping">Symbol mapping message to update the map from</param>
     void OnSymbolMapping(SymbolMappingMessage symbolMapping);
+
+    /// <summary>
+    /// Find the interned symbol ID for an instrument
+    /// </summary>
+    /// <param name="instrumentId">The instrument ID</param>
+    /// <returns>Symbol ID, stable for the life of the map, or -1 if not found</returns>
+    int FindSymbolId(uint instrumentId);
+
+    /// <summary>
+    /// Find the instrument ID currently mapped to a symbol
+    /// </summary>
+    /// <param name="symbol">The symbol</param>
+    /// <returns>Instrument ID if found, null otherwise</returns>
+    uint? FindInstrumentId(string symbol);
+
+    /// <summary>
+    /// Find instrument IDs for many symbols in one native call
+    /// </summary>
+    /// <param name="symbols">Symbols to look up</param>
+    /// <param name="instrumentIds">Receives an instrument ID per symbol, or -1 if not found</param>
+    /// <returns>Number of symbols found</returns>
+    int FindInstrumentIds(string[] symbols, Span<long> instrumentIds);
+
+    /// <summary>
+    /// Find interned symbol IDs for many instrument IDs in one native call
+    /// </summary>
+    /// <param name="instrumentIds">Instrument IDs to look up</param>
+    /// <param name="symbolIds">Receives a symbol ID per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    int FindSymbolIds(ReadOnlySpan<uint> instrumentIds, Span<int> symbolIds);
+
+    /// <summary>
+    /// Find symbols for many instrument IDs in one native call
+    /// </summary>
+    /// <param name="instrumentIds">Instrument IDs to look up</param>
+    /// <returns>Symbol per entry, or null where not found</returns>
+    string?[] FindMany(ReadOnlySpan<uint> instrumentIds);
+
+    /// <summary>
+    /// Symbol for an ID returned by <see cref="FindSymbolId"/> or <see cref="FindSymbolIds"/>
+    /// </summary>
+    /// <param name="symbolId">Symbol ID</param>
+    /// <returns>The symbol, or null if it has been evicted</returns>
+    string? GetSymbol(int symbolId);
+
+    /// <summary>
+    /// Remove instruments whose mapping has expired
+    /// </summary>
+    /// <param name="now">Current time</param>
+    /// <returns>Number of instruments removed</returns>
+    int EvictExpired(DateTimeOffset now);
+
+    /// <summary>
+    /// Write a binary snapshot of this map that PitSymbolMap.Load can open
+    /// </summary>
+    /// <param name="filePath">Path of the snapshot file</param>
+    void Save(string filePath);
 }
@@ -33,6 +33,14 @@ public interface ITsSymbolMap : IDisposable
     /// <exception cref="KeyNotFoundException">If mapping not found</exception>
     string At(DateOnly date, uint instrumentId);
 
+    /// <summary>
+    /// Find symbol for an instrument ID at an event timestamp (UTC date)
+    /// </summary>
+    /// <param name="timestampNs">Event timestamp in nanoseconds since the UNIX epoch</param>
+    /// <param name="instrumentId">The instrument ID</param>
+    /// <returns>Symbol string if found, null otherwise</returns>
+    string? Find(long timestampNs, uint instrumentId);
+
     /// <summary>
     /// Find symbol for a record (convenience method that extracts date and instrument ID)
     /// </summary>
@@ -47,4 +55,49 @@ public interface ITsSymbolMap : IDisposable
     /// <returns>Symbol string</returns>
     /// <exception cref="KeyNotFoundException">If mapping not found</exception>
     string At(Models.Record record);
+
+    /// <summary>
+    /// Find the instrument ID mapped to a symbol on a specific date
+    /// </summary>
+    /// <param name="date">The date</param>
+    /// <param name="symbol">The symbol</param>
+    /// <returns>Instrument ID if found, null otherwise</returns>
+    uint? FindInstrumentId(DateOnly date, string symbol);
+
+    /// <summary>
+    /// Find instrument IDs for many (timestamp, symbol) pairs in one native call
+    /// </summary>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="symbols">Symbols, one per timestamp</param>
+    /// <param name="instrumentIds">Receives an instrument ID per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    int FindInstrumentIds(ReadOnlySpan<long> timestampsNs, string[] symbols, Span<long> instrumentIds);
+
+    /// <summary>
+    /// Find symbols for many (timestamp, instrument ID) pairs in one native call
+    /// </summary>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="instrumentIds">Instrument IDs, one per timestamp</param>
+    /// <param name="symbolIndices">Receives an index into <see cref="GetSymbolTable"/> per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    int FindIndices(ReadOnlySpan<long> timestampsNs, ReadOnlySpan<uint> instrumentIds, Span<int> symbolIndices);
+
+    /// <summary>
+    /// Find symbols for many (timestamp, instrument ID) pairs in one native call
+    /// </summary>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="instrumentIds">Instrument IDs, one per timestamp</param>
+    /// <returns>Symbol per entry, or null where not found</returns>
+    string?[] FindMany(ReadOnlySpan<long> timestampsNs, ReadOnlySpan<uint> instrumentIds);
+
+    /// <summary>
+    /// Symbols referenced by the indices <see cref="FindIndices"/> returns
+    /// </summary>
+    IReadOnlyList<string> GetSymbolTable();
+
+    /// <summary>
+    /// Write a binary snapshot of this map that TsSymbolMap.Load can open
+    /// </summary>
+    /// <param name="filePath">Path of the snapshot file</param>
+    void Save(string filePath);
 }
@@ -18,6 +18,7 @@ namespace Databento.Client.Metadata;
 public sealed class PitSymbolMap : IPitSymbolMap
 {
     private readonly PitSymbolMapHandle _handle;
+    private readonly SymbolIdCache _symbolCache = new();
     private bool _disposed;
 
     internal PitSymbolMap(PitSymbolMapHandle handle)
@@ -25,6 +26,57 @@ public sealed class PitSymbolMap : IPitSymbolMap
         _handle = handle ?? throw new ArgumentNullException(nameof(handle));
     }
 
+    /// <summary>
+    /// Create a symbol map from a snapshot, e.g. one saved at the end of the previous session
+    /// </summary>
+    /// <param name="filePath">Path of a snapshot written by <see cref="Save"/></param>
+    /// <remarks>
+    /// The map is filled from the snapshot in one pass and keeps accepting live updates.
+    /// </remarks>
+    /// <exception cref="DbentoException">If the file is missing or not a valid snapshot</exception>
+    public static PitSymbolMap Load(string filePath)
+    {
+        ArgumentException.ThrowIfNullOrEmpty(filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_pit_symbol_map_load(
+            filePath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to load symbol map snapshot: {error}");
+        }
+
+        return new PitSymbolMap(new PitSymbolMapHandle(handlePtr));
+    }
+
+    /// <summary>
+    /// Write a binary snapshot of this map, including when each mapping expires
+    /// </summary>
+    /// <param name="filePath">Path of the snapshot file; replaced atomically if it exists</param>
+    /// <exception cref="DbentoException">If the snapshot cannot be written</exception>
+    public void Save(string filePath)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentException.ThrowIfNullOrEmpty(filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_pit_symbol_map_save(
+            _handle,
+            filePath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to save symbol map snapshot: {error}");
+        }
+    }
+
     /// <summary>
     /// Whether the symbol map is empty
     /// </summary>
@@ -58,23 +110,9 @@ public sealed class PitSymbolMap : IPitSymbolMap
     /// </summary>
     public string? Find(uint instrumentId)
     {
-        ObjectDisposedException.ThrowIf(_disposed, this);
-
-        byte[] symbolBuffer = new byte[Models.Constants.SymbolCstrLen];
-
-        int result = NativeMethods.dbento_pit_symbol_map_find(
-            _handle,
-            instrumentId,
-            symbolBuffer,
-            (nuint)symbolBuffer.Length);
-
-        if (result != 0)
-        {
-            return null; // Not found or error
-        }
-
-        string symbol = System.Text.Encoding.UTF8.GetString(symbolBuffer).TrimEnd('\0');
-        return string.IsNullOrEmpty(symbol) ? null : symbol;
+        // The string for each symbol ID is copied from native memory only once
+        int symbolId = FindSymbolId(instrumentId);
+        return symbolId < 0 ? null : GetSymbol(symbolId);
     }
 
     /// <summary>
@@ -109,6 +147,159 @@ public sealed class PitSymbolMap : IPitSymbolMap
         return At(record.InstrumentId);
     }
 
+    /// <summary>
+    /// Find the interned symbol ID for an instrument
+    /// </summary>
+    /// <remarks>
+    /// Symbol IDs are stable: an ID always names the same symbol, and instruments sharing
+    /// a symbol share its ID, so IDs can be compared instead of strings.
+    /// </remarks>
+    /// <returns>Symbol ID, or -1 if the instrument is not mapped</returns>
+    public int FindSymbolId(uint instrumentId)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        int result = NativeMethods.dbento_pit_symbol_map_find_id(_handle, instrumentId, out uint symbolId);
+        return result == 0 ? (int)symbolId : -1;
+    }
+
+    /// <summary>
+    /// Find the instrument ID currently mapped to a symbol
+    /// </summary>
+    /// <param name="symbol">The symbol</param>
+    /// <returns>Instrument ID if found (the most recently mapped one if several share the symbol), null otherwise</returns>
+    public uint? FindInstrumentId(string symbol)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentNullException.ThrowIfNull(symbol);
+
+        int result = NativeMethods.dbento_pit_symbol_map_find_instrument_id(_handle, symbol, out uint instrumentId);
+        return result == 0 ? instrumentId : null;
+    }
+
+    /// <summary>
+    /// Find instrument IDs for many symbols in one native call
+    /// </summary>
+    /// <param name="symbols">Symbols to look up</param>
+    /// <param name="instrumentIds">Receives an instrument ID per symbol, or -1 if not found</param>
+    /// <returns>Number of symbols found</returns>
+    public unsafe int FindInstrumentIds(string[] symbols, Span<long> instrumentIds)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentNullException.ThrowIfNull(symbols);
+        if (instrumentIds.Length < symbols.Length)
+            throw new ArgumentException("Output span is shorter than the input", nameof(instrumentIds));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (long* ids = instrumentIds)
+        {
+            result = NativeMethods.dbento_pit_symbol_map_find_instrument_ids(
+                _handle,
+                symbols,
+                (nuint)symbols.Length,
+                ids,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to find instrument IDs: {error}");
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Find interned symbol IDs for many instrument IDs in one native call
+    /// </summary>
+    /// <param name="instrumentIds">Instrument IDs to look up</param>
+    /// <param name="symbolIds">Receives a symbol ID per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    public unsafe int FindSymbolIds(ReadOnlySpan<uint> instrumentIds, Span<int> symbolIds)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (symbolIds.Length < instrumentIds.Length)
+            throw new ArgumentException("Output span is shorter than the input", nameof(symbolIds));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (uint* ids = instrumentIds)
+        fixed (int* symbols = symbolIds)
+        {
+            result = NativeMethods.dbento_pit_symbol_map_find_bulk(
+                _handle,
+                ids,
+                (nuint)instrumentIds.Length,
+                symbols,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to find symbols: {error}");
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Find symbols for many instrument IDs in one native call
+    /// </summary>
+    /// <param name="instrumentIds">Instrument IDs to look up</param>
+    /// <returns>Symbol per entry, or null where not found</returns>
+    public string?[] FindMany(ReadOnlySpan<uint> instrumentIds)
+    {
+        int[] symbolIds = new int[instrumentIds.Length];
+        FindSymbolIds(instrumentIds, symbolIds);
+        return _symbolCache.Resolve(symbolIds, FetchSymbols);
+    }
+
+    /// <summary>
+    /// Symbol for an ID returned by <see cref="FindSymbolId"/> or <see cref="FindSymbolIds"/>
+    /// </summary>
+    /// <remarks>Each ID's string is fetched from native memory once and then cached.</remarks>
+    /// <returns>The symbol, or null if it has been evicted</returns>
+    public string? GetSymbol(int symbolId)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (symbolId < 0)
+            return null;
+        return _symbolCache.Resolve(new[] { symbolId }, FetchSymbols)[0];
+    }
+
+    /// <summary>
+    /// Remove instruments whose mapping has expired
+    /// </summary>
+    /// <remarks>
+    /// Mappings expire at the end of their symbol mapping interval or at the instrument's
+    /// expiration; mappings created from metadata never expire. Symbols no longer used by
+    /// any instrument are freed, which bounds memory in long sessions over rolling chains.
+    /// </remarks>
+    /// <param name="now">Current time</param>
+    /// <returns>Number of instruments removed</returns>
+    public int EvictExpired(DateTimeOffset now)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        long nowNs = (now.UtcTicks - DateTimeOffset.UnixEpoch.UtcTicks) * 100;
+        long result = NativeMethods.dbento_pit_symbol_map_evict_expired(_handle, (ulong)nowNs);
+        if (result < 0)
+            throw new DbentoException("Failed to evict expired symbol mappings");
+        if (result > 0)
+            _symbolCache.Clear();
+        return checked((int)result);
+    }
+
+    private unsafe int FetchSymbols(ReadOnlySpan<int> symbolIds, byte[]? buffer, out nuint requiredSize)
+    {
+        fixed (int* ids = symbolIds)
+        {
+            return NativeMethods.dbento_pit_symbol_map_get_symbols(
+                _handle, ids, (nuint)symbolIds.Length, buffer, (nuint)(buffer?.Length ?? 0), out requiredSize);
+        }
+    }
+
     /// <summary>
     /// Update symbol map from a record (for live data)
     /// </summary>
@@ -116,7 +307,7 @@ public sealed class PitSymbolMap : IPitSymbolMap
     /// <remarks>
     /// This method updates the internal symbol map when SymbolMapping records are received.
     /// It is primarily used during live streaming to dynamically build symbol mappings.
-    /// Only records of type SymbolMapping (RType 0x1B) will update the map; all other record types are silently ignored.
+    /// Symbol mapping records (RType 0x16) and instrument definitions update the map; all other record types are silently ignored.
     /// For historical data, prefer using Metadata.CreateSymbolMap() or CreateSymbolMapForDate() instead.
     /// </remarks>
     /// <exception cref="InvalidOperationException">If the record does not have raw bytes available</exception>
@@ -146,6 +337,41 @@ public sealed class PitSymbolMap : IPitSymbolMap
         }
     }
 
+    /// <summary>
+    /// Update symbol map from a batch of raw DBN records (for live data)
+    /// </summary>
+    /// <param name="records">Records laid out back to back, each as long as its header says</param>
+    /// <returns>Number of records that updated the map</returns>
+    /// <remarks>
+    /// The records are read in place by one native call; only symbol mappings and instrument
+    /// definitions update the map and all other records are skipped natively. If the buffer is
+    /// malformed, the records before the bad one have already been applied.
+    /// </remarks>
+    /// <exception cref="DbentoException">If a record length is invalid or overruns the buffer</exception>
+    public unsafe int OnRecords(ReadOnlySpan<byte> records)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        long result;
+        fixed (byte* bytes = records)
+        {
+            result = NativeMethods.dbento_pit_symbol_map_on_records(
+                _handle,
+                bytes,
+                (nuint)records.Length,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to update PIT symbol map from records: {error}");
+        }
+        return checked((int)result);
+    }
+
     /// <summary>
     /// Update symbol map from a SymbolMappingMessage (type-safe version)
     /// </summary>
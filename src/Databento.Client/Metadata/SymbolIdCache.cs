@@ -0,0 +1,79 @@
+using System.Text;
+using Databento.Interop;
+
+namespace Databento.Client.Metadata;
+
+/// <summary>
+/// Managed cache of interned symbol strings, keyed by native symbol ID
+/// </summary>
+/// <remarks>
+/// A native symbol ID always names the same symbol, so each string is fetched once;
+/// unknown IDs are fetched together in one native call.
+/// </remarks>
+internal sealed class SymbolIdCache
+{
+    /// <summary>Native call copying the symbols for a set of IDs</summary>
+    internal delegate int FetchSymbols(ReadOnlySpan<int> symbolIds, byte[]? buffer, out nuint requiredSize);
+
+    private readonly object _lock = new();
+    private readonly Dictionary<int, string?> _symbols = new();
+
+    /// <summary>
+    /// Map symbol IDs to symbols, with null for -1 and for evicted symbols
+    /// </summary>
+    public string?[] Resolve(ReadOnlySpan<int> symbolIds, FetchSymbols fetch)
+    {
+        lock (_lock)
+        {
+            var missing = new HashSet<int>();
+            foreach (int id in symbolIds)
+            {
+                if (id >= 0 && !_symbols.ContainsKey(id))
+                    missing.Add(id);
+            }
+            if (missing.Count > 0)
+                Fetch(missing.ToArray(), fetch);
+
+            var result = new string?[symbolIds.Length];
+            for (int i = 0; i < symbolIds.Length; i++)
+                result[i] = symbolIds[i] >= 0 ? _symbols[symbolIds[i]] : null;
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Forget every cached string, e.g. after symbols were evicted
+    /// </summary>
+    public void Clear()
+    {
+        lock (_lock)
+            _symbols.Clear();
+    }
+
+    private void Fetch(int[] ids, FetchSymbols fetch)
+    {
+        while (true)
+        {
+            int result = fetch(ids, null, out nuint required);
+            if (result != 0 && result != -3)
+                throw new DbentoException("Failed to read symbols");
+
+            byte[] buffer = new byte[checked((int)required)];
+            result = fetch(ids, buffer, out _);
+            if (result == -3)
+                continue; // Symbols changed between the calls
+            if (result != 0)
+                throw new DbentoException("Failed to read symbols");
+
+            int pos = 0;
+            foreach (int id in ids)
+            {
+                int end = Array.IndexOf(buffer, (byte)0, pos);
+                // Evicted IDs come back empty; they never name a symbol again
+                _symbols[id] = end > pos ? Encoding.UTF8.GetString(buffer, pos, end - pos) : null;
+                pos = end + 1;
+            }
+            return;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+using System.Text;
+using Databento.Interop;
+
+namespace Databento.Client.Metadata;
+
+/// <summary>
+/// Managed copy of a native symbol map's bulk lookup table
+/// </summary>
+/// <remarks>
+/// Native table indices never change, so the copy only grows: each refresh fetches the
+/// entries added since the last one.
+/// </remarks>
+internal sealed class SymbolTableCache
+{
+    /// <summary>Native call copying table entries from <paramref name="firstIndex"/> on</summary>
+    internal delegate int FetchSymbols(nuint firstIndex, byte[]? buffer, nuint bufferSize,
+        out nuint symbolCount, out nuint requiredSize);
+
+    private readonly object _lock = new();
+    private string[] _symbols = Array.Empty<string>();
+
+    /// <summary>
+    /// Table holding at least <paramref name="minCount"/> entries
+    /// </summary>
+    public IReadOnlyList<string> Get(FetchSymbols fetch, int minCount)
+    {
+        lock (_lock)
+        {
+            // A negative count asks for everything the native table holds
+            if (_symbols.Length < minCount || minCount < 0)
+                Refresh(fetch);
+            return _symbols;
+        }
+    }
+
+    /// <summary>
+    /// Table size needed to resolve every index in <paramref name="indices"/>
+    /// </summary>
+    public static int RequiredCount(ReadOnlySpan<int> indices)
+    {
+        int max = -1;
+        foreach (int index in indices)
+            max = Math.Max(max, index);
+        return max + 1;
+    }
+
+    /// <summary>
+    /// Map table indices to symbols, with null for -1
+    /// </summary>
+    public static string?[] Resolve(ReadOnlySpan<int> indices, IReadOnlyList<string> symbols)
+    {
+        var result = new string?[indices.Length];
+        for (int i = 0; i < indices.Length; i++)
+            result[i] = indices[i] >= 0 ? symbols[indices[i]] : null;
+        return result;
+    }
+
+    private void Refresh(FetchSymbols fetch)
+    {
+        var first = (nuint)_symbols.Length;
+        while (true)
+        {
+            int result = fetch(first, null, 0, out nuint count, out nuint required);
+            if (result == -1)
+                throw new DbentoException("Failed to read symbol table");
+            if (count == 0)
+                return;
+
+            byte[] buffer = new byte[checked((int)required)];
+            result = fetch(first, buffer, (nuint)buffer.Length, out count, out _);
+            if (result == -3)
+                continue; // The table grew between the calls
+            if (result != 0)
+                throw new DbentoException("Failed to read symbol table");
+
+            var symbols = new string[_symbols.Length + checked((int)count)];
+            _symbols.CopyTo(symbols, 0);
+            int pos = 0;
+            for (int i = _symbols.Length; i < symbols.Length; i++)
+            {
+                int end = Array.IndexOf(buffer, (byte)0, pos);
+                symbols[i] = Encoding.UTF8.GetString(buffer, pos, end - pos);
+                pos = end + 1;
+            }
+            _symbols = symbols;
+            return;
+        }
+    }
+}
@@ -16,6 +16,7 @@ namespace Databento.Client.Metadata;
 public sealed class TsSymbolMap : ITsSymbolMap
 {
     private readonly TsSymbolMapHandle _handle;
+    private readonly SymbolTableCache _symbolTable = new();
     private bool _disposed;
 
     internal TsSymbolMap(TsSymbolMapHandle handle)
@@ -23,6 +24,58 @@ public sealed class TsSymbolMap : ITsSymbolMap
         _handle = handle ?? throw new ArgumentNullException(nameof(handle));
     }
 
+    /// <summary>
+    /// Open a symbol map snapshot without rebuilding it from metadata
+    /// </summary>
+    /// <param name="filePath">Path of a snapshot written by <see cref="Save"/></param>
+    /// <remarks>
+    /// The snapshot is memory-mapped read-only and lookups read it in place, so it is ready almost
+    /// immediately and processes opening the same file share its memory.
+    /// </remarks>
+    /// <exception cref="DbentoException">If the file is missing or not a valid snapshot</exception>
+    public static TsSymbolMap Load(string filePath)
+    {
+        ArgumentException.ThrowIfNullOrEmpty(filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_ts_symbol_map_load(
+            filePath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to load symbol map snapshot: {error}");
+        }
+
+        return new TsSymbolMap(new TsSymbolMapHandle(handlePtr));
+    }
+
+    /// <summary>
+    /// Write a binary snapshot of this map, for <see cref="Load"/> to open at a later startup
+    /// </summary>
+    /// <param name="filePath">Path of the snapshot file; replaced atomically if it exists</param>
+    /// <exception cref="DbentoException">If the snapshot cannot be written</exception>
+    public void Save(string filePath)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentException.ThrowIfNullOrEmpty(filePath);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_ts_symbol_map_save(
+            _handle,
+            filePath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to save symbol map snapshot: {error}");
+        }
+    }
+
     /// <summary>
     /// Whether the symbol map is empty
     /// </summary>
@@ -92,16 +145,38 @@ public sealed class TsSymbolMap : ITsSymbolMap
         return symbol;
     }
 
+    /// <summary>
+    /// Find symbol for an instrument ID at an event timestamp (UTC date)
+    /// </summary>
+    public string? Find(long timestampNs, uint instrumentId)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+
+        byte[] symbolBuffer = new byte[Models.Constants.SymbolCstrLen];
+
+        int result = NativeMethods.dbento_ts_symbol_map_find_ts(
+            _handle,
+            (ulong)timestampNs,
+            instrumentId,
+            symbolBuffer,
+            (nuint)symbolBuffer.Length);
+
+        if (result != 0)
+        {
+            return null; // Not found or error
+        }
+
+        string symbol = System.Text.Encoding.UTF8.GetString(symbolBuffer).TrimEnd('\0');
+        return string.IsNullOrEmpty(symbol) ? null : symbol;
+    }
+
     /// <summary>
     /// Find symbol for a record (convenience method that extracts date and instrument ID)
     /// </summary>
     public string? Find(Models.Record record)
     {
         ArgumentNullException.ThrowIfNull(record);
-
-        // Extract date from record's timestamp
-        var date = DateOnly.FromDateTime(record.Timestamp.DateTime);
-        return Find(date, record.InstrumentId);
+        return Find(record.TimestampNs, record.InstrumentId);
     }
 
     /// <summary>
@@ -116,6 +191,140 @@ public sealed class TsSymbolMap : ITsSymbolMap
         return At(date, record.InstrumentId);
     }
 
+    /// <summary>
+    /// Find the instrument ID mapped to a symbol on a specific date
+    /// </summary>
+    /// <param name="date">The date</param>
+    /// <param name="symbol">The symbol</param>
+    /// <returns>Instrument ID if found, null otherwise</returns>
+    public uint? FindInstrumentId(DateOnly date, string symbol)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentNullException.ThrowIfNull(symbol);
+
+        int result = NativeMethods.dbento_ts_symbol_map_find_instrument_id(
+            _handle,
+            date.Year,
+            (uint)date.Month,
+            (uint)date.Day,
+            symbol,
+            out uint instrumentId);
+        return result == 0 ? instrumentId : null;
+    }
+
+    /// <summary>
+    /// Find instrument IDs for many (timestamp, symbol) pairs in one native call
+    /// </summary>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="symbols">Symbols, one per timestamp</param>
+    /// <param name="instrumentIds">Receives an instrument ID per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    public unsafe int FindInstrumentIds(ReadOnlySpan<long> timestampsNs, string[] symbols, Span<long> instrumentIds)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        ArgumentNullException.ThrowIfNull(symbols);
+        if (timestampsNs.Length != symbols.Length)
+            throw new ArgumentException("Timestamps and symbols must have the same length", nameof(symbols));
+        if (instrumentIds.Length < symbols.Length)
+            throw new ArgumentException("Output span is shorter than the input", nameof(instrumentIds));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (long* ts = timestampsNs)
+        fixed (long* ids = instrumentIds)
+        {
+            result = NativeMethods.dbento_ts_symbol_map_find_instrument_ids(
+                _handle,
+                (ulong*)ts,
+                symbols,
+                (nuint)symbols.Length,
+                ids,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to find instrument IDs: {error}");
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Find symbols for many (timestamp, instrument ID) pairs in one native call
+    /// </summary>
+    /// <remarks>
+    /// Each found symbol is written as an index into <see cref="GetSymbolTable"/>; indices
+    /// are stable for the life of the map, so the table can be cached.
+    /// </remarks>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="instrumentIds">Instrument IDs, one per timestamp</param>
+    /// <param name="symbolIndices">Receives a symbol table index per entry, or -1 if not found</param>
+    /// <returns>Number of entries found</returns>
+    public unsafe int FindIndices(ReadOnlySpan<long> timestampsNs, ReadOnlySpan<uint> instrumentIds, Span<int> symbolIndices)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (timestampsNs.Length != instrumentIds.Length)
+            throw new ArgumentException("Timestamps and instrument IDs must have the same length", nameof(instrumentIds));
+        if (symbolIndices.Length < instrumentIds.Length)
+            throw new ArgumentException("Output span is shorter than the input", nameof(symbolIndices));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (long* ts = timestampsNs)
+        fixed (uint* ids = instrumentIds)
+        fixed (int* indices = symbolIndices)
+        {
+            result = NativeMethods.dbento_ts_symbol_map_find_bulk(
+                _handle,
+                (ulong*)ts,
+                ids,
+                (nuint)instrumentIds.Length,
+                indices,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+        }
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to find symbols: {error}");
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Find symbols for many (timestamp, instrument ID) pairs in one native call
+    /// </summary>
+    /// <param name="timestampsNs">Event timestamps in nanoseconds since the UNIX epoch</param>
+    /// <param name="instrumentIds">Instrument IDs, one per timestamp</param>
+    /// <returns>Symbol per entry, or null where not found</returns>
+    public string?[] FindMany(ReadOnlySpan<long> timestampsNs, ReadOnlySpan<uint> instrumentIds)
+    {
+        int[] indices = new int[instrumentIds.Length];
+        FindIndices(timestampsNs, instrumentIds, indices);
+        return SymbolTableCache.Resolve(indices, GetSymbolTable(indices));
+    }
+
+    /// <summary>
+    /// Symbols referenced by the indices <see cref="FindIndices"/> returns
+    /// </summary>
+    public IReadOnlyList<string> GetSymbolTable()
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        return _symbolTable.Get(FetchSymbols, -1);
+    }
+
+    private IReadOnlyList<string> GetSymbolTable(ReadOnlySpan<int> indices)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        return _symbolTable.Get(FetchSymbols, SymbolTableCache.RequiredCount(indices));
+    }
+
+    private int FetchSymbols(nuint firstIndex, byte[]? buffer, nuint bufferSize, out nuint symbolCount, out nuint requiredSize) =>
+        NativeMethods.dbento_ts_symbol_map_get_symbols(_handle, firstIndex, buffer, bufferSize, out symbolCount, out requiredSize);
+
     public void Dispose()
     {
         if (_disposed) return;
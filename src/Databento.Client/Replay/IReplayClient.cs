@@ -0,0 +1,78 @@
+using Databento.Client.Events;
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+
+namespace Databento.Client.Replay;
+
+/// <summary>
+/// Replays local DBN files with live-client style delivery and pacing control
+/// </summary>
+public interface IReplayClient : IDisposable, IAsyncDisposable
+{
+    /// <summary>
+    /// Event fired when a record is delivered by Start
+    /// </summary>
+    event EventHandler<DataReceivedEventArgs>? DataReceived;
+
+    /// <summary>
+    /// Event fired when an error occurs during replay
+    /// </summary>
+    event EventHandler<Events.ErrorEventArgs>? ErrorOccurred;
+
+    /// <summary>
+    /// Current playback state
+    /// </summary>
+    ReplayState State { get; }
+
+    /// <summary>
+    /// Playback speed multiplier for real-time pacing (1.0 = real time)
+    /// </summary>
+    double Speed { get; set; }
+
+    /// <summary>
+    /// Get the metadata of one of the replayed files
+    /// </summary>
+    /// <param name="fileIndex">Index into the file list passed to the constructor</param>
+    /// <returns>DBN file metadata</returns>
+    DbnMetadata GetMetadata(int fileIndex = 0);
+
+    /// <summary>
+    /// Start delivering records through DataReceived on a background thread
+    /// </summary>
+    /// <param name="maxBatchRecords">Maximum records crossing the native boundary per call</param>
+    void Start(int maxBatchRecords = 1024);
+
+    /// <summary>
+    /// Pull records as an async stream (alternative to Start)
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records in replay order</returns>
+    IAsyncEnumerable<Record> ReadRecordsAsync(CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Pause delivery
+    /// </summary>
+    void Pause();
+
+    /// <summary>
+    /// Resume delivery
+    /// </summary>
+    void Resume();
+
+    /// <summary>
+    /// Release records one at a time while paused
+    /// </summary>
+    /// <param name="recordCount">Number of records to release</param>
+    void Step(int recordCount = 1);
+
+    /// <summary>
+    /// Jump to the first record at or after a timestamp
+    /// </summary>
+    /// <param name="timestamp">Target timestamp</param>
+    void Seek(DateTimeOffset timestamp);
+
+    /// <summary>
+    /// Stop delivery
+    /// </summary>
+    void Stop();
+}
@@ -0,0 +1,379 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using Databento.Client.Events;
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Replay;
+
+/// <summary>
+/// Replays local DBN files with live-client style delivery and pacing control
+/// </summary>
+/// <remarks>
+/// Files are replayed back-to-back in the order given and decoded ahead of delivery on background threads.
+/// Records can be consumed either through events (Start) or by pulling (ReadRecordsAsync), not both.
+/// </remarks>
+public sealed class ReplayClient : IReplayClient
+{
+    // Poll interval for the pull interface so cancellation is observed promptly
+    private const int PullTimeoutMs = 100;
+    private const int PullMaxRecords = 1024;
+    private const int PullBufferSize = 1024 * 1024;
+
+    private readonly ReplayHandle _handle;
+    private readonly RecordBatchCallbackDelegate _batchCallback;
+    private readonly ErrorCallbackDelegate _errorCallback;
+    private readonly int _fileCount;
+    private readonly DbnMetadata?[] _cachedMetadata;
+    private double _speed;
+    // Atomic disposal state (0=active, 1=disposing, 2=disposed)
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Event fired when a record is delivered by Start
+    /// </summary>
+    public event EventHandler<DataReceivedEventArgs>? DataReceived;
+
+    /// <summary>
+    /// Event fired when an error occurs during replay
+    /// </summary>
+    public event EventHandler<Events.ErrorEventArgs>? ErrorOccurred;
+
+    /// <summary>
+    /// Create a replay over one or more DBN files
+    /// </summary>
+    /// <param name="filePaths">DBN files to replay, in order</param>
+    /// <param name="pacing">Pacing mode</param>
+    /// <param name="speed">Speed multiplier for real-time pacing (1.0 = real time)</param>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DbentoException">If the replay cannot be created</exception>
+    public ReplayClient(IEnumerable<string> filePaths, ReplayPacing pacing = ReplayPacing.AsFastAsPossible, double speed = 1.0)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        var paths = filePaths.ToArray();
+        if (paths.Length == 0)
+            throw new ArgumentException("At least one file path is required", nameof(filePaths));
+
+        foreach (var path in paths)
+        {
+            if (string.IsNullOrWhiteSpace(path))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(path))
+                throw new FileNotFoundException($"DBN file not found: {path}", path);
+        }
+
+        if (!double.IsFinite(speed) || speed <= 0)
+            throw new ArgumentOutOfRangeException(nameof(speed), "Speed must be a positive number");
+
+        // Create callbacks (must be stored to prevent GC collection)
+        unsafe
+        {
+            _batchCallback = OnRecordBatch;
+        }
+        _errorCallback = OnErrorOccurred;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_replay_create(
+            paths,
+            (nuint)paths.Length,
+            (int)pacing,
+            speed,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to create replay: {error}");
+        }
+
+        _handle = new ReplayHandle(handlePtr);
+        _fileCount = paths.Length;
+        _cachedMetadata = new DbnMetadata?[paths.Length];
+        _speed = speed;
+    }
+
+    /// <summary>
+    /// Current playback state
+    /// </summary>
+    public ReplayState State
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            int state = NativeMethods.dbento_replay_get_state(_handle);
+            if (state < 0)
+                throw new DbentoException("Failed to get replay state");
+            return (ReplayState)state;
+        }
+    }
+
+    /// <summary>
+    /// Playback speed multiplier for real-time pacing (1.0 = real time)
+    /// </summary>
+    public double Speed
+    {
+        get => Volatile.Read(ref _speed);
+        set
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            if (!double.IsFinite(value) || value <= 0)
+                throw new ArgumentOutOfRangeException(nameof(value), "Speed must be a positive number");
+
+            ThrowIfFailed(NativeMethods.dbento_replay_set_speed(_handle, value), "set replay speed");
+            Volatile.Write(ref _speed, value);
+        }
+    }
+
+    /// <summary>
+    /// Get the metadata of one of the replayed files
+    /// </summary>
+    /// <param name="fileIndex">Index into the file list passed to the constructor</param>
+    /// <returns>DBN file metadata</returns>
+    public DbnMetadata GetMetadata(int fileIndex = 0)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(fileIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(fileIndex, _fileCount);
+
+        if (_cachedMetadata[fileIndex] is { } cached)
+            return cached;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_replay_get_metadata(
+            _handle,
+            (nuint)fileIndex,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to get replay metadata: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            var metadata = JsonSerializer.Deserialize<DbnMetadata>(json)
+                ?? throw new DbentoException("Failed to deserialize replay metadata");
+            _cachedMetadata[fileIndex] = metadata;
+            return metadata;
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Start delivering records through DataReceived on a background thread
+    /// </summary>
+    /// <param name="maxBatchRecords">Maximum records crossing the native boundary per call</param>
+    public void Start(int maxBatchRecords = 1024)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxBatchRecords);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_replay_start_batched(
+            _handle,
+            null,
+            _batchCallback,
+            (nuint)maxBatchRecords,
+            _errorCallback,
+            IntPtr.Zero,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to start replay: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Pull records as an async stream (alternative to Start)
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records in replay order</returns>
+    public async IAsyncEnumerable<Record> ReadRecordsAsync(
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] recordBuffer = new byte[PullBufferSize];
+        nuint[] offsets = new nuint[PullMaxRecords];
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+
+        await Task.Yield(); // Make it properly async
+
+        while (true)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            int result = NativeMethods.dbento_replay_next_records(
+                _handle,
+                recordBuffer,
+                (nuint)recordBuffer.Length,
+                offsets,
+                (nuint)offsets.Length,
+                out nuint recordCount,
+                PullTimeoutMs,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result == 1)
+                yield break;
+
+            if (result < 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Error reading replay records: {error}", result);
+            }
+
+            for (int i = 0; i < (int)recordCount; i++)
+            {
+                int offset = (int)offsets[i];
+                int length = recordBuffer[offset] * 4;
+                yield return Record.FromBytes(recordBuffer.AsSpan(offset, length), recordBuffer[offset + 1]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Pause delivery
+    /// </summary>
+    public void Pause()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ThrowIfFailed(NativeMethods.dbento_replay_pause(_handle), "pause replay");
+    }
+
+    /// <summary>
+    /// Resume delivery
+    /// </summary>
+    public void Resume()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ThrowIfFailed(NativeMethods.dbento_replay_resume(_handle), "resume replay");
+    }
+
+    /// <summary>
+    /// Release records one at a time while paused
+    /// </summary>
+    /// <param name="recordCount">Number of records to release</param>
+    /// <exception cref="InvalidOperationException">If the replay is not paused</exception>
+    public void Step(int recordCount = 1)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(recordCount);
+
+        int result = NativeMethods.dbento_replay_step(_handle, (nuint)recordCount);
+        if (result == -2)
+            throw new InvalidOperationException("Replay must be paused to step");
+        ThrowIfFailed(result, "step replay");
+    }
+
+    /// <summary>
+    /// Jump to the first record at or after a timestamp
+    /// </summary>
+    /// <remarks>A finished replay resumes delivery from the target.</remarks>
+    /// <param name="timestamp">Target timestamp</param>
+    /// <exception cref="DbentoException">If the replay has been stopped</exception>
+    public void Seek(DateTimeOffset timestamp)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        long timestampNs = Utilities.DateTimeHelpers.ToUnixNanos(timestamp);
+        ThrowIfFailed(NativeMethods.dbento_replay_seek(_handle, timestampNs), "seek replay");
+    }
+
+    /// <summary>
+    /// Stop delivery
+    /// </summary>
+    public void Stop()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0)
+            return;
+        NativeMethods.dbento_replay_stop(_handle);
+    }
+
+    private static void ThrowIfFailed(int result, string operation)
+    {
+        if (result < 0)
+            throw new DbentoException($"Failed to {operation}", result);
+    }
+
+    private unsafe void OnRecordBatch(byte* records, nuint totalLength, nuint recordCount, IntPtr userData)
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0)
+            return;
+
+        try
+        {
+            if (records == null || totalLength > int.MaxValue)
+            {
+                ErrorOccurred?.Invoke(this, new Events.ErrorEventArgs(
+                    new DbentoException("Received invalid record batch from native code")));
+                return;
+            }
+
+            // Records are only valid for the duration of the callback; FromBytes copies each one
+            var span = new ReadOnlySpan<byte>(records, (int)totalLength);
+            int offset = 0;
+            for (nuint i = 0; i < recordCount && offset < span.Length; i++)
+            {
+                int length = span[offset] * 4;
+                if (length == 0 || offset + length > span.Length)
+                {
+                    ErrorOccurred?.Invoke(this, new Events.ErrorEventArgs(
+                        new DbentoException($"Malformed record length in batch at offset {offset}")));
+                    return;
+                }
+
+                var record = Record.FromBytes(span.Slice(offset, length), span[offset + 1]);
+                offset += length;
+                DataReceived?.Invoke(this, new DataReceivedEventArgs(record));
+            }
+        }
+        catch (Exception ex)
+        {
+            ErrorOccurred?.Invoke(this, new Events.ErrorEventArgs(ex));
+        }
+    }
+
+    private void OnErrorOccurred(string errorMessage, int errorCode, IntPtr userData)
+    {
+        var exception = new DbentoException(errorMessage, errorCode);
+        ErrorOccurred?.Invoke(this, new Events.ErrorEventArgs(exception, errorCode));
+    }
+
+    /// <summary>
+    /// Dispose the replay and free resources
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        // Native destroy joins the delivery thread, so no callbacks run after this returns; called
+        // from inside a callback, it stops delivery and the delivery thread frees the replay as it exits
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+
+    /// <summary>
+    /// Asynchronously dispose the replay and free resources
+    /// </summary>
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
@@ -0,0 +1,16 @@
+namespace Databento.Client.Replay;
+
+/// <summary>
+/// How a replay paces record delivery
+/// </summary>
+public enum ReplayPacing
+{
+    /// <summary>Deliver records as fast as they can be decoded</summary>
+    AsFastAsPossible = 0,
+
+    /// <summary>Reproduce original gaps between records using ts_event</summary>
+    RealTimeTsEvent = 1,
+
+    /// <summary>Reproduce original gaps between records using ts_recv (falls back to ts_event where absent)</summary>
+    RealTimeTsRecv = 2
+}
@@ -0,0 +1,25 @@
+namespace Databento.Client.Replay;
+
+/// <summary>
+/// Playback state of a replay
+/// </summary>
+public enum ReplayState
+{
+    /// <summary>Created but not started</summary>
+    Idle = 0,
+
+    /// <summary>Delivering records</summary>
+    Running = 1,
+
+    /// <summary>Paused (records can be released with Step)</summary>
+    Paused = 2,
+
+    /// <summary>All files have been replayed</summary>
+    Finished = 3,
+
+    /// <summary>Stopped after a decode error</summary>
+    Error = 4,
+
+    /// <summary>Stopped by Stop (cannot be restarted)</summary>
+    Stopped = 5
+}
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native DBN columnar file reader
+/// </summary>
+public sealed class DbnColumnarReaderHandle : SafeHandle
+{
+    public DbnColumnarReaderHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public DbnColumnarReaderHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_dbn_columnar_close(handle);
+        }
+        return true;
+    }
+}
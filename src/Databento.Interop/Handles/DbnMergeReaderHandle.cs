@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native DBN merge reader
+/// </summary>
+public sealed class DbnMergeReaderHandle : SafeHandle
+{
+    public DbnMergeReaderHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public DbnMergeReaderHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_dbn_merge_close(handle);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native memory-mapped DBN reader
+/// </summary>
+public sealed class DbnMmapReaderHandle : SafeHandle
+{
+    public DbnMmapReaderHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public DbnMmapReaderHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_dbn_mmap_close(handle);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native DBN text transcoder
+/// </summary>
+public sealed class DbnTranscoderHandle : SafeHandle
+{
+    public DbnTranscoderHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public DbnTranscoderHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_dbn_transcoder_close(handle);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native replay
+/// </summary>
+public sealed class ReplayHandle : SafeHandle
+{
+    public ReplayHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public ReplayHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_replay_destroy(handle);
+        }
+        return true;
+    }
+}
@@ -39,3 +39,17 @@ public delegate void MetadataCallbackDelegate(
     [MarshalAs(UnmanagedType.LPUTF8Str)] string metadataJson,
     nuint metadataLength,
     IntPtr userData);
+
+/// <summary>
+/// Callback invoked with a contiguous run of records from the native library
+/// </summary>
+/// <param name="records">Pointer to the first record (valid only during the callback)</param>
+/// <param name="totalLength">Total length of all records in bytes</param>
+/// <param name="recordCount">Number of records in the run</param>
+/// <param name="userData">User-provided context pointer</param>
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+public unsafe delegate void RecordBatchCallbackDelegate(
+    byte* records,
+    nuint totalLength,
+    nuint recordCount,
+    IntPtr userData);
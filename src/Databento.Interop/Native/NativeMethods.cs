@@ -93,6 +93,14 @@ public static partial class NativeMethods
     [LibraryImport(LibName)]
     public static partial int dbento_live_get_connection_state(LiveClientHandle handle);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_live_set_text_output(
+        LiveClientHandle handle,
+        string? outputPath,
+        string? optionsJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     // ========================================================================
     // Historical Client API
     // ========================================================================
@@ -103,6 +111,15 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_historical_create_pooled(
+        string apiKey,
+        nuint poolSize,
+        long idleTimeoutMs,
+        nuint prewarmCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
     public static partial int dbento_historical_get_range(
         HistoricalClientHandle handle,
@@ -304,6 +321,66 @@ public static partial class NativeMethods
         byte[] symbolBuffer,
         nuint symbolBufferSize);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_ts_symbol_map_find_ts(
+        TsSymbolMapHandle handle,
+        ulong tsEvent,
+        uint instrumentId,
+        byte[] symbolBuffer,
+        nuint symbolBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_ts_symbol_map_find_instrument_id(
+        TsSymbolMapHandle handle,
+        int year,
+        uint month,
+        uint day,
+        string symbol,
+        out uint instrumentId);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_ts_symbol_map_find_instrument_ids(
+        TsSymbolMapHandle handle,
+        ulong* tsEvents,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)]
+        string[] symbols,
+        nuint count,
+        long* instrumentIds,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_ts_symbol_map_find_bulk(
+        TsSymbolMapHandle handle,
+        ulong* tsEvents,
+        uint* instrumentIds,
+        nuint count,
+        int* symbolIndices,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_ts_symbol_map_get_symbols(
+        TsSymbolMapHandle handle,
+        nuint firstIndex,
+        byte[]? buffer,
+        nuint bufferSize,
+        out nuint symbolCount,
+        out nuint requiredSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_ts_symbol_map_save(
+        TsSymbolMapHandle handle,
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_ts_symbol_map_load(
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial void dbento_ts_symbol_map_destroy(IntPtr handle);
 
@@ -320,12 +397,78 @@ public static partial class NativeMethods
         byte[] symbolBuffer,
         nuint symbolBufferSize);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_pit_symbol_map_find_id(
+        PitSymbolMapHandle handle,
+        uint instrumentId,
+        out uint symbolId);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_pit_symbol_map_find_instrument_id(
+        PitSymbolMapHandle handle,
+        string symbol,
+        out uint instrumentId);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_pit_symbol_map_find_instrument_ids(
+        PitSymbolMapHandle handle,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)]
+        string[] symbols,
+        nuint count,
+        long* instrumentIds,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_pit_symbol_map_find_bulk(
+        PitSymbolMapHandle handle,
+        uint* instrumentIds,
+        nuint count,
+        int* symbolIds,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_pit_symbol_map_get_symbols(
+        PitSymbolMapHandle handle,
+        int* symbolIds,
+        nuint count,
+        byte[]? buffer,
+        nuint bufferSize,
+        out nuint requiredSize);
+
     [LibraryImport(LibName)]
     public static partial int dbento_pit_symbol_map_on_record(
         PitSymbolMapHandle handle,
         byte[] recordBytes,
         nuint recordLength);
 
+    [LibraryImport(LibName)]
+    public static unsafe partial long dbento_pit_symbol_map_on_records(
+        PitSymbolMapHandle handle,
+        byte* records,
+        nuint length,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial long dbento_pit_symbol_map_evict_expired(
+        PitSymbolMapHandle handle,
+        ulong nowNs);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_pit_symbol_map_save(
+        PitSymbolMapHandle handle,
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_pit_symbol_map_load(
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial void dbento_pit_symbol_map_destroy(IntPtr handle);
 
@@ -386,6 +529,29 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_ex(
+        string filePath,
+        int decompressionThreads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_filtered(
+        string filePath,
+        int decompressionThreads,
+        string filterJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_prefetched(
+        string filePath,
+        nuint bufferSize,
+        nuint queueDepth,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
     public static partial IntPtr dbento_dbn_file_get_metadata(
         DbnFileReaderHandle handle,
@@ -402,9 +568,262 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_next_records(
+        DbnFileReaderHandle handle,
+        byte[] recordBuffer,
+        nuint recordBufferSize,
+        nuint[] recordOffsets,
+        nuint maxRecords,
+        out nuint recordCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_seek_time(
+        DbnFileReaderHandle handle,
+        long tsEventNs,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_select_instruments(
+        DbnFileReaderHandle handle,
+        uint[]? instrumentIds,
+        nuint instrumentCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_get_filter_stats(
+        DbnFileReaderHandle handle,
+        out ulong recordsScanned,
+        out ulong recordsPassed);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_get_io_backend(DbnFileReaderHandle handle);
+
     [LibraryImport(LibName)]
     public static partial void dbento_dbn_file_close(IntPtr handle);
 
+    // ========================================================================
+    // DBN Index API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial long dbento_dbn_build_index(
+        string filePath,
+        ulong recordInterval,
+        ulong byteInterval,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // Memory-Mapped DBN Reader API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_mmap_open(
+        string filePath,
+        int accessHint,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_dbn_mmap_get_metadata(
+        DbnMmapReaderHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_mmap_next_record(
+        DbnMmapReaderHandle handle,
+        out byte* record,
+        out nuint recordLength,
+        out byte recordType,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_mmap_borrow_records(
+        DbnMmapReaderHandle handle,
+        nuint maxBytes,
+        nuint maxRecords,
+        out byte* records,
+        out nuint totalLength,
+        out nuint recordCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_mmap_get_records(
+        DbnMmapReaderHandle handle,
+        out byte* records,
+        out nuint totalLength);
+
+    [LibraryImport(LibName)]
+    public static partial long dbento_dbn_mmap_tell(DbnMmapReaderHandle handle);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_mmap_seek(DbnMmapReaderHandle handle, nuint offset);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_mmap_advise(
+        DbnMmapReaderHandle handle,
+        int accessHint,
+        nuint offset,
+        nuint length);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_mmap_close(IntPtr handle);
+
+    // ========================================================================
+    // DBN Merge Reader API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_merge_open(
+        string[] filePaths,
+        nuint fileCount,
+        int orderBy,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_dbn_merge_get_metadata(
+        DbnMergeReaderHandle handle,
+        nuint fileIndex,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_merge_next_records(
+        DbnMergeReaderHandle handle,
+        byte[] recordBuffer,
+        nuint recordBufferSize,
+        nuint[] recordOffsets,
+        uint[]? sourceIndices,
+        nuint maxRecords,
+        out nuint recordCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_merge_close(IntPtr handle);
+
+    // ========================================================================
+    // DBN Aggregation API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_aggregate(
+        string[] filePaths,
+        nuint fileCount,
+        string? specJson,
+        int threads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Columnar API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_columnar_export(
+        string[] filePaths,
+        nuint fileCount,
+        string outputDir,
+        string? optionsJson,
+        int threads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_columnar_open(
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_dbn_columnar_get_schema(
+        DbnColumnarReaderHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_columnar_read_column(
+        DbnColumnarReaderHandle handle,
+        nuint rowGroup,
+        nuint column,
+        byte* values,
+        nuint valuesSize,
+        out nuint rowCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_columnar_close(IntPtr handle);
+
+    // ========================================================================
+    // DBN Split API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_split(
+        string[] filePaths,
+        nuint fileCount,
+        string outputDir,
+        string? optionsJson,
+        int threads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Text Transcode API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_transcode(
+        string inputPath,
+        string outputPath,
+        string? optionsJson,
+        int threads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_transcoder_open(
+        string filePath,
+        string? optionsJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_transcoder_read(
+        DbnTranscoderHandle handle,
+        byte* buffer,
+        nuint bufferSize,
+        out nuint bytesWritten,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_transcoder_close(IntPtr handle);
+
+    // ========================================================================
+    // DBN Upgrade API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_upgrade(
+        string[] filePaths,
+        nuint fileCount,
+        string? outputDir,
+        string? optionsJson,
+        int threads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     // ========================================================================
     // DBN File Writer API
     // ========================================================================
@@ -416,6 +835,32 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_create_ex(
+        string filePath,
+        string metadataJson,
+        int compression,
+        int compressionLevel,
+        nuint frameSize,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_create_async(
+        string filePath,
+        string metadataJson,
+        string? optionsJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_append(
+        string filePath,
+        string? metadataJson,
+        string? optionsJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial int dbento_dbn_file_write_record(
         DbnFileWriterHandle handle,
@@ -424,9 +869,108 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_file_write_records(
+        DbnFileWriterHandle handle,
+        byte* records,
+        nuint length,
+        nuint count,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_flush(
+        DbnFileWriterHandle handle,
+        int sync,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial void dbento_dbn_file_close_writer(IntPtr handle);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_close_writer_ex(
+        IntPtr handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // Replay API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_replay_create(
+        string[] filePaths,
+        nuint fileCount,
+        int pacingMode,
+        double speed,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_replay_get_metadata(
+        ReplayHandle handle,
+        nuint fileIndex,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_start(
+        ReplayHandle handle,
+        MetadataCallbackDelegate? onMetadata,
+        RecordCallbackDelegate onRecord,
+        ErrorCallbackDelegate? onError,
+        IntPtr userData,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_start_batched(
+        ReplayHandle handle,
+        MetadataCallbackDelegate? onMetadata,
+        RecordBatchCallbackDelegate onBatch,
+        nuint maxBatchRecords,
+        ErrorCallbackDelegate? onError,
+        IntPtr userData,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_next_records(
+        ReplayHandle handle,
+        byte[] recordBuffer,
+        nuint recordBufferSize,
+        nuint[] recordOffsets,
+        nuint maxRecords,
+        out nuint recordCount,
+        int timeoutMs,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_pause(ReplayHandle handle);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_resume(ReplayHandle handle);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_step(ReplayHandle handle, nuint recordCount);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_seek(ReplayHandle handle, long timestampNs);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_set_speed(ReplayHandle handle, double speed);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_replay_get_state(ReplayHandle handle);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_replay_stop(ReplayHandle handle);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_replay_destroy(IntPtr handle);
+
     // ========================================================================
     // Symbology Resolution API
     // ========================================================================
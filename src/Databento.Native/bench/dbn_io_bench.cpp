@@ -0,0 +1,181 @@
+// Decode throughput of a DBN file through each I/O backend, warm and cold page cache
+//
+// Usage: dbn-io-bench [--buffer BYTES] [--depth N] [--runs N] [--cold] <file>
+//
+// Cold runs evict the file from the page cache before every run with
+// posix_fadvise(POSIX_FADV_DONTNEED). That drops clean pages only, so run
+// `sync` first after writing the file; on network filesystems it may have no
+// effect and a remount is the only reliable way to get a cold cache.
+
+#include "prefetch_io.hpp"
+#include <databento/dbn_decoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/log.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace db = databento;
+using databento_native::IoBackend;
+
+namespace {
+
+struct RunResult {
+    double seconds = 0;
+    uint64_t records = 0;
+    uint64_t checksum = 0;  // Sum of ts_event; printed so decoding can't be optimized away
+};
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "Usage: dbn-io-bench [--buffer BYTES] [--depth N] [--runs N] [--cold] <file>\n"
+        "  --buffer BYTES  Bytes per prefetch read (default: %llu)\n"
+        "  --depth N       Prefetch reads in flight (default: %llu)\n"
+        "  --runs N        Runs per backend; the best is reported (default: 3)\n"
+        "  --cold          Evict the file from the page cache before each run\n",
+        static_cast<unsigned long long>(databento_native::kDefaultPrefetchBufferSize),
+        static_cast<unsigned long long>(databento_native::kDefaultPrefetchQueueDepth));
+}
+
+bool ParseCount(const char* text, uint64_t* value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (!end || *end != '\0' || end == text) {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+bool DropPageCache(const std::filesystem::path& path) {
+#if defined(POSIX_FADV_DONTNEED)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    int rc = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+    return rc == 0;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+std::unique_ptr<db::IReadable> OpenInput(const std::filesystem::path& path, IoBackend backend,
+                                         size_t buffer_size, size_t queue_depth, IoBackend* actual) {
+    if (backend == IoBackend::Sync) {
+        *actual = IoBackend::Sync;
+        return std::make_unique<db::InFileStream>(path);
+    }
+    auto input = std::make_unique<databento_native::PrefetchFileReadable>(path, buffer_size, queue_depth, backend);
+    *actual = input->Backend();
+    return input;
+}
+
+RunResult DecodeAll(const std::filesystem::path& path, IoBackend backend, size_t buffer_size,
+                    size_t queue_depth, IoBackend* actual) {
+    auto start = std::chrono::steady_clock::now();
+    db::DbnDecoder decoder{db::ILogReceiver::Default(), OpenInput(path, backend, buffer_size, queue_depth, actual),
+                           db::VersionUpgradePolicy::UpgradeToV3};
+    decoder.DecodeMetadata();
+    RunResult result;
+    while (const db::Record* record = decoder.DecodeRecord()) {
+        result.checksum += record->Header().ts_event.time_since_epoch().count();
+        ++result.records;
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+const char* BackendName(IoBackend backend) {
+    switch (backend) {
+        case IoBackend::Sync: return "sync";
+        case IoBackend::ReadAheadThread: return "read-ahead";
+        case IoBackend::IoUring: return "io_uring";
+    }
+    return "?";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    uint64_t buffer_size = databento_native::kDefaultPrefetchBufferSize;
+    uint64_t queue_depth = databento_native::kDefaultPrefetchQueueDepth;
+    uint64_t runs = 3;
+    bool cold = false;
+    std::filesystem::path path;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--buffer" || arg == "--depth" || arg == "--runs") && i + 1 < argc) {
+            uint64_t* target = arg == "--buffer" ? &buffer_size : arg == "--depth" ? &queue_depth : &runs;
+            if (!ParseCount(argv[++i], target) || *target == 0) {
+                PrintUsage();
+                return 2;
+            }
+        } else if (arg == "--cold") {
+            cold = true;
+        } else if (arg.rfind("-", 0) == 0 || !path.empty()) {
+            PrintUsage();
+            return 2;
+        } else {
+            path = arg;
+        }
+    }
+    if (path.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    try {
+        double megabytes = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+        std::printf("%s: %.1f MiB, %s page cache, buffer %llu, depth %llu\n", path.string().c_str(), megabytes,
+                    cold ? "cold" : "warm", static_cast<unsigned long long>(buffer_size),
+                    static_cast<unsigned long long>(queue_depth));
+        if (!cold) {
+            // Priming pass so every backend starts from the same warm cache
+            IoBackend actual;
+            DecodeAll(path, IoBackend::Sync, buffer_size, queue_depth, &actual);
+        }
+
+        for (IoBackend backend : {IoBackend::Sync, IoBackend::ReadAheadThread, IoBackend::IoUring}) {
+            RunResult best;
+            IoBackend actual = backend;
+            for (uint64_t run = 0; run < runs; ++run) {
+                if (cold && !DropPageCache(path)) {
+                    std::fprintf(stderr, "warning: could not evict %s from the page cache\n", path.string().c_str());
+                }
+                RunResult result = DecodeAll(path, backend, buffer_size, queue_depth, &actual);
+                if (run == 0 || result.seconds < best.seconds) {
+                    best = result;
+                }
+            }
+            if (actual != backend) {
+                std::printf("%-11s unavailable (fell back to %s)\n", BackendName(backend), BackendName(actual));
+                continue;
+            }
+            std::printf("%-11s %8.3f s %10.1f MiB/s %14.0f records/s  checksum %016llx\n", BackendName(backend),
+                        best.seconds, megabytes / best.seconds, static_cast<double>(best.records) / best.seconds,
+                        static_cast<unsigned long long>(best.checksum));
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+// Handle validation throughput under contention: the lock-free slot map against the
+// mutex-protected set it replaced
+//
+// Usage: handle-registry-bench [--handles N] [--lookups N] [--threads N] [--runs N]
+//
+// Every thread validates handles from a shared pool in a tight loop, the way reader
+// threads call per-record APIs; one extra thread keeps creating and destroying
+// handles to exercise the write path. Thread counts double from 1 up to --threads.
+
+#include "handle_validation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using databento_native::HandleType;
+using databento_native::ValidationError;
+
+namespace {
+
+// The previous registry: one global mutex around an unordered_set of handle headers
+class MutexRegistry {
+public:
+    struct Header {
+        HandleType type;
+        void* wrapper;
+    };
+
+    void* Register(HandleType type, void* wrapper) {
+        auto* header = new Header{type, wrapper};
+        std::lock_guard<std::mutex> lock(mutex_);
+        handles_.insert(header);
+        return header;
+    }
+
+    void Unregister(void* handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            handles_.erase(static_cast<Header*>(handle));
+        }
+        delete static_cast<Header*>(handle);
+    }
+
+    void* Lookup(void* handle, HandleType expected_type) {
+        auto* header = static_cast<Header*>(handle);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (handles_.find(header) == handles_.end()) {
+                return nullptr;
+            }
+        }
+        return header->type == expected_type ? header->wrapper : nullptr;
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_set<Header*> handles_;
+};
+
+struct SlotMapRegistry {
+    void* Register(HandleType type, void* wrapper) {
+        return databento_native::CreateValidatedHandle(type, wrapper);
+    }
+    void Unregister(void* handle) { databento_native::DestroyValidatedHandle(handle); }
+    void* Lookup(void* handle, HandleType expected_type) {
+        ValidationError error;
+        return databento_native::ValidateAndCast<void>(handle, expected_type, &error);
+    }
+};
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "Usage: handle-registry-bench [--handles N] [--lookups N] [--threads N] [--runs N]\n"
+        "  --handles N  Live handles shared by the readers (default: 64)\n"
+        "  --lookups N  Validations per reader thread per run (default: 5000000)\n"
+        "  --threads N  Maximum reader threads (default: hardware concurrency)\n"
+        "  --runs N     Runs per configuration; the best is reported (default: 3)\n");
+}
+
+bool ParseCount(const char* text, uint64_t* value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (!end || *end != '\0' || end == text) {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+// Seconds for `threads` readers to each validate `lookups` handles
+template <typename Registry>
+double Run(Registry& registry, const std::vector<void*>& handles, unsigned threads, uint64_t lookups) {
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> hits{0};
+
+    // Churn: create and destroy handles alongside the readers
+    static int churn_wrapper = 0;
+    std::thread churn([&] {
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        while (!stop.load(std::memory_order_acquire)) {
+            registry.Unregister(registry.Register(HandleType::Metadata, &churn_wrapper));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            uint64_t local = 0;
+            size_t i = t;
+            for (uint64_t n = 0; n < lookups; ++n) {
+                local += registry.Lookup(handles[i], HandleType::DbnFileReader) != nullptr;
+                i = i + 1 == handles.size() ? 0 : i + 1;
+            }
+            hits.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    stop.store(true, std::memory_order_release);
+    churn.join();
+
+    if (hits.load() != lookups * threads) {
+        throw std::runtime_error("a live handle failed validation");
+    }
+    return seconds;
+}
+
+template <typename Registry>
+double Best(Registry& registry, unsigned threads, uint64_t handle_count, uint64_t lookups, uint64_t runs) {
+    static int wrapper = 0;
+    std::vector<void*> handles;
+    for (uint64_t i = 0; i < handle_count; ++i) {
+        handles.push_back(registry.Register(HandleType::DbnFileReader, &wrapper));
+    }
+    double best = 0;
+    for (uint64_t run = 0; run < runs; ++run) {
+        double seconds = Run(registry, handles, threads, lookups);
+        if (run == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    for (void* handle : handles) {
+        registry.Unregister(handle);
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    uint64_t handle_count = 64;
+    uint64_t lookups = 5'000'000;
+    uint64_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t runs = 3;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--handles" || arg == "--lookups" || arg == "--threads" || arg == "--runs") && i + 1 < argc) {
+            uint64_t* target = arg == "--handles" ? &handle_count
+                             : arg == "--lookups" ? &lookups
+                             : arg == "--threads" ? &max_threads
+                                                  : &runs;
+            if (!ParseCount(argv[++i], target) || *target == 0) {
+                PrintUsage();
+                return 2;
+            }
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    try {
+        MutexRegistry mutex_registry;
+        SlotMapRegistry slot_map_registry;
+        std::printf("%llu handles, %llu validations per thread, plus one create/destroy thread\n",
+                    static_cast<unsigned long long>(handle_count), static_cast<unsigned long long>(lookups));
+        std::printf("%-8s %16s %16s %9s\n", "threads", "mutex ns/op", "slot map ns/op", "speedup");
+        for (uint64_t threads = 1; threads <= max_threads; threads *= 2) {
+            double ops = static_cast<double>(lookups);
+            double mutex_seconds =
+                Best(mutex_registry, static_cast<unsigned>(threads), handle_count, lookups, runs);
+            double slot_map_seconds =
+                Best(slot_map_registry, static_cast<unsigned>(threads), handle_count, lookups, runs);
+            std::printf("%-8llu %16.1f %16.1f %8.1fx\n", static_cast<unsigned long long>(threads),
+                        mutex_seconds * 1e9 / ops, slot_map_seconds * 1e9 / ops, mutex_seconds / slot_map_seconds);
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Lookup throughput of databento::TsSymbolMap against the flat map behind the C API
+//
+// Usage: symbol-map-bench [--instruments N] [--days N] [--lookups N] [--runs N] [file]
+//
+// Without a file the maps are built from synthetic mappings: sparse instrument IDs
+// whose symbols roll every 30 days, looked up at random timestamps. With a DBN file
+// the maps come from its metadata and the lookups are the (ts_event, instrument_id)
+// pairs of its first records. Each TsSymbolMap lookup includes the timestamp to
+// calendar date conversion its callers have to do. The time to open a snapshot of
+// the flat map is reported alongside the time to build it.
+
+#include "flat_ts_symbol_map.hpp"
+#include "symbol_map_snapshot.hpp"
+#include <databento/dbn_decoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/log.hpp>
+#include <databento/symbol_map.hpp>
+#include <date/date.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace db = databento;
+using databento_native::FlatTsSymbolMap;
+
+namespace {
+
+struct Lookup {
+    uint64_t ts_event;
+    uint32_t instrument_id;
+};
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "Usage: symbol-map-bench [--instruments N] [--days N] [--lookups N] [--runs N] [file]\n"
+        "  --instruments N  Synthetic instruments (default: 10000)\n"
+        "  --days N         Synthetic days of mappings (default: 250)\n"
+        "  --lookups N      Lookups per run (default: 10000000)\n"
+        "  --runs N         Runs per map; the best is reported (default: 3)\n"
+        "  file             DBN file whose metadata and records drive the benchmark\n");
+}
+
+bool ParseCount(const char* text, uint64_t* value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (!end || *end != '\0' || end == text) {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+constexpr date::sys_days kSyntheticStart = date::sys_days{date::year{2024} / 1 / 1};
+
+db::TsSymbolMap SyntheticMap(uint64_t instruments, uint64_t days) {
+    db::TsSymbolMap map;
+    for (uint64_t i = 0; i < instruments; ++i) {
+        // Spread IDs out the way option chains are
+        auto instrument_id = static_cast<uint32_t>(1000 + i * 97);
+        for (uint64_t day = 0; day < days; day += 30) {
+            date::sys_days start = kSyntheticStart + date::days{day};
+            date::sys_days end = kSyntheticStart + date::days{std::min<uint64_t>(day + 30, days)};
+            map.Insert(instrument_id, date::year_month_day{start}, date::year_month_day{end},
+                       std::make_shared<const std::string>("S" + std::to_string(i) + "." + std::to_string(day / 30)));
+        }
+    }
+    return map;
+}
+
+std::vector<Lookup> SyntheticLookups(uint64_t instruments, uint64_t days, uint64_t count) {
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<uint64_t> instrument(0, instruments - 1);
+    std::uniform_int_distribution<uint64_t> offset(0, days * databento_native::kNanosPerDay - 1);
+    auto start = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(kSyntheticStart.time_since_epoch()).count());
+    std::vector<Lookup> lookups(count);
+    for (Lookup& lookup : lookups) {
+        lookup.ts_event = start + offset(rng);
+        lookup.instrument_id = static_cast<uint32_t>(1000 + instrument(rng) * 97);
+    }
+    return lookups;
+}
+
+db::TsSymbolMap FileMap(const std::filesystem::path& path, uint64_t count, std::vector<Lookup>* lookups) {
+    db::DbnDecoder decoder{db::ILogReceiver::Default(), std::make_unique<db::InFileStream>(path),
+                           db::VersionUpgradePolicy::UpgradeToV3};
+    db::Metadata metadata = decoder.DecodeMetadata();
+    while (lookups->size() < count) {
+        const db::Record* record = decoder.DecodeRecord();
+        if (!record) {
+            break;
+        }
+        const db::RecordHeader& header = record->Header();
+        lookups->push_back({static_cast<uint64_t>(header.ts_event.time_since_epoch().count()),
+                            header.instrument_id});
+    }
+    return db::TsSymbolMap{metadata};
+}
+
+template <typename F>
+double BestSeconds(uint64_t runs, F&& run) {
+    double best = 0;
+    for (uint64_t i = 0; i < runs; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    uint64_t instruments = 10'000;
+    uint64_t days = 250;
+    uint64_t lookup_count = 10'000'000;
+    uint64_t runs = 3;
+    std::filesystem::path path;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "--instruments" || arg == "--days" || arg == "--lookups" || arg == "--runs") && i + 1 < argc) {
+            uint64_t* target = arg == "--instruments" ? &instruments
+                             : arg == "--days"        ? &days
+                             : arg == "--lookups"     ? &lookup_count
+                                                      : &runs;
+            if (!ParseCount(argv[++i], target) || *target == 0) {
+                PrintUsage();
+                return 2;
+            }
+        } else if (arg.rfind("-", 0) == 0 || !path.empty()) {
+            PrintUsage();
+            return 2;
+        } else {
+            path = arg;
+        }
+    }
+
+    try {
+        std::vector<Lookup> lookups;
+        db::TsSymbolMap source = path.empty() ? SyntheticMap(instruments, days) : FileMap(path, lookup_count, &lookups);
+        if (path.empty()) {
+            lookups = SyntheticLookups(instruments, days, lookup_count);
+        }
+        if (lookups.empty()) {
+            std::fprintf(stderr, "error: no records to look up\n");
+            return 1;
+        }
+
+        auto build_start = std::chrono::steady_clock::now();
+        FlatTsSymbolMap flat{source};
+        double build_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - build_start).count();
+        std::printf("%zu mappings, %zu symbols, %zu lookups (flat map built in %.3f s)\n", source.Size(),
+                    flat.SymbolCount(), lookups.size(), build_seconds);
+
+        std::filesystem::path snapshot = std::filesystem::temp_directory_path() / "symbol-map-bench.snapshot";
+        databento_native::SaveSnapshot(flat, snapshot);
+        double load_seconds = BestSeconds(runs, [&] { databento_native::LoadTsSnapshot(snapshot); });
+        std::printf("snapshot: %llu bytes, opened in %.3f ms\n",
+                    static_cast<unsigned long long>(std::filesystem::file_size(snapshot)), load_seconds * 1e3);
+        std::filesystem::remove(snapshot);
+
+        uint64_t tree_hits = 0;
+        double tree_seconds = BestSeconds(runs, [&] {
+            tree_hits = 0;
+            for (const Lookup& lookup : lookups) {
+                date::year_month_day ymd{date::floor<date::days>(
+                    std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>{
+                        std::chrono::nanoseconds{lookup.ts_event}})};
+                auto it = source.Find(ymd, lookup.instrument_id);
+                tree_hits += it != source.Map().end();
+            }
+        });
+
+        uint64_t flat_hits = 0;
+        double flat_seconds = BestSeconds(runs, [&] {
+            flat_hits = 0;
+            for (const Lookup& lookup : lookups) {
+                flat_hits += flat.FindTs(lookup.ts_event, lookup.instrument_id) >= 0;
+            }
+        });
+
+        double count = static_cast<double>(lookups.size());
+        std::printf("%-12s %8.3f s %14.0f lookups/s %10.1f ns/lookup %12llu hits\n", "TsSymbolMap", tree_seconds,
+                    count / tree_seconds, tree_seconds * 1e9 / count, static_cast<unsigned long long>(tree_hits));
+        std::printf("%-12s %8.3f s %14.0f lookups/s %10.1f ns/lookup %12llu hits\n", "flat", flat_seconds,
+                    count / flat_seconds, flat_seconds * 1e9 / count, static_cast<unsigned long long>(flat_hits));
+        if (tree_hits != flat_hits) {
+            std::fprintf(stderr, "error: maps disagree\n");
+            return 1;
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
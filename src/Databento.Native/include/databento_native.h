@@ -28,8 +28,13 @@ typedef void* DbentoTsSymbolMapHandle;
 typedef void* DbentoPitSymbolMapHandle;
 typedef void* DbnFileReaderHandle;
 typedef void* DbnFileWriterHandle;
+typedef void* DbnMmapReaderHandle;
+typedef void* DbnMergeReaderHandle;
+typedef void* DbnColumnarReaderHandle;
+typedef void* DbnTranscoderHandle;
 typedef void* DbentoSymbologyResolutionHandle;
 typedef void* DbentoUnitPricesHandle;
+typedef void* DbentoReplayHandle;
 
 // ============================================================================
 // Callback Types
@@ -73,6 +78,21 @@ typedef void (*MetadataCallback)(
     void* user_data
 );
 
+/**
+ * Callback for a contiguous run of records
+ * Records are packed back-to-back; each begins with its RecordHeader (length field is in 4-byte units)
+ * @param records Pointer to the first record (valid only for the duration of the callback)
+ * @param total_length Total length of all records in bytes
+ * @param record_count Number of records in the run
+ * @param user_data User-provided context pointer
+ */
+typedef void (*RecordBatchCallback)(
+    const uint8_t* records,
+    size_t total_length,
+    size_t record_count,
+    void* user_data
+);
+
 // ============================================================================
 // Live Client API
 // ============================================================================
@@ -238,12 +258,34 @@ DATABENTO_API int dbento_live_subscribe_with_snapshot(
  */
 DATABENTO_API int dbento_live_get_connection_state(DbentoLiveClientHandle handle);
 
+/**
+ * Write received records to a CSV or JSON lines file
+ * Records are formatted on the receive thread before the record callback and
+ * written in blocks, at least every 100 ms. With map_symbols, symbols come from the
+ * session's symbol mapping records. Requires the UpgradeToV3 upgrade policy. A write
+ * failure detaches the output and is reported through the error callback (code -997).
+ * @param handle Live client handle
+ * @param output_path Path to output file (overwritten), or NULL/empty to detach
+ * @param options_json Text options as for dbento_dbn_transcode (NULL or empty = defaults)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on failure
+ */
+DATABENTO_API int dbento_live_set_text_output(
+    DbentoLiveClientHandle handle,
+    const char* output_path,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 // ============================================================================
 // Historical Client API
 // ============================================================================
 
 /**
  * Create a historical data client
+ * The handle is safe for concurrent use; calls share a pool of up to 4 connections
  * @param api_key Databento API key (required)
  * @param error_buffer Buffer for error messages (can be NULL)
  * @param error_buffer_size Size of error buffer
@@ -255,6 +297,27 @@ DATABENTO_API DbentoHistoricalClientHandle dbento_historical_create(
     size_t error_buffer_size
 );
 
+/**
+ * Create a historical data client backed by a configurable connection pool
+ * The handle is safe for concurrent use from any number of threads; each call leases
+ * one pooled client and calls beyond pool_size wait for a free one
+ * @param api_key Databento API key (required)
+ * @param pool_size Maximum number of pooled clients (1-256)
+ * @param idle_timeout_ms Close clients idle longer than this (0 = keep indefinitely)
+ * @param prewarm_count Number of connections to open before returning (0 = lazy)
+ * @param error_buffer Buffer for error messages (can be NULL)
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to historical client, or NULL on failure (including a failed pre-warm request)
+ */
+DATABENTO_API DbentoHistoricalClientHandle dbento_historical_create_pooled(
+    const char* api_key,
+    size_t pool_size,
+    int64_t idle_timeout_ms,
+    size_t prewarm_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Query historical time series data
  * @param handle Historical client handle
@@ -567,6 +630,9 @@ DATABENTO_API const char* dbento_metadata_get_billing_info(
 
 /**
  * Create a timeseries symbol map from metadata
+ * The map stores each instrument's mappings as runs of days in flat arrays, so
+ * lookups by (date or timestamp, instrument ID) take constant time and the map is
+ * safe to query from several threads.
  * @param metadata_handle Metadata handle to create symbol map from
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
@@ -632,6 +698,147 @@ DATABENTO_API int dbento_ts_symbol_map_find(
     size_t symbol_buffer_size
 );
 
+/**
+ * Find symbol in timeseries symbol map by event timestamp
+ * Same as dbento_ts_symbol_map_find for the UTC date of ts_event, without the
+ * caller converting the timestamp to a calendar date.
+ * @param handle TsSymbolMap handle
+ * @param ts_event Timestamp in nanoseconds since the UNIX epoch
+ * @param instrument_id Instrument ID to look up
+ * @param symbol_buffer Buffer to receive symbol string
+ * @param symbol_buffer_size Size of symbol buffer
+ * @return 0 on success, -1 on error, -2 if not found
+ */
+DATABENTO_API int dbento_ts_symbol_map_find_ts(
+    DbentoTsSymbolMapHandle handle,
+    uint64_t ts_event,
+    uint32_t instrument_id,
+    char* symbol_buffer,
+    size_t symbol_buffer_size
+);
+
+/**
+ * Find symbols for many (timestamp, instrument ID) pairs in one call
+ * Each found symbol is written as an index into the map's symbol table, which is
+ * fetched with dbento_ts_symbol_map_get_symbols. Indices are stable for the life of
+ * the map, so callers cache the table and only fetch entries they haven't seen.
+ * @param handle TsSymbolMap handle
+ * @param ts_events Timestamps in nanoseconds since the UNIX epoch (UTC date is used)
+ * @param instrument_ids Instrument IDs to look up
+ * @param count Number of entries in each array (at most INT_MAX)
+ * @param symbol_indices Receives a symbol table index per entry, or -1 if not found
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of entries found, or -1 on error
+ */
+DATABENTO_API int dbento_ts_symbol_map_find_bulk(
+    DbentoTsSymbolMapHandle handle,
+    const uint64_t* ts_events,
+    const uint32_t* instrument_ids,
+    size_t count,
+    int32_t* symbol_indices,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Find the instrument ID mapped to a symbol on a date (reverse lookup)
+ * The reverse index is built on the first reverse lookup and shared by later ones.
+ * If several instruments map to the symbol that day, the one whose mapping starts
+ * first is returned.
+ * @param handle TsSymbolMap handle
+ * @param year Year
+ * @param month Month (1-12)
+ * @param day Day (1-31)
+ * @param symbol Symbol to look up
+ * @param instrument_id Receives the instrument ID
+ * @return 0 on success, -1 on error, -2 if not found
+ */
+DATABENTO_API int dbento_ts_symbol_map_find_instrument_id(
+    DbentoTsSymbolMapHandle handle,
+    int year,
+    unsigned int month,
+    unsigned int day,
+    const char* symbol,
+    uint32_t* instrument_id
+);
+
+/**
+ * Find instrument IDs for many (timestamp, symbol) pairs in one call
+ * Each timestamp selects its UTC date, as in dbento_ts_symbol_map_find_ts.
+ * @param handle TsSymbolMap handle
+ * @param ts_events Event timestamps in nanoseconds since the UNIX epoch
+ * @param symbols Symbols, one per timestamp
+ * @param count Number of entries (at most INT_MAX)
+ * @param instrument_ids Receives an instrument ID per entry, or -1 if not found
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of entries found, or -1 on error
+ */
+DATABENTO_API int dbento_ts_symbol_map_find_instrument_ids(
+    DbentoTsSymbolMapHandle handle,
+    const uint64_t* ts_events,
+    const char* const* symbols,
+    size_t count,
+    int64_t* instrument_ids,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Copy the symbol table used by dbento_ts_symbol_map_find_bulk
+ * Symbols from first_index on are written back to back, each NUL-terminated. Call
+ * with a NULL buffer to get the required size.
+ * @param handle TsSymbolMap handle
+ * @param first_index First table index to copy
+ * @param buffer Buffer to receive the symbols (may be NULL)
+ * @param buffer_size Size of buffer
+ * @param symbol_count Receives the number of symbols from first_index on (may be NULL)
+ * @param required_size Receives the bytes needed to copy them (may be NULL)
+ * @return 0 on success, -1 on error, -3 if the buffer is too small (nothing copied)
+ */
+DATABENTO_API int dbento_ts_symbol_map_get_symbols(
+    DbentoTsSymbolMapHandle handle,
+    size_t first_index,
+    char* buffer,
+    size_t buffer_size,
+    size_t* symbol_count,
+    size_t* required_size
+);
+
+/**
+ * Write a timeseries symbol map snapshot
+ * The snapshot holds sorted instrument IDs, their day intervals and a string pool in
+ * a fixed binary layout. It is written to "<file_path>.tmp" and renamed over
+ * file_path, so readers never see a partial file.
+ * @param handle TsSymbolMap handle
+ * @param file_path Path of the snapshot file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on error
+ */
+DATABENTO_API int dbento_ts_symbol_map_save(
+    DbentoTsSymbolMapHandle handle,
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a timeseries symbol map snapshot written by dbento_ts_symbol_map_save
+ * The file is memory-mapped read-only and lookups read it in place, so processes
+ * loading the same snapshot share its pages. The mapping is released with the handle.
+ * @param file_path Path of the snapshot file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return TsSymbolMap handle, or NULL if the file is missing or not a valid snapshot
+ */
+DATABENTO_API DbentoTsSymbolMapHandle dbento_ts_symbol_map_load(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Destroy timeseries symbol map and free resources
  * @param handle TsSymbolMap handle
@@ -667,8 +874,102 @@ DATABENTO_API int dbento_pit_symbol_map_find(
     size_t symbol_buffer_size
 );
 
+/**
+ * Find the interned symbol ID for an instrument
+ * Symbol IDs are stable: an ID always names the same symbol, so the string can be
+ * fetched once with dbento_pit_symbol_map_get_symbols and cached. Instruments
+ * sharing a symbol share its ID.
+ * @param handle PitSymbolMap handle
+ * @param instrument_id Instrument ID to look up
+ * @param symbol_id Receives the symbol ID
+ * @return 0 on success, -1 on error, -2 if not found
+ */
+DATABENTO_API int dbento_pit_symbol_map_find_id(
+    DbentoPitSymbolMapHandle handle,
+    uint32_t instrument_id,
+    uint32_t* symbol_id
+);
+
+/**
+ * Find interned symbol IDs for many instrument IDs in one call
+ * See dbento_pit_symbol_map_find_id; IDs are below 2^31.
+ * @param handle PitSymbolMap handle
+ * @param instrument_ids Instrument IDs to look up
+ * @param count Number of instrument IDs (at most INT_MAX)
+ * @param symbol_ids Receives a symbol ID per entry, or -1 if not found
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of entries found, or -1 on error
+ */
+DATABENTO_API int dbento_pit_symbol_map_find_bulk(
+    DbentoPitSymbolMapHandle handle,
+    const uint32_t* instrument_ids,
+    size_t count,
+    int32_t* symbol_ids,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Find the instrument ID currently mapped to a symbol (reverse lookup)
+ * The reverse index is updated with every change to the map. If several instruments
+ * map to the symbol, the most recently mapped one is returned.
+ * @param handle PitSymbolMap handle
+ * @param symbol Symbol to look up
+ * @param instrument_id Receives the instrument ID
+ * @return 0 on success, -1 on error, -2 if not found
+ */
+DATABENTO_API int dbento_pit_symbol_map_find_instrument_id(
+    DbentoPitSymbolMapHandle handle,
+    const char* symbol,
+    uint32_t* instrument_id
+);
+
+/**
+ * Find instrument IDs for many symbols in one call
+ * @param handle PitSymbolMap handle
+ * @param symbols Symbols to look up
+ * @param count Number of symbols (at most INT_MAX)
+ * @param instrument_ids Receives an instrument ID per symbol, or -1 if not found
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of symbols found, or -1 on error
+ */
+DATABENTO_API int dbento_pit_symbol_map_find_instrument_ids(
+    DbentoPitSymbolMapHandle handle,
+    const char* const* symbols,
+    size_t count,
+    int64_t* instrument_ids,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Copy the symbols for a set of symbol IDs
+ * Symbols are written back to back in the order of symbol_ids, each NUL-terminated;
+ * IDs whose symbol has been evicted yield an empty string. Call with a NULL buffer
+ * to get the required size.
+ * @param handle PitSymbolMap handle
+ * @param symbol_ids Symbol IDs to copy
+ * @param count Number of symbol IDs
+ * @param buffer Buffer to receive the symbols (may be NULL)
+ * @param buffer_size Size of buffer
+ * @param required_size Receives the bytes needed (may be NULL)
+ * @return 0 on success, -1 on error, -3 if the buffer is too small (nothing copied)
+ */
+DATABENTO_API int dbento_pit_symbol_map_get_symbols(
+    DbentoPitSymbolMapHandle handle,
+    const int32_t* symbol_ids,
+    size_t count,
+    char* buffer,
+    size_t buffer_size,
+    size_t* required_size
+);
+
 /**
  * Update point-in-time symbol map from a record (for live data)
+ * SymbolMappingMsg (any DBN version) and current-version InstrumentDefMsg records
+ * update the map; other records are ignored. The record is read in place.
  * @param handle PitSymbolMap handle
  * @param record_bytes Raw record data (DBN format)
  * @param record_length Length of record in bytes
@@ -680,6 +981,71 @@ DATABENTO_API int dbento_pit_symbol_map_on_record(
     size_t record_length
 );
 
+/**
+ * Update point-in-time symbol map from a batch of records (for live data)
+ * Records are laid out back to back, each as long as the length in its header, and
+ * are read in place under a single lock. Only SymbolMappingMsg and InstrumentDefMsg
+ * records update the map; the rest are skipped on their rtype. If the buffer is
+ * malformed, the records before the bad one have already been applied.
+ * @param handle PitSymbolMap handle
+ * @param records Raw record data (DBN format)
+ * @param length Total length of the records in bytes
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of records that updated the map, or -1 on error
+ */
+DATABENTO_API int64_t dbento_pit_symbol_map_on_records(
+    DbentoPitSymbolMapHandle handle,
+    const uint8_t* records,
+    size_t length,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Remove instruments whose mapping has expired
+ * A mapping expires at the end of its SymbolMappingMsg interval or at its
+ * InstrumentDefMsg expiration; mappings built from metadata never expire. Symbols no
+ * longer used by any instrument are freed.
+ * @param handle PitSymbolMap handle
+ * @param now_ns Current time in nanoseconds since the UNIX epoch
+ * @return Number of instruments removed, or -1 on error
+ */
+DATABENTO_API int64_t dbento_pit_symbol_map_evict_expired(
+    DbentoPitSymbolMapHandle handle,
+    uint64_t now_ns
+);
+
+/**
+ * Write a point-in-time symbol map snapshot, including when each mapping expires
+ * Written to "<file_path>.tmp" and renamed over file_path.
+ * @param handle PitSymbolMap handle
+ * @param file_path Path of the snapshot file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on error
+ */
+DATABENTO_API int dbento_pit_symbol_map_save(
+    DbentoPitSymbolMapHandle handle,
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Create a point-in-time symbol map from a snapshot written by dbento_pit_symbol_map_save
+ * The map keeps accepting updates, so the snapshot is read into it and unmapped.
+ * @param file_path Path of the snapshot file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return PitSymbolMap handle, or NULL if the file is missing or not a valid snapshot
+ */
+DATABENTO_API DbentoPitSymbolMapHandle dbento_pit_symbol_map_load(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Destroy point-in-time symbol map and free resources
  * @param handle PitSymbolMap handle
@@ -786,6 +1152,7 @@ DATABENTO_API const char* dbento_batch_download_file(
 
 /**
  * Open a DBN file for reading
+ * Multi-frame zstd files are decompressed in parallel with an automatic thread count
  * @param file_path Path to the DBN file
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
@@ -797,6 +1164,72 @@ DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open(
     size_t error_buffer_size
 );
 
+/**
+ * Open a DBN file with control over parallel decompression
+ * zstd files made of several independent frames are decompressed on worker threads
+ * and records are still returned in file order; other files are decoded on the calling thread
+ * @param file_path Path to DBN file (.dbn or .dbn.zst)
+ * @param decompression_threads Worker threads for multi-frame zstd (0 = automatic, 1 = disabled)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_ex(
+    const char* file_path,
+    int decompression_threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a DBN file with a record filter evaluated natively before records are handed out
+ * The filter is a JSON object; every key is optional and all present conditions must hold:
+ *   "start" / "end"    ts_event window in ns (start inclusive, end exclusive)
+ *   "instrument_ids"   array of instrument IDs to keep
+ *   "rtypes"           array of record types to keep
+ *   "min_price" / "max_price"  inclusive fixed-point (1e-9) price bounds
+ *   "min_size"         minimum size (OHLCV: volume, statistics: quantity)
+ *   "side" / "action"  single-character side or action
+ * Records lacking a tested field don't match. Current-version (v3) files are scanned raw and
+ * dbento_dbn_file_next_records evaluates runs of same-type records in a vectorizable loop.
+ * @param file_path Path to DBN file (.dbn or .dbn.zst)
+ * @param decompression_threads Worker threads for multi-frame zstd (0 = automatic, 1 = disabled)
+ * @param filter_json Filter specification
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_filtered(
+    const char* file_path,
+    int decompression_threads,
+    const char* filter_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a DBN file with reads issued ahead of the decoder
+ * The file is read front to back into queue_depth buffers of buffer_size bytes; while
+ * records are decoded from one buffer, reads for the next ones are in flight. On Linux
+ * the reads go through io_uring when the kernel permits it, otherwise (and on other
+ * platforms) a read-ahead thread fills the buffers. Useful on cold page caches, NVMe
+ * and network filesystems. Multi-frame zstd files are not decompressed in parallel in
+ * this mode; reads after a seek or instrument selection use the memory mapping.
+ * @param file_path Path to DBN file (.dbn or .dbn.zst)
+ * @param buffer_size Bytes per read (0 = 4 MiB, otherwise at least 4096)
+ * @param queue_depth Buffers in flight (0 = 4, at most 256)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_prefetched(
+    const char* file_path,
+    size_t buffer_size,
+    size_t queue_depth,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Get metadata from a DBN file
  * @param handle DBN file reader handle
@@ -832,64 +1265,840 @@ DATABENTO_API int dbento_dbn_file_next_record(
 );
 
 /**
- * Close a DBN file and free resources
+ * Read as many whole records as fit into a buffer in one call
+ * Records are packed back-to-back; a record that doesn't fit is kept for the next call
  * @param handle DBN file reader handle
+ * @param record_buffer Buffer to receive packed record data
+ * @param record_buffer_size Size of record buffer
+ * @param record_offsets Output: byte offset of each record within record_buffer
+ * @param max_records Capacity of record_offsets
+ * @param record_count Output: number of records written
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 on EOF, -3 if the buffer can't hold the next record, other negative on error
  */
-DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle);
-
-// ============================================================================
-// DBN File Writer API
-// ============================================================================
+DATABENTO_API int dbento_dbn_file_next_records(
+    DbnFileReaderHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
 
 /**
- * Create a DBN file writer for writing records
- * @param file_path Path where the DBN file will be created
- * @param metadata_json JSON string containing DBN metadata
+ * Position the reader at the first record whose ts_event is at or after a timestamp
+ * Uses the `<file>.idx` sidecar index, building it first if it is missing or stale
+ * (files of 64 MiB or more start building it in the background on open).
+ * The reader jumps to the nearest checkpoint and decodes forward from there.
+ * @param handle DBN file reader handle
+ * @param ts_event_ns Target timestamp in nanoseconds since the Unix epoch
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
- * @return Handle to DBN file writer, or NULL on failure
+ * @return 0 on success, 1 if no record is at or after the timestamp, negative on error
  */
-DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create(
-    const char* file_path,
-    const char* metadata_json,
+DATABENTO_API int dbento_dbn_file_seek_time(
+    DbnFileReaderHandle handle,
+    int64_t ts_event_ns,
     char* error_buffer,
     size_t error_buffer_size
 );
 
 /**
- * Write a record to a DBN file
- * @param handle DBN file writer handle
- * @param record_bytes Raw record data (DBN format)
- * @param record_length Length of record in bytes
+ * Restrict the reader to records of the given instruments
+ * Uses the per-instrument block postings in the `<file>.idx` sidecar (built if missing),
+ * so only blocks containing a selected instrument are decompressed and decoded.
+ * Reading restarts from the beginning of the file; dbento_dbn_file_seek_time
+ * then seeks within the selection.
+ * @param handle DBN file reader handle
+ * @param instrument_ids Instrument IDs to keep
+ * @param instrument_count Number of IDs (0 = clear the selection and read every record)
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
  * @return 0 on success, negative on error
  */
-DATABENTO_API int dbento_dbn_file_write_record(
-    DbnFileWriterHandle handle,
-    const uint8_t* record_bytes,
-    size_t record_length,
+DATABENTO_API int dbento_dbn_file_select_instruments(
+    DbnFileReaderHandle handle,
+    const uint32_t* instrument_ids,
+    size_t instrument_count,
     char* error_buffer,
     size_t error_buffer_size
 );
 
 /**
- * Close and finalize a DBN file writer
- * @param handle DBN file writer handle
+ * Get selectivity counters for the filter given to dbento_dbn_file_open_filtered
+ * @param handle DBN file reader handle
+ * @param records_scanned Output: records evaluated by the filter (0 without a filter)
+ * @param records_passed Output: records that matched
+ * @return 0 on success, -1 on error
  */
-DATABENTO_API void dbento_dbn_file_close_writer(DbnFileWriterHandle handle);
+DATABENTO_API int dbento_dbn_file_get_filter_stats(
+    DbnFileReaderHandle handle,
+    uint64_t* records_scanned,
+    uint64_t* records_passed
+);
+
+/**
+ * Get how the reader gets bytes from disk
+ * @param handle DBN file reader handle
+ * @return 0 = synchronous reads, 1 = read-ahead thread, 2 = io_uring, -1 on error
+ */
+DATABENTO_API int dbento_dbn_file_get_io_backend(DbnFileReaderHandle handle);
+
+/**
+ * Close a DBN file and free resources
+ * @param handle DBN file reader handle
+ */
+DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle);
 
 // ============================================================================
-// Symbology Resolution API
+// DBN Index API
 // ============================================================================
 
 /**
- * Resolve symbols from one symbology type to another over a date range
- * @param handle Historical client handle
- * @param dataset Dataset name (e.g., "GLBX.MDP3")
- * @param symbols Array of symbol strings to resolve
- * @param symbol_count Number of symbols in array
- * @param stype_in Input symbology type (e.g., "raw_symbol", "instrument_id")
+ * Build (or rebuild) the sparse index sidecar for a DBN file
+ * A checkpoint is taken every record_interval records or byte_interval
+ * decompressed bytes, whichever comes first; the blocks between checkpoints
+ * also get per-instrument postings. The sidecar is written atomically.
+ * @param file_path Path to DBN file (.dbn or .dbn.zst)
+ * @param record_interval Records between checkpoints (0 = no record limit)
+ * @param byte_interval Bytes between checkpoints (0 = no byte limit; both 0 = defaults)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Number of checkpoints written, or -1 on error
+ */
+DATABENTO_API int64_t dbento_dbn_build_index(
+    const char* file_path,
+    uint64_t record_interval,
+    uint64_t byte_interval,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// Memory-Mapped DBN Reader API
+// ============================================================================
+
+/**
+ * Open an uncompressed DBN file through a read-only memory mapping
+ * Record pointers returned by this API point directly into the mapping and stay
+ * valid until the reader is closed. Records are returned as stored, so the file must
+ * be in the current DBN version (see dbento_dbn_upgrade).
+ * @param file_path Path to an uncompressed DBN file
+ * @param access_hint 0 = normal, 1 = sequential, 2 = random, 3 = will need (prefetch whole file)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to mapped reader, or NULL on failure (including zstd-compressed or older-version input)
+ */
+DATABENTO_API DbnMmapReaderHandle dbento_dbn_mmap_open(
+    const char* file_path,
+    int access_hint,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get metadata from a mapped DBN file as JSON
+ * @param handle Handle to mapped reader
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_mmap_get_metadata(
+    DbnMmapReaderHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Borrow the next record from the mapping without copying
+ * @param handle Handle to mapped reader
+ * @param record Receives a pointer to the record inside the mapping
+ * @param record_length Receives the record length in bytes
+ * @param record_type Receives the record type
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 on EOF, negative on error (-3 on a truncated record)
+ */
+DATABENTO_API int dbento_dbn_mmap_next_record(
+    DbnMmapReaderHandle handle,
+    const uint8_t** record,
+    size_t* record_length,
+    uint8_t* record_type,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Borrow a contiguous run of whole records from the mapping without copying
+ * @param handle Handle to mapped reader
+ * @param max_bytes Maximum total length of the run in bytes
+ * @param max_records Maximum number of records in the run
+ * @param records Receives a pointer to the first record inside the mapping
+ * @param total_length Receives the total length of the run in bytes
+ * @param record_count Receives the number of records in the run
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 on EOF, negative on error (-4 if the next record exceeds max_bytes)
+ */
+DATABENTO_API int dbento_dbn_mmap_borrow_records(
+    DbnMmapReaderHandle handle,
+    size_t max_bytes,
+    size_t max_records,
+    const uint8_t** records,
+    size_t* total_length,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get the entire record section of the mapping (everything after the metadata)
+ * @param handle Handle to mapped reader
+ * @param records Receives a pointer to the first record
+ * @param total_length Receives the length of the record section in bytes
+ * @return 0 on success, -1 on error
+ */
+DATABENTO_API int dbento_dbn_mmap_get_records(
+    DbnMmapReaderHandle handle,
+    const uint8_t** records,
+    size_t* total_length
+);
+
+/**
+ * Get the read position as a byte offset into the record section
+ * @param handle Handle to mapped reader
+ * @return Offset in bytes, or -1 on error
+ */
+DATABENTO_API int64_t dbento_dbn_mmap_tell(DbnMmapReaderHandle handle);
+
+/**
+ * Move the read position to a byte offset into the record section
+ * The offset must be a record boundary (e.g. a value previously returned by dbento_dbn_mmap_tell)
+ * @param handle Handle to mapped reader
+ * @param offset Offset in bytes from the first record
+ * @return 0 on success, -2 if the offset is out of range or misaligned, -1 on error
+ */
+DATABENTO_API int dbento_dbn_mmap_seek(DbnMmapReaderHandle handle, size_t offset);
+
+/**
+ * Advise the kernel about the access pattern for part of the record section
+ * @param handle Handle to mapped reader
+ * @param access_hint 0 = normal, 1 = sequential, 2 = random, 3 = will need
+ * @param offset Offset in bytes from the first record
+ * @param length Length of the range in bytes (SIZE_MAX for the rest of the file)
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_mmap_advise(
+    DbnMmapReaderHandle handle,
+    int access_hint,
+    size_t offset,
+    size_t length
+);
+
+/**
+ * Close a mapped reader and unmap the file
+ * All pointers previously returned by the reader become invalid
+ * @param handle Handle to mapped reader
+ */
+DATABENTO_API void dbento_dbn_mmap_close(DbnMmapReaderHandle handle);
+
+// ============================================================================
+// DBN Merge Reader API
+// ============================================================================
+
+/**
+ * Open several DBN files for reading as one stream in timestamp order
+ * Records are upgraded to DBN v3. Records with equal timestamps are returned
+ * in the order their files were given. Files are decompressed and decoded ahead
+ * of the merge on a pool of worker threads shared by all inputs.
+ * @param file_paths Array of paths to DBN files (plain or zstd-compressed)
+ * @param file_count Number of files
+ * @param order_by 0 = ts_event, 1 = ts_recv (ts_event for schemas without ts_recv)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to merge reader, or NULL on failure
+ */
+DATABENTO_API DbnMergeReaderHandle dbento_dbn_merge_open(
+    const char** file_paths,
+    size_t file_count,
+    int order_by,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get metadata of one input file as JSON
+ * @param handle Handle to merge reader
+ * @param file_index Index of the file in the array passed to dbento_dbn_merge_open
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_merge_get_metadata(
+    DbnMergeReaderHandle handle,
+    size_t file_index,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Read the next batch of records in merge order
+ * @param handle Handle to merge reader
+ * @param record_buffer Buffer receiving the records back to back
+ * @param record_buffer_size Size of record buffer
+ * @param record_offsets Receives the offset of each record in record_buffer
+ * @param source_indices Receives the input file index of each record (may be NULL)
+ * @param max_records Capacity of record_offsets and source_indices
+ * @param record_count Receives the number of records read
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 on EOF, -3 if the next record doesn't fit, other negative on error
+ */
+DATABENTO_API int dbento_dbn_merge_next_records(
+    DbnMergeReaderHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    uint32_t* source_indices,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Close a merge reader and all of its input files
+ * @param handle Handle to merge reader
+ */
+DATABENTO_API void dbento_dbn_merge_close(DbnMergeReaderHandle handle);
+
+// ============================================================================
+// DBN Aggregation API
+// ============================================================================
+
+/**
+ * Summarize DBN files on a worker pool
+ * Files are split at index checkpoints (using the .idx sidecar; uncompressed files
+ * get one built) and each worker aggregates its share into thread-local tables,
+ * which are merged at the end. Records are upgraded to DBN v3 before aggregation.
+ *
+ * Spec (all keys optional):
+ * {"group_by": ["instrument_id", "publisher_id", "bucket"], "bucket_ns": n,
+ *  "filter": {...same form as dbento_dbn_file_open_filtered...}, "quantiles": [0.5, 0.99]}
+ *
+ * The result is a column-oriented table:
+ * {"row_count": n, "records_scanned": n, "records_passed": n, "columns": {
+ *   "instrument_id", "publisher_id", "bucket_start" (grouping keys in use),
+ *   "count", "volume", "notional", "vwap", "open", "high", "low", "close",
+ *   "first_ts", "last_ts", "spread_count", "spread_mean", "spread_min", "spread_max",
+ *   "price_quantiles": [{"q": 0.5, "values": [..]}]}}
+ * count covers every record passing the filter. volume, notional, vwap, open/high/
+ * low/close, first_ts/last_ts and the price quantiles cover trades only: records with
+ * action 'T' (trades, MBP-1/10, CMBP-1/TCBBO and MBO trade events). Book updates,
+ * MBO fills, BBO snapshots, OHLCV bars and statistics don't contribute to them.
+ * Prices are fixed-point (1e-9) and null for groups without a trade; notional is in
+ * price units. Spreads come from top-of-book bid/ask levels.
+ * @param file_paths Array of paths to DBN files (plain or zstd-compressed)
+ * @param file_count Number of files
+ * @param spec_json Aggregation spec (NULL or empty = one group over all records)
+ * @param threads Worker threads (0 = hardware concurrency)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_aggregate(
+    const char** file_paths,
+    size_t file_count,
+    const char* spec_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Columnar Export API
+// ============================================================================
+
+/**
+ * Export DBN files to columnar files, one file per input and record type
+ * Each input <name>.dbn[.zst] produces <output_dir>/<name>.<schema>.dbnc for every
+ * supported record type it contains (MBO, trades, MBP-1/10, BBO, CMBP-1, TCBBO, CBBO,
+ * OHLCV, statistics, status); other records are skipped and counted. Records are
+ * upgraded to DBN v3 first. Files are exported in parallel, one per worker.
+ *
+ * Columns are stored in row groups; each column chunk is encoded by kind, then
+ * compressed with zstd independently: timestamps as delta-of-delta zigzag varints,
+ * prices and IDs as delta zigzag varints, sizes as zigzag varints and enums/flags
+ * as a dictionary with bit-packed codes. The footer holds the schema, the source
+ * file's metadata and per-chunk min/max statistics. Outputs are written under a
+ * temporary name and renamed when complete.
+ *
+ * Options (all keys optional):
+ * {"row_group_size": rows, "compression_level": 1-22, "compression": "zstd" | "none"}
+ *
+ * The result lists the outputs:
+ * {"rows_exported": n, "records_skipped": n, "files": [{"input": path, "records": n,
+ *   "records_skipped": n, "outputs": [{"path", "schema", "rows", "row_groups", "bytes"}]}]}
+ * @param file_paths Array of paths to DBN files (plain or zstd-compressed)
+ * @param file_count Number of files
+ * @param output_dir Existing directory for the columnar files
+ * @param options_json Export options (NULL or empty = defaults)
+ * @param threads Worker threads (0 = hardware concurrency)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_columnar_export(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a columnar file written by dbento_dbn_columnar_export
+ * The file is memory-mapped; only the footer is read up front.
+ * @param file_path Path to the .dbnc file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to columnar reader, or NULL on failure
+ */
+DATABENTO_API DbnColumnarReaderHandle dbento_dbn_columnar_open(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get the layout of a columnar file as JSON
+ * {"rtype", "schema", "row_count", "metadata": {...source DBN metadata...},
+ *  "columns": [{"name", "width", "signed", "encoding"}],
+ *  "row_groups": [{"first_row", "rows", "columns": [{"min", "max", "encoding",
+ *                  "encoded_size", "stored_size"}]}]}
+ * @param handle Columnar reader handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_columnar_get_schema(
+    DbnColumnarReaderHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Decode one column of one row group
+ * Values are written back to back, `width` bytes each in the record's native
+ * representation (little-endian integers, fixed-point prices, raw enum bytes).
+ * @param handle Columnar reader handle
+ * @param row_group Row group index
+ * @param column Column index
+ * @param values Output buffer
+ * @param values_size Size of output buffer in bytes
+ * @param row_count Output: rows in the row group (also set when the buffer is too small)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on error, -2 on invalid parameters, -3 if the buffer is too small
+ */
+DATABENTO_API int dbento_dbn_columnar_read_column(
+    DbnColumnarReaderHandle handle,
+    size_t row_group,
+    size_t column,
+    uint8_t* values,
+    size_t values_size,
+    size_t* row_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Close a columnar file and free resources
+ * @param handle Columnar reader handle
+ */
+DATABENTO_API void dbento_dbn_columnar_close(DbnColumnarReaderHandle handle);
+
+// ============================================================================
+// DBN Split API
+// ============================================================================
+
+/**
+ * Split DBN files into one file per instrument, UTC date and/or schema
+ * Each input <name>.dbn[.zst] is read once and its records are written to
+ * <output_dir>/[<schema>/][<instrument_id>/][<YYYYMMDD>/]<name>.dbn[.zst], keeping
+ * the input's DBN version and record order. Dates come from each record's index
+ * timestamp (ts_recv where the schema has one, ts_event otherwise). When splitting
+ * by schema, control records (symbol mappings, errors, system messages) are skipped
+ * and counted.
+ *
+ * Every output gets its own metadata header: start/end are clipped to the output's
+ * date, and symbols and mappings are narrowed to the instruments it contains.
+ * Records are buffered per output and compressed into independent zstd frames on
+ * the worker threads, so outputs can be decompressed in parallel. Outputs are
+ * written under a temporary name and renamed when complete.
+ *
+ * Options (all keys optional):
+ * {"partition_by": ["instrument", "date", "schema"] (default ["instrument", "date"]),
+ *  "compression": "zstd" | "none", "compression_level": 1-22,
+ *  "chunk_size": bytes buffered per output before compression (default 1 MiB),
+ *  "max_buffered_bytes": memory cap for buffered records (default 256 MiB),
+ *  "max_open_files": open output files (default 256)}
+ *
+ * The result lists the outputs:
+ * {"records": n, "records_skipped": n, "files": [{"input": path, "records": n,
+ *   "records_skipped": n, "outputs": [{"path", "instrument_id", "date", "schema",
+ *   "records", "bytes"}]}]}
+ * Keys that were not split on are null.
+ * @param file_paths Array of paths to DBN files (plain or zstd-compressed)
+ * @param file_count Number of files
+ * @param output_dir Existing directory for the outputs
+ * @param options_json Split options (NULL or empty = defaults)
+ * @param threads Compression threads (0 = hardware concurrency)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_split(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Text Transcode API
+// ============================================================================
+
+/**
+ * Transcode a DBN file to CSV or JSON lines
+ * Records are upgraded to the current DBN version and formatted natively: integers
+ * and fixed-point prices without locale or iostream formatting. CSV output has one
+ * column set, taken from the first record with a known layout; records of other types
+ * are skipped and counted. JSON output writes one object per line for every record
+ * type, nesting header fields under "hd" and quoting 64-bit integers.
+ *
+ * With more than one thread, uncompressed or frame-indexed files are formatted in
+ * index blocks on worker threads and written in file order. Files without an index,
+ * and symbol mapping from in-stream symbol mapping records, use a single thread.
+ *
+ * Options (all keys optional):
+ * {"encoding": "csv" | "json" (default "csv"), "pretty_px": bool (prices as decimals),
+ *  "pretty_ts": bool (timestamps as ISO 8601), "map_symbols": bool (append a symbol
+ *  column from the file's mappings), "header": bool (CSV header row, default true)}
+ *
+ * Result: {"records": n, "records_written": n, "records_skipped": n, "bytes": n,
+ *          "parallel": bool}
+ * @param input_path Path to DBN file (plain or zstd-compressed)
+ * @param output_path Path to output text file (replaced only once the transcode succeeds)
+ * @param options_json Text options (NULL or empty = defaults)
+ * @param threads Worker threads (0 = hardware concurrency, 1 = sequential)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_transcode(
+    const char* input_path,
+    const char* output_path,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a DBN file for reading as CSV or JSON text
+ * @param file_path Path to DBN file (plain or zstd-compressed)
+ * @param options_json Text options as for dbento_dbn_transcode (NULL or empty = defaults)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to transcoder, or NULL on failure
+ */
+DATABENTO_API DbnTranscoderHandle dbento_dbn_transcoder_open(
+    const char* file_path,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Read the next bytes of text
+ * Text is produced as it is read; lines may be split across calls.
+ * @param handle Transcoder handle
+ * @param buffer Output buffer
+ * @param buffer_size Size of output buffer
+ * @param bytes_written Output: bytes written to the buffer
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 at end of file, -1 on error, -2 on invalid parameters
+ */
+DATABENTO_API int dbento_dbn_transcoder_read(
+    DbnTranscoderHandle handle,
+    char* buffer,
+    size_t buffer_size,
+    size_t* bytes_written,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Close a transcoder and free resources
+ * @param handle Transcoder handle
+ */
+DATABENTO_API void dbento_dbn_transcoder_close(DbnTranscoderHandle handle);
+
+// ============================================================================
+// DBN Upgrade API
+// ============================================================================
+
+/**
+ * Re-encode DBN files at the current DBN version
+ * Files are upgraded in parallel, one file per worker. When there are fewer files
+ * than threads, the remaining threads decompress and compress the frames of each
+ * file. Compressed outputs are written as independent zstd frames, so they can be
+ * decompressed in parallel.
+ *
+ * Each output is written under a temporary name, read back to check its version and
+ * record count against the input, and renamed into place. Without output_dir the
+ * input is replaced; an input whose name changes with its compression is removed.
+ * A failed file is left untouched and reported; the other files continue.
+ *
+ * Options (all keys optional):
+ * {"compression": "keep" | "zstd" | "none" (default "keep"), "compression_level": 1-22,
+ *  "frame_size": uncompressed bytes per zstd frame (default 4 MiB),
+ *  "index": "auto" (rebuild when the input has one) | "always" | "never",
+ *  "force": bool (re-encode files already at the current version)}
+ *
+ * Result:
+ * {"upgraded": n, "skipped": n, "failed": n, "records": n,
+ *  "files": [{"input", "output", "status": "upgraded" | "skipped" | "failed",
+ *             "from_version", "records", "bytes", "indexed", "error"}]}
+ * @param file_paths Array of paths to DBN files (plain or zstd-compressed)
+ * @param file_count Number of files
+ * @param output_dir Existing directory for the outputs, or NULL/empty to upgrade in place
+ * @param options_json Upgrade options (NULL or empty = defaults)
+ * @param threads Worker threads (0 = hardware concurrency)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_dbn_upgrade(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN File Writer API
+// ============================================================================
+
+/**
+ * Create a DBN file writer for writing records
+ * @param file_path Path where the DBN file will be created
+ * @param metadata_json JSON string containing DBN metadata
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file writer, or NULL on failure
+ */
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create(
+    const char* file_path,
+    const char* metadata_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Create a DBN file writer with optional zstd compression
+ * Compressed output is written as independent frames so readers can decompress it in parallel
+ * @param file_path Path where the DBN file will be created
+ * @param metadata_json JSON string containing DBN metadata
+ * @param compression 0 = none, 1 = zstd
+ * @param compression_level zstd compression level (ignored when uncompressed)
+ * @param frame_size Uncompressed bytes per zstd frame (0 = default of 4 MiB)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file writer, or NULL on failure
+ */
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_ex(
+    const char* file_path,
+    const char* metadata_json,
+    int compression,
+    int compression_level,
+    size_t frame_size,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Create a DBN file writer that compresses and writes on a background thread
+ * Writes copy records into a bounded single-producer queue and return without
+ * touching the disk; they block only while the queue is full. A background thread
+ * compresses the queued bytes into independent zstd frames, optionally on several
+ * worker threads, and writes them. Only one thread may write to the handle at a time.
+ * Errors on the background thread are returned by the next write, flush or close.
+ *
+ * Options (all keys optional):
+ * {"compression": "zstd" | "none" (default "zstd"), "compression_level": 1-22 (default 3),
+ *  "frame_size": uncompressed bytes per frame (default 4 MiB),
+ *  "compression_threads": n (default 1, compressing on the writer thread),
+ *  "queue_size": queue capacity in bytes (default 64 MiB)}
+ * @param file_path Path to output file
+ * @param metadata_json Metadata as JSON, as for dbento_dbn_file_create
+ * @param options_json Writer options (NULL or empty = defaults)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file writer, or NULL on failure
+ */
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_async(
+    const char* file_path,
+    const char* metadata_json,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open an existing DBN file to append records to it
+ * The file must be in the current DBN version (see dbento_dbn_upgrade). Writing
+ * resumes after the last complete record, so a file cut short by a crash is
+ * continued from a clean boundary and the partial tail is dropped. Zstd files are
+ * appended to as zstd in new frames; existing frames are left in place, except that
+ * a final frame ending mid-record is replaced by one holding its complete records.
+ * Such in-place changes go through a journal next to the file (<file>.patch), so a
+ * crash never loses records that were on disk; the journal is applied by the next
+ * open. A corrupt zstd frame before the end of the file is an error and the file is
+ * left untouched.
+ *
+ * On close the header's end timestamp (unless undefined) and limit (unless 0) are
+ * raised to cover the appended records. Symbols and mappings from metadata_json are
+ * merged into the header when it encodes to the same length; otherwise the file's
+ * symbol lists are kept. Compressed headers are rewritten by compressing the first
+ * frame again, padded with a skippable frame when it comes out smaller.
+ *
+ * Options (all keys optional):
+ * {"compression_level": 1-22 (default 3), "frame_size": uncompressed bytes per frame,
+ *  "async": true to write on a background thread as dbento_dbn_file_create_async,
+ *  "compression_threads": n, "queue_size": bytes}
+ * @param file_path Path to an existing DBN file, zstd-compressed or not
+ * @param metadata_json Metadata as for dbento_dbn_file_create, which must match the
+ *        file's dataset, schema, stype_in, stype_out and ts_out (NULL = keep the header)
+ * @param options_json Writer options (NULL or empty = defaults)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file writer, or NULL on failure
+ */
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_open_append(
+    const char* file_path,
+    const char* metadata_json,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Write a record to a DBN file
+ * record_length must match the length in the record header.
+ * @param handle DBN file writer handle
+ * @param record_bytes Raw record data (DBN format)
+ * @param record_length Length of record in bytes
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_write_record(
+    DbnFileWriterHandle handle,
+    const uint8_t* record_bytes,
+    size_t record_length,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Write a batch of records to a DBN file
+ * Records are laid out back to back, each as long as the length in its header. The
+ * whole buffer is validated before anything is written, then written straight from
+ * the caller's memory in one call.
+ * @param handle DBN file writer handle
+ * @param records Raw record data (DBN format)
+ * @param length Total length of the records in bytes
+ * @param count Number of records in the buffer
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error (nothing is written if the buffer is malformed)
+ */
+DATABENTO_API int dbento_dbn_file_write_records(
+    DbnFileWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Wait until everything written so far has left the writer
+ * For writers created with dbento_dbn_file_create_async this is a barrier: it
+ * returns once all queued records are compressed and handed to the OS (sync = 0),
+ * or written to stable storage (sync != 0). The current zstd frame is ended early.
+ * For other writers a flush is a no-op and sync is an error.
+ * @param handle DBN file writer handle
+ * @param sync Also wait for the file to reach stable storage
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on error
+ */
+DATABENTO_API int dbento_dbn_file_flush(
+    DbnFileWriterHandle handle,
+    int sync,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Close and finalize a DBN file writer
+ * Errors while finishing the file are ignored; use dbento_dbn_file_close_writer_ex to observe them.
+ * @param handle DBN file writer handle
+ */
+DATABENTO_API void dbento_dbn_file_close_writer(DbnFileWriterHandle handle);
+
+/**
+ * Close and finalize a DBN file writer, reporting whether the file was finished
+ * Compresses and writes the last frame, surfacing any error from the background writer
+ * of an asynchronous writer (e.g. disk full), and updates the header of an appended
+ * file. The handle is released even when an error is returned.
+ * @param handle DBN file writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 if the file could not be finished or the handle is invalid
+ */
+DATABENTO_API int dbento_dbn_file_close_writer_ex(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// Symbology Resolution API
+// ============================================================================
+
+/**
+ * Resolve symbols from one symbology type to another over a date range
+ * @param handle Historical client handle
+ * @param dataset Dataset name (e.g., "GLBX.MDP3")
+ * @param symbols Array of symbol strings to resolve
+ * @param symbol_count Number of symbols in array
+ * @param stype_in Input symbology type (e.g., "raw_symbol", "instrument_id")
  * @param stype_out Output symbology type (e.g., "raw_symbol", "continuous")
  * @param start_date Start date in YYYY-MM-DD format (inclusive)
  * @param end_date End date in YYYY-MM-DD format (exclusive)
@@ -1119,6 +2328,176 @@ DATABENTO_API void dbento_unit_prices_destroy(
     DbentoUnitPricesHandle handle
 );
 
+// ============================================================================
+// Replay API
+// ============================================================================
+
+/**
+ * Create a replay over one or more local DBN files
+ * Files are replayed back-to-back in the given order and decoded ahead of delivery on background threads
+ * @param file_paths Array of DBN file paths (zstd-compressed or uncompressed)
+ * @param file_count Number of file paths
+ * @param pacing_mode 0 = as fast as possible, 1 = real time by ts_event, 2 = real time by ts_recv
+ * @param speed Playback speed multiplier for real-time pacing (1.0 = real time, 10.0 = 10x)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to replay, or NULL on failure
+ */
+DATABENTO_API DbentoReplayHandle dbento_replay_create(
+    const char** file_paths,
+    size_t file_count,
+    int pacing_mode,
+    double speed,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get the metadata of one replay file as JSON
+ * @param handle Handle to replay
+ * @param file_index Index into the file list passed to dbento_replay_create
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON string (must be freed with dbento_free_string), or NULL on failure
+ */
+DATABENTO_API const char* dbento_replay_get_metadata(
+    DbentoReplayHandle handle,
+    size_t file_index,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Start delivering records one at a time on a background thread (live-client style)
+ * @param handle Handle to replay
+ * @param on_metadata Callback invoked when each file starts (can be NULL)
+ * @param on_record Callback invoked for each record
+ * @param on_error Callback invoked on errors (can be NULL)
+ * @param user_data User context pointer passed to callbacks
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error (-3 if already started)
+ */
+DATABENTO_API int dbento_replay_start(
+    DbentoReplayHandle handle,
+    MetadataCallback on_metadata,
+    RecordCallback on_record,
+    ErrorCallback on_error,
+    void* user_data,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Start delivering records in batches on a background thread
+ * Each batch holds records that are already due and points directly into the decode buffer
+ * @param handle Handle to replay
+ * @param on_metadata Callback invoked when each file starts (can be NULL)
+ * @param on_batch Callback invoked for each batch of records
+ * @param max_batch_records Maximum records per batch
+ * @param on_error Callback invoked on errors (can be NULL)
+ * @param user_data User context pointer passed to callbacks
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error (-3 if already started)
+ */
+DATABENTO_API int dbento_replay_start_batched(
+    DbentoReplayHandle handle,
+    MetadataCallback on_metadata,
+    RecordBatchCallback on_batch,
+    size_t max_batch_records,
+    ErrorCallback on_error,
+    void* user_data,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Pull the next due records into a caller-provided buffer (alternative to callbacks)
+ * Blocks until at least one record is due or the timeout elapses
+ * @param handle Handle to replay
+ * @param record_buffer Buffer to receive packed records
+ * @param record_buffer_size Size of record buffer in bytes
+ * @param record_offsets Array receiving the byte offset of each record in record_buffer
+ * @param max_records Capacity of record_offsets
+ * @param record_count Receives the number of records written (0 on timeout)
+ * @param timeout_ms Maximum time to wait in milliseconds (negative = wait indefinitely)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 when replay is finished or stopped, negative on error
+ */
+DATABENTO_API int dbento_replay_next_records(
+    DbentoReplayHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    int timeout_ms,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Pause delivery
+ * @param handle Handle to replay
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_replay_pause(DbentoReplayHandle handle);
+
+/**
+ * Resume delivery; real-time pacing re-anchors at the next record
+ * @param handle Handle to replay
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_replay_resume(DbentoReplayHandle handle);
+
+/**
+ * Release a number of records while paused
+ * @param handle Handle to replay
+ * @param record_count Number of records to release
+ * @return 0 on success, -2 if not paused, -1 on error
+ */
+DATABENTO_API int dbento_replay_step(DbentoReplayHandle handle, size_t record_count);
+
+/**
+ * Seek to the first record at or after a timestamp (in the pacing timestamp, ts_event by default)
+ * A finished replay resumes delivery from the target
+ * @param handle Handle to replay
+ * @param timestamp_ns Target timestamp in nanoseconds since Unix epoch
+ * @return 0 on success, -3 if the replay has been stopped, negative on error
+ */
+DATABENTO_API int dbento_replay_seek(DbentoReplayHandle handle, int64_t timestamp_ns);
+
+/**
+ * Change the playback speed multiplier
+ * @param handle Handle to replay
+ * @param speed New speed multiplier (must be positive)
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_replay_set_speed(DbentoReplayHandle handle, double speed);
+
+/**
+ * Get the replay state
+ * @param handle Handle to replay
+ * @return 0 = idle, 1 = running, 2 = paused, 3 = finished, 4 = error, 5 = stopped, -1 on invalid handle
+ */
+DATABENTO_API int dbento_replay_get_state(DbentoReplayHandle handle);
+
+/**
+ * Stop delivery (the replay cannot be restarted)
+ * @param handle Handle to replay
+ */
+DATABENTO_API void dbento_replay_stop(DbentoReplayHandle handle);
+
+/**
+ * Destroy a replay and free resources
+ * Blocks until the delivery thread exits. When called from inside a replay callback, no further
+ * callbacks are made once it returns and the replay is freed as the delivery thread exits.
+ * @param handle Handle to replay
+ */
+DATABENTO_API void dbento_replay_destroy(DbentoReplayHandle handle);
+
 // ============================================================================
 // Memory Management
 // ============================================================================
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "zstd_frame_io.hpp"
+#include <databento/iwritable.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace databento_native {
+
+// Default capacity of the queue between producer and writer thread
+constexpr size_t kDefaultAsyncQueueSize = 64 * 1024 * 1024;
+
+/**
+ * Buffered output file that can be forced to stable storage
+ */
+class SyncableFile : public databento::IWritable {
+public:
+    enum class Mode {
+        Create,  // Start a new, empty file
+        Append,  // Keep the existing contents and write after them
+        Update   // Keep the existing contents and write at any offset (see Seek)
+    };
+
+    explicit SyncableFile(const std::filesystem::path& path, Mode mode = Mode::Create)
+        : path_(path)
+    {
+#ifdef _WIN32
+        file_ = ::_wfopen(path.c_str(), mode == Mode::Append ? L"ab" : mode == Mode::Update ? L"r+b" : L"wb");
+#else
+        file_ = std::fopen(path.c_str(), mode == Mode::Append ? "ab" : mode == Mode::Update ? "r+b" : "wb");
+#endif
+        if (!file_) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+        std::setvbuf(file_, nullptr, _IOFBF, kBufferSize);
+    }
+
+    ~SyncableFile() override {
+        if (file_) {
+            std::fclose(file_);
+        }
+    }
+
+    SyncableFile(const SyncableFile&) = delete;
+    SyncableFile& operator=(const SyncableFile&) = delete;
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        if (std::fwrite(buffer, 1, length, file_) != length) {
+            throw std::runtime_error("Failed to write " + path_.string());
+        }
+    }
+
+    // Move the write position; only meaningful in Mode::Update
+    void Seek(uint64_t offset) {
+#ifdef _WIN32
+        int result = ::_fseeki64(file_, static_cast<__int64>(offset), SEEK_SET);
+#else
+        int result = ::fseeko(file_, static_cast<off_t>(offset), SEEK_SET);
+#endif
+        if (result != 0) {
+            throw std::runtime_error("Failed to seek in " + path_.string());
+        }
+    }
+
+    // Hand buffered bytes to the OS
+    void Flush() {
+        if (std::fflush(file_) != 0) {
+            throw std::runtime_error("Failed to write " + path_.string());
+        }
+    }
+
+    // Flush and wait until the OS has written the file to disk
+    void Sync() {
+        Flush();
+#ifdef _WIN32
+        int result = ::_commit(::_fileno(file_));
+#else
+        int result = ::fsync(::fileno(file_));
+#endif
+        if (result != 0) {
+            throw std::runtime_error("Failed to sync " + path_.string());
+        }
+    }
+
+    void Close() {
+        std::FILE* file = file_;
+        file_ = nullptr;
+        if (std::fclose(file) != 0) {
+            throw std::runtime_error("Failed to write " + path_.string());
+        }
+    }
+
+private:
+    static constexpr size_t kBufferSize = 1024 * 1024;
+
+    std::filesystem::path path_;
+    std::FILE* file_ = nullptr;
+};
+
+/**
+ * IWritable that hands bytes to a background thread, which compresses and writes them
+ *
+ * The producer copies bytes into a single-producer single-consumer ring and publishes
+ * them with one atomic store, so WriteAll costs a memcpy unless the ring is full. The
+ * writer thread drains the ring into independent zstd frames (compressed on worker
+ * threads when more than one is configured) and a buffered file. Flush() and Sync()
+ * are barriers: they return once everything written before them has reached the OS,
+ * or stable storage.
+ *
+ * Only one thread may write at a time. A failure on the writer thread is rethrown by
+ * the next WriteAll, Flush, Sync or Close.
+ */
+class AsyncFileWritable : public databento::IWritable {
+public:
+    struct Options {
+        bool compress = true;
+        int zstd_level = 3;
+        size_t frame_size = kDefaultZstdFrameSize;
+        size_t compression_threads = 1;  // 1 = compress on the writer thread
+        size_t queue_size = kDefaultAsyncQueueSize;
+        bool append = false;  // Write after the existing contents of the file
+    };
+
+    AsyncFileWritable(const std::filesystem::path& path, const Options& options)
+        : file_(path, options.append ? SyncableFile::Mode::Append : SyncableFile::Mode::Create)
+    {
+        size_t capacity = 1;
+        while (capacity < std::max<size_t>(options.queue_size, 64 * 1024)) {
+            capacity <<= 1;
+        }
+        ring_.resize(capacity);
+        mask_ = capacity - 1;
+
+        if (options.compress && options.compression_threads > 1) {
+            parallel_zstd_ = std::make_unique<ParallelFramedZstdWritable>(
+                &file_, options.zstd_level, options.frame_size, options.compression_threads);
+        } else if (options.compress) {
+            zstd_ = std::make_unique<FramedZstdWritable>(&file_, options.zstd_level, options.frame_size);
+        }
+        writer_ = std::thread([this]() { WriterLoop(); });
+    }
+
+    ~AsyncFileWritable() override {
+        try {
+            Close();
+        }
+        catch (...) {
+            // Destructors must not throw; call Close() explicitly to observe errors
+        }
+    }
+
+    AsyncFileWritable(const AsyncFileWritable&) = delete;
+    AsyncFileWritable& operator=(const AsyncFileWritable&) = delete;
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        if (failed_.load(std::memory_order_relaxed)) {
+            ThrowIfFailed();
+        }
+        const size_t capacity = ring_.size();
+        while (length > 0) {
+            size_t free = capacity - static_cast<size_t>(tail_ - cached_head_);
+            if (free == 0) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                free = capacity - static_cast<size_t>(tail_ - cached_head_);
+                if (free == 0) {
+                    WaitForSpace();
+                    continue;
+                }
+            }
+            size_t n = std::min(length, free);
+            size_t pos = static_cast<size_t>(tail_) & mask_;
+            size_t first = std::min(n, capacity - pos);
+            std::memcpy(ring_.data() + pos, buffer, first);
+            std::memcpy(ring_.data(), buffer + first, n - first);
+            tail_ += n;
+            published_tail_.store(tail_, std::memory_order_release);
+            buffer += n;
+            length -= n;
+        }
+        if (writer_idle_.load(std::memory_order_relaxed)) {
+            data_cv_.notify_one();
+        }
+    }
+
+    /**
+     * Wait until every byte written so far has been compressed and handed to the OS
+     * The current zstd frame is ended early, so frequent flushes cost compression ratio.
+     */
+    void Flush() { Barrier(false); }
+
+    // Flush, then wait until the file is on stable storage
+    void Sync() { Barrier(true); }
+
+    /**
+     * Drain the queue, write the last frame and close the file
+     */
+    void Close() {
+        if (!writer_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        data_cv_.notify_one();
+        writer_.join();
+        ThrowIfFailed();
+    }
+
+private:
+    void ThrowIfFailed() {
+        if (failed_.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::rethrow_exception(error_);
+        }
+    }
+
+    void WaitForSpace() {
+        ThrowIfFailed();
+        data_cv_.notify_one();
+        std::this_thread::yield();
+    }
+
+    void Barrier(bool sync) {
+        ThrowIfFailed();
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!writer_.joinable() || stopping_) {
+            throw std::runtime_error("Writer is closed");
+        }
+        uint64_t ticket = ++barrier_requested_;
+        sync_requested_ = sync_requested_ || sync;
+        data_cv_.notify_one();
+        barrier_cv_.wait(lock, [this, ticket]() {
+            return barrier_done_ >= ticket || failed_.load(std::memory_order_relaxed);
+        });
+        if (failed_.load(std::memory_order_relaxed)) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+    // Write [head, tail) of the ring; discards the bytes once the writer has failed
+    void Drain(uint64_t head, uint64_t tail) {
+        const size_t capacity = ring_.size();
+        while (head < tail) {
+            size_t pos = static_cast<size_t>(head) & mask_;
+            size_t n = std::min(static_cast<size_t>(tail - head), capacity - pos);
+            if (!failed_.load(std::memory_order_relaxed)) {
+                try {
+                    Output()->WriteAll(ring_.data() + pos, n);
+                }
+                catch (...) {
+                    Fail(std::current_exception());
+                }
+            }
+            head += n;
+            head_.store(head, std::memory_order_release);
+        }
+    }
+
+    databento::IWritable* Output() {
+        if (parallel_zstd_) {
+            return parallel_zstd_.get();
+        }
+        return zstd_ ? static_cast<databento::IWritable*>(zstd_.get()) : &file_;
+    }
+
+    void FinishFrame() {
+        if (parallel_zstd_) {
+            parallel_zstd_->Finish();
+        } else if (zstd_) {
+            zstd_->Finish();
+        }
+    }
+
+    void Fail(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) {
+                error_ = error;
+            }
+            failed_.store(true, std::memory_order_release);
+        }
+        barrier_cv_.notify_all();
+    }
+
+    void WriterLoop() {
+        uint64_t head = 0;
+        int idle_spins = 0;
+        while (true) {
+            uint64_t tail = published_tail_.load(std::memory_order_acquire);
+            if (tail != head) {
+                Drain(head, tail);
+                head = tail;
+                idle_spins = 0;
+                continue;
+            }
+
+            // Queue empty: serve barriers, stop, or wait for data
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Bytes published before a barrier or stop request are visible under the lock
+            if (published_tail_.load(std::memory_order_acquire) != head) {
+                continue;
+            }
+            if (barrier_requested_ > barrier_done_) {
+                uint64_t ticket = barrier_requested_;
+                bool sync = sync_requested_;
+                sync_requested_ = false;
+                lock.unlock();
+                if (!failed_.load(std::memory_order_relaxed)) {
+                    try {
+                        FinishFrame();
+                        if (sync) {
+                            file_.Sync();
+                        } else {
+                            file_.Flush();
+                        }
+                    }
+                    catch (...) {
+                        Fail(std::current_exception());
+                    }
+                }
+                lock.lock();
+                barrier_done_ = ticket;
+                lock.unlock();
+                barrier_cv_.notify_all();
+                continue;
+            }
+            if (stopping_) {
+                lock.unlock();
+                if (!failed_.load(std::memory_order_relaxed)) {
+                    try {
+                        FinishFrame();
+                        parallel_zstd_.reset();
+                        zstd_.reset();
+                        file_.Close();
+                    }
+                    catch (...) {
+                        Fail(std::current_exception());
+                    }
+                }
+                return;
+            }
+            if (++idle_spins < kIdleSpins) {
+                lock.unlock();
+                std::this_thread::yield();
+                continue;
+            }
+            // The timeout bounds the delay if a producer's wakeup races with going idle
+            writer_idle_.store(true, std::memory_order_relaxed);
+            data_cv_.wait_for(lock, std::chrono::milliseconds(1), [this, head]() {
+                return stopping_ || barrier_requested_ > barrier_done_ ||
+                       published_tail_.load(std::memory_order_acquire) != head;
+            });
+            writer_idle_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    static constexpr int kIdleSpins = 64;
+
+    SyncableFile file_;
+    // At most one is set; both are null when writing uncompressed
+    std::unique_ptr<FramedZstdWritable> zstd_;
+    std::unique_ptr<ParallelFramedZstdWritable> parallel_zstd_;
+    std::vector<std::byte> ring_;
+    size_t mask_ = 0;
+
+    // Producer side
+    alignas(64) uint64_t tail_ = 0;
+    uint64_t cached_head_ = 0;
+    // Shared, on separate cache lines
+    alignas(64) std::atomic<uint64_t> published_tail_{0};
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<bool> writer_idle_{false};
+    std::atomic<bool> failed_{false};
+
+    std::mutex mutex_;
+    std::condition_variable data_cv_;
+    std::condition_variable barrier_cv_;
+    uint64_t barrier_requested_ = 0;  // Guarded by mutex_
+    uint64_t barrier_done_ = 0;       // Guarded by mutex_
+    bool sync_requested_ = false;     // Guarded by mutex_
+    bool stopping_ = false;           // Guarded by mutex_
+    std::exception_ptr error_;        // Guarded by mutex_
+    std::thread writer_;
+};
+
+}  // namespace databento_native
@@ -1,6 +1,7 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
+#include "historical_client_wrapper.hpp"
 #include <databento/historical.hpp>
 #include <databento/batch.hpp>
 #include <databento/enums.hpp>
@@ -15,26 +16,13 @@
 namespace db = databento;
 using json = nlohmann::json;
 using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
 using databento_native::ParseSchema;
 using databento_native::NsToUnixNanos;
 using databento_native::ValidateNonEmptyString;
 using databento_native::ValidateSymbolArray;
 using databento_native::ValidateTimeRange;
 
-// ============================================================================
-// External Wrapper Structure (from historical_client_wrapper.cpp)
-// ============================================================================
-
-struct HistoricalClientWrapper {
-    std::unique_ptr<db::Historical> client;
-    std::string api_key;
-
-    explicit HistoricalClientWrapper(const std::string& key)
-        : api_key(key) {
-        client = std::make_unique<db::Historical>(nullptr, key, db::HistoricalGateway::Bo1);
-    }
-};
-
 // ============================================================================
 // Helper Functions (now in common_helpers.hpp)
 // ============================================================================
@@ -86,22 +74,6 @@ static json BatchFileDescToJson(const db::BatchFileDesc& file) {
     return j;
 }
 
-// Allocate a string that can be freed with dbento_free_string
-static char* AllocateString(const std::string& str) {
-    // Validate size to prevent overflow
-    if (str.size() > SIZE_MAX - 1) {
-        return nullptr;  // String too large
-    }
-
-    char* result = new char[str.size() + 1];
-
-    // Use memcpy instead of strcpy for safety
-    std::memcpy(result, str.c_str(), str.size());
-    result[str.size()] = '\0';
-
-    return result;
-}
-
 // ============================================================================
 // Batch API Implementation
 // ============================================================================
@@ -121,7 +93,7 @@ DATABENTO_API const char* dbento_batch_submit_job(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -152,7 +124,7 @@ DATABENTO_API const char* dbento_batch_submit_job(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Submit batch job with defaults
-        db::BatchJob job = wrapper->client->BatchSubmitJob(
+        db::BatchJob job = wrapper->pool->Acquire()->BatchSubmitJob(
             dataset,
             symbol_vec,
             schema_enum,
@@ -178,14 +150,14 @@ DATABENTO_API const char* dbento_batch_list_jobs(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
         }
 
         // List all batch jobs
-        std::vector<db::BatchJob> jobs = wrapper->client->BatchListJobs();
+        std::vector<db::BatchJob> jobs = wrapper->pool->Acquire()->BatchListJobs();
 
         // Convert to JSON array
         json j = json::array();
@@ -212,7 +184,7 @@ DATABENTO_API const char* dbento_batch_list_files(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -222,7 +194,7 @@ DATABENTO_API const char* dbento_batch_list_files(
         ValidateNonEmptyString("job_id", job_id);
 
         // List files for job
-        std::vector<db::BatchFileDesc> files = wrapper->client->BatchListFiles(job_id);
+        std::vector<db::BatchFileDesc> files = wrapper->pool->Acquire()->BatchListFiles(job_id);
 
         // Convert to JSON array
         json j = json::array();
@@ -250,7 +222,7 @@ DATABENTO_API const char* dbento_batch_download_all(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -262,7 +234,7 @@ DATABENTO_API const char* dbento_batch_download_all(
 
         // Download all files
         std::vector<std::filesystem::path> downloaded_paths =
-            wrapper->client->BatchDownload(std::filesystem::path{output_dir}, job_id);
+            wrapper->pool->Acquire()->BatchDownload(std::filesystem::path{output_dir}, job_id);
 
         // Convert to JSON array of strings
         json j = json::array();
@@ -291,7 +263,7 @@ DATABENTO_API const char* dbento_batch_download_file(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -304,7 +276,7 @@ DATABENTO_API const char* dbento_batch_download_file(
 
         // Download specific file
         std::filesystem::path downloaded_path =
-            wrapper->client->BatchDownload(std::filesystem::path{output_dir}, job_id, filename);
+            wrapper->pool->Acquire()->BatchDownload(std::filesystem::path{output_dir}, job_id, filename);
 
         std::string path_str = downloaded_path.string();
         return AllocateString(path_str);
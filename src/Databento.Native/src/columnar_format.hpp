@@ -0,0 +1,723 @@
+#pragma once
+
+#include "record_fields.hpp"
+#include <databento/record.hpp>
+#include <zstd.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+// Rows per row group, further limited so a row group's buffered records stay under kColumnarRowGroupBytes
+constexpr size_t kDefaultColumnarRowGroupRows = 1024 * 1024;
+constexpr size_t kColumnarRowGroupBytes = 64 * 1024 * 1024;
+constexpr int kDefaultColumnarZstdLevel = 3;
+// Distinct values a dictionary chunk can hold; chunks with more fall back to varints
+constexpr size_t kMaxColumnDictionarySize = 256;
+constexpr size_t kMaxVarintSize = 10;  // Bytes in a 64-bit LEB128 varint
+// Rows in a row group; keeps rows * kMaxVarintSize and rows * width from overflowing
+constexpr uint64_t kMaxRowGroupRows = UINT64_MAX / 16;
+
+/**
+ * One record field stored as a column
+ */
+struct ColumnSpec {
+    std::string name;
+    uint16_t offset = 0;  // Byte offset in the record
+    uint8_t width = 0;    // 1, 2, 4 or 8 bytes
+    bool is_signed = false;
+    ColumnEncoding encoding = ColumnEncoding::Plain;
+};
+
+/**
+ * Columns exported for one record type
+ */
+struct ColumnarSchema {
+    uint8_t rtype = 0;
+    std::string name;        // Databento schema name, e.g. "mbo", "mbp-10", "ohlcv-1m"
+    size_t record_size = 0;  // Bytes of the DBN v3 record, excluding ts_out
+    std::vector<ColumnSpec> columns;
+};
+
+namespace detail {
+
+inline ColumnSpec ColumnFor(const RecordField& field) {
+    return {field.name, field.offset, static_cast<uint8_t>(field.width), field.is_signed, field.encoding};
+}
+
+inline std::vector<ColumnarSchema> BuildColumnarSchemas() {
+    std::vector<ColumnarSchema> schemas;
+    for (unsigned rtype = 0; rtype < 256; ++rtype) {
+        const RecordLayout* layout = RecordLayoutFor(static_cast<uint8_t>(rtype));
+        if (!layout || !layout->columnar) {
+            continue;
+        }
+        ColumnarSchema schema{layout->rtype, layout->schema, layout->record_size, {}};
+        for (const RecordField& field : layout->fields) {
+            // The rtype is constant within a schema's file, so it is not stored
+            if (field.name == "rtype") {
+                continue;
+            }
+            schema.columns.push_back(ColumnFor(field));
+        }
+        schemas.push_back(std::move(schema));
+    }
+    return schemas;
+}
+
+}  // namespace detail
+
+/**
+ * Columnar layout for an rtype, or nullptr for record types without one
+ * (definitions, imbalance, and control records such as errors and symbol mappings)
+ */
+inline const ColumnarSchema* ColumnarSchemaFor(uint8_t rtype) {
+    static const std::vector<ColumnarSchema> schemas = detail::BuildColumnarSchemas();
+    static const std::array<const ColumnarSchema*, 256> by_rtype = []() {
+        std::array<const ColumnarSchema*, 256> table{};
+        for (const auto& schema : schemas) {
+            table[schema.rtype] = &schema;
+        }
+        return table;
+    }();
+    return by_rtype[rtype];
+}
+
+// ============================================================================
+// Value Encoding
+// ============================================================================
+
+/**
+ * Read a column value widened to 64 bits (sign-extended for signed columns)
+ */
+inline uint64_t LoadColumnValue(const uint8_t* src, uint8_t width, bool is_signed) {
+    switch (width) {
+        case 1: {
+            uint8_t value = *src;
+            return is_signed ? static_cast<uint64_t>(static_cast<int64_t>(static_cast<int8_t>(value))) : value;
+        }
+        case 2: {
+            uint16_t value;
+            std::memcpy(&value, src, sizeof(value));
+            return is_signed ? static_cast<uint64_t>(static_cast<int64_t>(static_cast<int16_t>(value))) : value;
+        }
+        case 4: {
+            uint32_t value;
+            std::memcpy(&value, src, sizeof(value));
+            return is_signed ? static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(value))) : value;
+        }
+        default: {
+            uint64_t value;
+            std::memcpy(&value, src, sizeof(value));
+            return value;
+        }
+    }
+}
+
+/**
+ * Write the low `width` bytes of a widened value (little-endian targets)
+ */
+inline void StoreColumnValue(uint8_t* dst, uint8_t width, uint64_t value) {
+    std::memcpy(dst, &value, width);
+}
+
+inline uint64_t ZigZagEncode(uint64_t value) {
+    return (value << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(value) >> 63);
+}
+
+inline uint64_t ZigZagDecode(uint64_t value) {
+    return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+inline void PutVarint(std::vector<uint8_t>* out, uint64_t value) {
+    while (value >= 0x80) {
+        out->push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out->push_back(static_cast<uint8_t>(value));
+}
+
+inline uint64_t GetVarint(const uint8_t** cursor, const uint8_t* end) {
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (*cursor == end) {
+            throw std::runtime_error("Truncated column chunk");
+        }
+        uint8_t byte = *(*cursor)++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error("Malformed varint in column chunk");
+}
+
+/**
+ * Encode widened column values
+ *
+ * Deltas are taken modulo 2^64, so sentinels such as UNDEF_PRICE and
+ * UNDEF_TIMESTAMP round-trip exactly. Dictionary chunks with more than
+ * kMaxColumnDictionarySize distinct values are written as varints instead.
+ * @return Encoding actually used
+ */
+inline ColumnEncoding EncodeColumnChunk(ColumnEncoding encoding, const std::vector<uint64_t>& values, uint8_t width,
+                                        std::vector<uint8_t>* out) {
+    out->clear();
+    if (encoding == ColumnEncoding::Dictionary) {
+        std::vector<uint64_t> dictionary = values;
+        std::sort(dictionary.begin(), dictionary.end());
+        dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+        if (dictionary.size() > kMaxColumnDictionarySize) {
+            encoding = ColumnEncoding::Varint;
+        } else {
+            auto count = static_cast<uint16_t>(dictionary.size());
+            out->resize(sizeof(count) + dictionary.size() * width + 1);
+            std::memcpy(out->data(), &count, sizeof(count));
+            for (size_t i = 0; i < dictionary.size(); ++i) {
+                StoreColumnValue(out->data() + sizeof(count) + i * width, width, dictionary[i]);
+            }
+            uint8_t bits = 0;
+            while ((size_t{1} << bits) < dictionary.size()) {
+                ++bits;
+            }
+            out->back() = bits;
+
+            uint64_t pending = 0;
+            unsigned pending_bits = 0;
+            uint64_t last_value = dictionary.empty() ? 0 : dictionary[0];
+            uint64_t last_code = 0;
+            for (uint64_t value : values) {
+                if (value != last_value) {
+                    last_code = static_cast<uint64_t>(
+                        std::lower_bound(dictionary.begin(), dictionary.end(), value) - dictionary.begin());
+                    last_value = value;
+                }
+                pending |= last_code << pending_bits;
+                pending_bits += bits;
+                while (pending_bits >= 8) {
+                    out->push_back(static_cast<uint8_t>(pending));
+                    pending >>= 8;
+                    pending_bits -= 8;
+                }
+            }
+            if (pending_bits > 0) {
+                out->push_back(static_cast<uint8_t>(pending));
+            }
+            return encoding;
+        }
+    }
+
+    switch (encoding) {
+        case ColumnEncoding::Plain:
+            out->resize(values.size() * width);
+            for (size_t i = 0; i < values.size(); ++i) {
+                StoreColumnValue(out->data() + i * width, width, values[i]);
+            }
+            break;
+        case ColumnEncoding::DeltaOfDelta: {
+            uint64_t previous = 0;
+            uint64_t previous_delta = 0;
+            for (uint64_t value : values) {
+                uint64_t delta = value - previous;
+                PutVarint(out, ZigZagEncode(delta - previous_delta));
+                previous = value;
+                previous_delta = delta;
+            }
+            break;
+        }
+        case ColumnEncoding::Delta: {
+            uint64_t previous = 0;
+            for (uint64_t value : values) {
+                PutVarint(out, ZigZagEncode(value - previous));
+                previous = value;
+            }
+            break;
+        }
+        default:
+            for (uint64_t value : values) {
+                PutVarint(out, ZigZagEncode(value));
+            }
+            break;
+    }
+    return encoding;
+}
+
+/**
+ * Decode a column chunk into `rows` fixed-width values
+ * @param out Destination of rows * width bytes
+ */
+inline void DecodeColumnChunk(ColumnEncoding encoding, const uint8_t* data, size_t size, size_t rows, uint8_t width,
+                              uint8_t* out) {
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    switch (encoding) {
+        case ColumnEncoding::Plain:
+            if (size != rows * width) {
+                throw std::runtime_error("Column chunk size mismatch");
+            }
+            std::memcpy(out, data, size);
+            return;
+        case ColumnEncoding::DeltaOfDelta: {
+            uint64_t value = 0;
+            uint64_t delta = 0;
+            for (size_t i = 0; i < rows; ++i) {
+                delta += ZigZagDecode(GetVarint(&cursor, end));
+                value += delta;
+                StoreColumnValue(out + i * width, width, value);
+            }
+            return;
+        }
+        case ColumnEncoding::Delta: {
+            uint64_t value = 0;
+            for (size_t i = 0; i < rows; ++i) {
+                value += ZigZagDecode(GetVarint(&cursor, end));
+                StoreColumnValue(out + i * width, width, value);
+            }
+            return;
+        }
+        case ColumnEncoding::Varint:
+            for (size_t i = 0; i < rows; ++i) {
+                StoreColumnValue(out + i * width, width, ZigZagDecode(GetVarint(&cursor, end)));
+            }
+            return;
+        case ColumnEncoding::Dictionary: {
+            uint16_t count;
+            if (size < sizeof(count)) {
+                throw std::runtime_error("Truncated column chunk");
+            }
+            std::memcpy(&count, data, sizeof(count));
+            size_t header_size = sizeof(count) + static_cast<size_t>(count) * width + 1;
+            if (count == 0 && rows > 0) {
+                throw std::runtime_error("Empty column dictionary");
+            }
+            if (size < header_size) {
+                throw std::runtime_error("Truncated column chunk");
+            }
+            const uint8_t* dictionary = data + sizeof(count);
+            uint8_t bits = data[header_size - 1];
+            if (bits > 8 || (size - header_size) * 8 < rows * bits) {
+                throw std::runtime_error("Truncated column chunk");
+            }
+            if (bits == 0) {
+                // Single-valued chunk: no codes are stored
+                for (size_t i = 0; i < rows; ++i) {
+                    std::memcpy(out + i * width, dictionary, width);
+                }
+                return;
+            }
+            const uint8_t* packed = data + header_size;
+            uint64_t mask = (uint64_t{1} << bits) - 1;
+            for (size_t i = 0; i < rows; ++i) {
+                size_t bit = i * bits;
+                uint64_t window = packed[bit / 8];
+                if (bit % 8 + bits > 8) {
+                    window |= static_cast<uint64_t>(packed[bit / 8 + 1]) << 8;
+                }
+                size_t code = static_cast<size_t>((window >> (bit % 8)) & mask);
+                if (code >= count) {
+                    throw std::runtime_error("Column dictionary code out of range");
+                }
+                std::memcpy(out + i * width, dictionary + code * width, width);
+            }
+            return;
+        }
+    }
+    throw std::runtime_error("Unknown column encoding");
+}
+
+/**
+ * Largest chunk of `rows` values the encoder can produce, or 0 for an unknown encoding
+ */
+inline uint64_t MaxEncodedColumnSize(ColumnEncoding encoding, uint64_t rows, uint8_t width) {
+    switch (encoding) {
+        case ColumnEncoding::Plain:
+            return rows * width;
+        case ColumnEncoding::DeltaOfDelta:
+        case ColumnEncoding::Delta:
+        case ColumnEncoding::Varint:
+            return rows * kMaxVarintSize;
+        case ColumnEncoding::Dictionary:
+            // Count, dictionary, bit width, then at most 8 bits of code per row
+            return sizeof(uint16_t) + kMaxColumnDictionarySize * width + 1 + rows;
+    }
+    return 0;
+}
+
+// ============================================================================
+// File Layout
+// ============================================================================
+
+/**
+ * Location and statistics of one column's data within a row group
+ * min/max are widened values; compare them signed or unsigned per the column
+ */
+struct ColumnChunkInfo {
+    uint64_t offset = 0;        // File offset of the stored bytes
+    uint64_t stored_size = 0;   // Bytes in the file (compressed when `compressed`)
+    uint64_t encoded_size = 0;  // Bytes after decompression
+    ColumnEncoding encoding = ColumnEncoding::Plain;
+    bool compressed = false;
+    uint64_t min = 0;
+    uint64_t max = 0;
+};
+
+struct RowGroupInfo {
+    uint64_t row_count = 0;
+    std::vector<ColumnChunkInfo> chunks;  // One per column
+};
+
+/**
+ * Footer of a columnar file: schema, source metadata and row-group directory
+ *
+ * A file is laid out as
+ *   magic[8] | version u32 | reserved u32 | column chunks... | footer | footer_size u64 | magic[8]
+ * so a reader maps the file and parses the footer from the end without touching the data.
+ * Integers are stored in host byte order (little-endian on all supported targets).
+ */
+struct ColumnarFooter {
+    static constexpr char kMagic[8] = {'D', 'B', 'N', 'C', 'O', 'L', 'M', 'N'};
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kHeaderSize = sizeof(kMagic) + 2 * sizeof(uint32_t);
+    static constexpr size_t kTrailerSize = sizeof(uint64_t) + sizeof(kMagic);
+
+    uint8_t rtype = 0;
+    std::string schema;
+    std::string metadata_json;  // Metadata of the source DBN file
+    std::vector<ColumnSpec> columns;
+    std::vector<RowGroupInfo> row_groups;
+
+    uint64_t RowCount() const {
+        uint64_t rows = 0;
+        for (const auto& group : row_groups) {
+            rows += group.row_count;
+        }
+        return rows;
+    }
+
+    std::vector<uint8_t> Serialize() const {
+        std::vector<uint8_t> out;
+        Put(&out, rtype);
+        PutString<uint16_t>(&out, schema);
+        PutString<uint32_t>(&out, metadata_json);
+        Put(&out, static_cast<uint16_t>(columns.size()));
+        for (const auto& column : columns) {
+            PutString<uint16_t>(&out, column.name);
+            Put(&out, column.offset);
+            Put(&out, column.width);
+            Put(&out, static_cast<uint8_t>(column.is_signed));
+            Put(&out, static_cast<uint8_t>(column.encoding));
+        }
+        Put(&out, static_cast<uint32_t>(row_groups.size()));
+        for (const auto& group : row_groups) {
+            Put(&out, group.row_count);
+            for (const auto& chunk : group.chunks) {
+                Put(&out, chunk.offset);
+                Put(&out, chunk.stored_size);
+                Put(&out, chunk.encoded_size);
+                Put(&out, static_cast<uint8_t>(chunk.encoding));
+                Put(&out, static_cast<uint8_t>(chunk.compressed));
+                Put(&out, chunk.min);
+                Put(&out, chunk.max);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * Parse and validate the footer of a mapped columnar file
+     */
+    static ColumnarFooter Parse(const uint8_t* data, size_t size) {
+        if (size < kHeaderSize + kTrailerSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+            std::memcmp(data + size - sizeof(kMagic), kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("Not a DBN columnar file");
+        }
+        uint32_t version;
+        std::memcpy(&version, data + sizeof(kMagic), sizeof(version));
+        if (version != kVersion) {
+            throw std::runtime_error("Unsupported DBN columnar file version " + std::to_string(version));
+        }
+        uint64_t footer_size;
+        std::memcpy(&footer_size, data + size - kTrailerSize, sizeof(footer_size));
+        if (footer_size > size - kHeaderSize - kTrailerSize) {
+            throw std::runtime_error("Invalid DBN columnar file: footer out of range");
+        }
+        const uint64_t data_end = size - kTrailerSize - footer_size;
+        const uint8_t* cursor = data + data_end;
+        const uint8_t* end = data + size - kTrailerSize;
+
+        ColumnarFooter footer;
+        footer.rtype = Get<uint8_t>(&cursor, end);
+        footer.schema = GetString<uint16_t>(&cursor, end);
+        footer.metadata_json = GetString<uint32_t>(&cursor, end);
+        footer.columns.resize(Get<uint16_t>(&cursor, end));
+        for (auto& column : footer.columns) {
+            column.name = GetString<uint16_t>(&cursor, end);
+            column.offset = Get<uint16_t>(&cursor, end);
+            column.width = Get<uint8_t>(&cursor, end);
+            column.is_signed = Get<uint8_t>(&cursor, end) != 0;
+            column.encoding = static_cast<ColumnEncoding>(Get<uint8_t>(&cursor, end));
+            if (column.width != 1 && column.width != 2 && column.width != 4 && column.width != 8) {
+                throw std::runtime_error("Invalid DBN columnar file: bad column width");
+            }
+        }
+        uint32_t group_count = Get<uint32_t>(&cursor, end);
+        if (group_count > static_cast<uint64_t>(end - cursor)) {
+            throw std::runtime_error("Invalid DBN columnar file: truncated footer");
+        }
+        footer.row_groups.resize(group_count);
+        for (auto& group : footer.row_groups) {
+            group.row_count = Get<uint64_t>(&cursor, end);
+            if (group.row_count > kMaxRowGroupRows) {
+                throw std::runtime_error("Invalid DBN columnar file: row group too large");
+            }
+            group.chunks.resize(footer.columns.size());
+            for (size_t i = 0; i < group.chunks.size(); ++i) {
+                auto& chunk = group.chunks[i];
+                chunk.offset = Get<uint64_t>(&cursor, end);
+                chunk.stored_size = Get<uint64_t>(&cursor, end);
+                chunk.encoded_size = Get<uint64_t>(&cursor, end);
+                chunk.encoding = static_cast<ColumnEncoding>(Get<uint8_t>(&cursor, end));
+                chunk.compressed = Get<uint8_t>(&cursor, end) != 0;
+                chunk.min = Get<uint64_t>(&cursor, end);
+                chunk.max = Get<uint64_t>(&cursor, end);
+                if (chunk.offset < kHeaderSize || chunk.offset > data_end ||
+                    chunk.stored_size > data_end - chunk.offset ||
+                    (!chunk.compressed && chunk.stored_size != chunk.encoded_size)) {
+                    throw std::runtime_error("Invalid DBN columnar file: column chunk out of range");
+                }
+                if (chunk.encoded_size >
+                    MaxEncodedColumnSize(chunk.encoding, group.row_count, footer.columns[i].width)) {
+                    throw std::runtime_error("Invalid DBN columnar file: column chunk too large");
+                }
+            }
+        }
+        return footer;
+    }
+
+private:
+    template <typename T>
+    static void Put(std::vector<uint8_t>* out, T value) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        out->insert(out->end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename Length>
+    static void PutString(std::vector<uint8_t>* out, const std::string& value) {
+        Put(out, static_cast<Length>(value.size()));
+        out->insert(out->end(), value.begin(), value.end());
+    }
+
+    template <typename T>
+    static T Get(const uint8_t** cursor, const uint8_t* end) {
+        if (static_cast<size_t>(end - *cursor) < sizeof(T)) {
+            throw std::runtime_error("Invalid DBN columnar file: truncated footer");
+        }
+        T value;
+        std::memcpy(&value, *cursor, sizeof(T));
+        *cursor += sizeof(T);
+        return value;
+    }
+
+    template <typename Length>
+    static std::string GetString(const uint8_t** cursor, const uint8_t* end) {
+        size_t length = Get<Length>(cursor, end);
+        if (static_cast<size_t>(end - *cursor) < length) {
+            throw std::runtime_error("Invalid DBN columnar file: truncated footer");
+        }
+        std::string value(reinterpret_cast<const char*>(*cursor), length);
+        *cursor += length;
+        return value;
+    }
+};
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+/**
+ * Writes records of one type to a columnar file
+ *
+ * Records are buffered row-major until a row group is full; each column is then
+ * extracted, encoded and compressed with zstd as an independent chunk. The file
+ * is written under a temporary name and renamed by Finish, so readers never see
+ * a partial file; a writer destroyed without Finish removes its temporary file.
+ */
+class ColumnarFileWriter {
+public:
+    /**
+     * @param ts_out Records carry the 8-byte ts_out trailer, stored as a final column
+     * @param row_group_rows Rows per row group (capped so a row group buffers at most kColumnarRowGroupBytes)
+     * @param zstd_level Compression level for column chunks (0 = store uncompressed)
+     */
+    ColumnarFileWriter(const std::filesystem::path& path, const ColumnarSchema& schema, bool ts_out,
+                       std::string metadata_json, size_t row_group_rows, int zstd_level)
+        : path_(path)
+        , temp_path_(path.string() + ".tmp")
+        , stride_(schema.record_size + (ts_out ? sizeof(uint64_t) : 0))
+        , row_group_rows_(std::max<size_t>(1, std::min(row_group_rows, kColumnarRowGroupBytes / stride_)))
+        , zstd_level_(zstd_level)
+    {
+        footer_.rtype = schema.rtype;
+        footer_.schema = schema.name;
+        footer_.metadata_json = std::move(metadata_json);
+        footer_.columns = schema.columns;
+        if (ts_out) {
+            footer_.columns.push_back(
+                detail::ColumnFor(detail::MakeField<uint64_t>("ts_out", schema.record_size, FieldKind::Timestamp)));
+        }
+        if (zstd_level_ > 0) {
+            cctx_ = ZSTD_createCCtx();
+            if (!cctx_) {
+                throw std::runtime_error("Failed to create zstd compression context");
+            }
+        }
+
+        out_.open(temp_path_, std::ios::binary | std::ios::trunc);
+        if (!out_) {
+            ZSTD_freeCCtx(cctx_);
+            throw std::runtime_error("Failed to create columnar file: " + temp_path_.string());
+        }
+        const uint32_t reserved = 0;
+        out_.write(ColumnarFooter::kMagic, sizeof(ColumnarFooter::kMagic));
+        out_.write(reinterpret_cast<const char*>(&ColumnarFooter::kVersion), sizeof(ColumnarFooter::kVersion));
+        out_.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+        position_ = ColumnarFooter::kHeaderSize;
+        rows_.reserve(row_group_rows_ * stride_);
+    }
+
+    ~ColumnarFileWriter() {
+        ZSTD_freeCCtx(cctx_);
+        if (!finished_) {
+            out_.close();
+            std::error_code ec;
+            std::filesystem::remove(temp_path_, ec);
+        }
+    }
+
+    ColumnarFileWriter(const ColumnarFileWriter&) = delete;
+    ColumnarFileWriter& operator=(const ColumnarFileWriter&) = delete;
+
+    /**
+     * Buffer one record; it must be at least Stride() bytes long
+     */
+    void Append(const uint8_t* record) {
+        rows_.insert(rows_.end(), record, record + stride_);
+        if (++buffered_ == row_group_rows_) {
+            FlushRowGroup();
+        }
+    }
+
+    /**
+     * Write the last row group and the footer, then move the file into place
+     */
+    void Finish() {
+        FlushRowGroup();
+        std::vector<uint8_t> footer = footer_.Serialize();
+        auto footer_size = static_cast<uint64_t>(footer.size());
+        out_.write(reinterpret_cast<const char*>(footer.data()), static_cast<std::streamsize>(footer.size()));
+        out_.write(reinterpret_cast<const char*>(&footer_size), sizeof(footer_size));
+        out_.write(ColumnarFooter::kMagic, sizeof(ColumnarFooter::kMagic));
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to write columnar file: " + temp_path_.string());
+        }
+        std::filesystem::rename(temp_path_, path_);
+        finished_ = true;
+    }
+
+    size_t Stride() const { return stride_; }
+    uint64_t RowCount() const { return footer_.RowCount() + buffered_; }
+    size_t RowGroupCount() const { return footer_.row_groups.size(); }
+    uint64_t BytesWritten() const { return position_; }
+    const std::filesystem::path& Path() const { return path_; }
+
+private:
+    void FlushRowGroup() {
+        if (buffered_ == 0) {
+            return;
+        }
+        RowGroupInfo group;
+        group.row_count = buffered_;
+        values_.resize(buffered_);
+        for (const auto& column : footer_.columns) {
+            uint64_t min = UINT64_MAX;
+            uint64_t max = 0;
+            if (column.is_signed) {
+                min = static_cast<uint64_t>(INT64_MAX);
+                max = static_cast<uint64_t>(INT64_MIN);
+            }
+            const uint8_t* field = rows_.data() + column.offset;
+            for (size_t row = 0; row < buffered_; ++row, field += stride_) {
+                uint64_t value = LoadColumnValue(field, column.width, column.is_signed);
+                values_[row] = value;
+                if (column.is_signed) {
+                    min = static_cast<uint64_t>(std::min(static_cast<int64_t>(min), static_cast<int64_t>(value)));
+                    max = static_cast<uint64_t>(std::max(static_cast<int64_t>(max), static_cast<int64_t>(value)));
+                } else {
+                    min = std::min(min, value);
+                    max = std::max(max, value);
+                }
+            }
+
+            ColumnChunkInfo chunk;
+            chunk.encoding = EncodeColumnChunk(column.encoding, values_, column.width, &encoded_);
+            chunk.encoded_size = encoded_.size();
+            chunk.min = min;
+            chunk.max = max;
+            chunk.offset = position_;
+            const std::vector<uint8_t>* stored = &encoded_;
+            if (cctx_) {
+                compressed_.resize(ZSTD_compressBound(encoded_.size()));
+                size_t size = ZSTD_compressCCtx(cctx_, compressed_.data(), compressed_.size(),
+                                                encoded_.data(), encoded_.size(), zstd_level_);
+                if (ZSTD_isError(size)) {
+                    throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+                }
+                // Incompressible chunks are kept as is
+                if (size < encoded_.size()) {
+                    compressed_.resize(size);
+                    stored = &compressed_;
+                    chunk.compressed = true;
+                }
+            }
+            chunk.stored_size = stored->size();
+            out_.write(reinterpret_cast<const char*>(stored->data()), static_cast<std::streamsize>(stored->size()));
+            position_ += stored->size();
+            group.chunks.push_back(chunk);
+        }
+        if (!out_) {
+            throw std::runtime_error("Failed to write columnar file: " + temp_path_.string());
+        }
+        footer_.row_groups.push_back(std::move(group));
+        rows_.clear();
+        buffered_ = 0;
+    }
+
+    std::filesystem::path path_;
+    std::filesystem::path temp_path_;
+    size_t stride_;
+    size_t row_group_rows_;
+    int zstd_level_;
+    ZSTD_CCtx* cctx_ = nullptr;
+    std::ofstream out_;
+    uint64_t position_ = 0;
+    ColumnarFooter footer_;
+    std::vector<uint8_t> rows_;  // Buffered records, stride_ bytes each
+    size_t buffered_ = 0;
+    std::vector<uint64_t> values_;
+    std::vector<uint8_t> encoded_;
+    std::vector<uint8_t> compressed_;
+    bool finished_ = false;
+};
+
+}  // namespace databento_native
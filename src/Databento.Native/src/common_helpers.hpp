@@ -1,14 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <exception>
+#include <filesystem>
+#include <set>
 #include <string>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 #include <databento/enums.hpp>
 #include <databento/datetime.hpp>
+#include <databento/iwritable.hpp>
 
 namespace databento_native {
 
+// Reasonable limit on files per call (prevents resource exhaustion)
+constexpr size_t kMaxInputFiles = 10000;
+
 /**
  * Safely copy a C string to a buffer with null termination
  *
@@ -83,6 +96,26 @@ inline bool SafeStrCopy(char* dest, size_t dest_size, const char* src) {
     return true;
 }
 
+/**
+ * Allocate a string that can be freed with dbento_free_string
+ * @param str String to copy
+ * @return Heap-allocated, null-terminated copy (caller frees with dbento_free_string)
+ */
+inline char* AllocateString(const std::string& str) {
+    // Validate size to prevent overflow
+    if (str.size() > SIZE_MAX - 1) {
+        return nullptr;  // String too large
+    }
+
+    char* result = new char[str.size() + 1];
+
+    // Use memcpy instead of strcpy for safety
+    std::memcpy(result, str.c_str(), str.size());
+    result[str.size()] = '\0';
+
+    return result;
+}
+
 /**
  * Parse schema string to databento Schema enum
  * Centralized to ensure consistency across all wrappers
@@ -220,6 +253,132 @@ inline void ValidateTimeRange(int64_t start_ns, int64_t end_ns) {
     }
 }
 
+/**
+ * Validate an array of input file paths
+ * @param file_paths File path array
+ * @param file_count Number of paths, from 1 to kMaxInputFiles
+ * @return Paths of the files, in order
+ * @throws std::invalid_argument if the array is empty or too long, or a file doesn't exist
+ */
+inline std::vector<std::filesystem::path> ValidateInputFiles(const char** file_paths, size_t file_count) {
+    if (!file_paths || file_count == 0) {
+        throw std::invalid_argument("At least one file is required");
+    }
+    if (file_count > kMaxInputFiles) {
+        throw std::invalid_argument("Too many files");
+    }
+    std::vector<std::filesystem::path> paths;
+    paths.reserve(file_count);
+    for (size_t i = 0; i < file_count; ++i) {
+        ValidateNonEmptyString("file_path", file_paths[i]);
+        std::filesystem::path path{file_paths[i]};
+        if (!std::filesystem::exists(path)) {
+            throw std::invalid_argument("File does not exist: " + path.string());
+        }
+        paths.push_back(std::move(path));
+    }
+    return paths;
+}
+
+/**
+ * Resolve a caller-supplied thread count
+ * @param threads Worker threads, or 0 for one per hardware thread
+ * @return Number of workers, at least 1
+ * @throws std::invalid_argument if threads is negative
+ */
+inline size_t ResolveThreadCount(int threads) {
+    if (threads < 0) {
+        throw std::invalid_argument("Thread count cannot be negative");
+    }
+    return threads > 0 ? static_cast<size_t>(threads) : std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * Output name stem of a DBN file: the file name without .dbn / .dbn.zst
+ */
+inline std::string OutputStem(const std::filesystem::path& path) {
+    std::string name = path.filename().string();
+    for (const char* suffix : {".zst", ".dbn"}) {
+        std::string ext{suffix};
+        if (name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0) {
+            name.resize(name.size() - ext.size());
+        }
+    }
+    return name;
+}
+
+/**
+ * Validate that inputs produce distinct outputs
+ * Outputs are named after their input's OutputStem, so two inputs can't share one.
+ * @throws std::invalid_argument naming the first input whose stem is already taken
+ */
+inline void ValidateDistinctOutputStems(const std::vector<std::filesystem::path>& paths) {
+    std::set<std::string> stems;
+    for (const auto& path : paths) {
+        if (!stems.insert(OutputStem(path)).second) {
+            throw std::invalid_argument("Input file names would produce the same output: " + path.string());
+        }
+    }
+}
+
+/**
+ * Run task(item, worker) for every item in [0, count) on a pool of workers
+ *
+ * The calling thread is worker 0; worker indices are below min(threads, count).
+ * Items are handed out in order. Once a task throws, no further items are
+ * started, and the first worker's exception is rethrown after all workers join.
+ */
+template <typename Task>
+void RunOnWorkers(size_t count, size_t threads, Task&& task) {
+    threads = std::max<size_t>(1, std::min(threads, count));
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::exception_ptr> errors(threads);
+    auto work = [&](size_t worker) {
+        try {
+            size_t item;
+            while (!failed.load(std::memory_order_relaxed) &&
+                   (item = next.fetch_add(1, std::memory_order_relaxed)) < count) {
+                task(item, worker);
+            }
+        }
+        catch (...) {
+            errors[worker] = std::current_exception();
+            failed.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (size_t i = 1; i < threads; ++i) {
+        pool.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * IWritable into a byte vector, used to encode metadata headers
+ */
+class VectorWritable : public databento::IWritable {
+public:
+    explicit VectorWritable(std::vector<std::byte>* out) : out_(out) {}
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        out_->insert(out_->end(), buffer, buffer + length);
+    }
+
+private:
+    std::vector<std::byte>* out_;
+};
+
 /**
  * Validate error buffer parameters
  * @param error_buffer Error buffer pointer
@@ -0,0 +1,581 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "record_filter.hpp"
+#include <databento/constants.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace db = databento;
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::ResolveThreadCount;
+using databento_native::ValidateInputFiles;
+using databento_native::DbnScanFile;
+using databento_native::DbnScanUnit;
+using databento_native::RecordFilter;
+
+// ============================================================================
+// Aggregation Internals
+// ============================================================================
+
+namespace {
+
+// Units planned per worker; more units even out skew between files and blocks
+constexpr size_t kUnitsPerWorker = 4;
+// Relative accuracy of the quantile sketch
+constexpr double kSketchAccuracy = 0.01;
+
+/**
+ * Mergeable quantile sketch with bounded relative error (DDSketch)
+ *
+ * Values fall into logarithmic buckets, so two sketches merge by adding bucket
+ * counts and a quantile is within kSketchAccuracy of the true value.
+ */
+class QuantileSketch {
+public:
+    void Add(double value) {
+        if (value == 0.0) {
+            ++zero_count_;
+        } else if (value > 0.0) {
+            ++positive_[Key(value)];
+        } else {
+            ++negative_[Key(-value)];
+        }
+        ++count_;
+    }
+
+    void Merge(const QuantileSketch& other) {
+        for (const auto& [key, n] : other.positive_) {
+            positive_[key] += n;
+        }
+        for (const auto& [key, n] : other.negative_) {
+            negative_[key] += n;
+        }
+        zero_count_ += other.zero_count_;
+        count_ += other.count_;
+    }
+
+    /**
+     * Estimated values at the given quantiles (each in [0, 1])
+     */
+    std::vector<double> Quantiles(const std::vector<double>& qs) const {
+        std::vector<std::pair<int32_t, uint64_t>> negative(negative_.begin(), negative_.end());
+        std::vector<std::pair<int32_t, uint64_t>> positive(positive_.begin(), positive_.end());
+        // Negative values ascend as their magnitude descends
+        std::sort(negative.begin(), negative.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+        std::sort(positive.begin(), positive.end());
+
+        std::vector<double> values;
+        values.reserve(qs.size());
+        for (double q : qs) {
+            auto rank = static_cast<uint64_t>(q * static_cast<double>(count_ - 1));
+            values.push_back(ValueAtRank(negative, positive, rank));
+        }
+        return values;
+    }
+
+    uint64_t Count() const { return count_; }
+
+private:
+    static double Gamma() { return (1.0 + kSketchAccuracy) / (1.0 - kSketchAccuracy); }
+
+    static int32_t Key(double magnitude) {
+        static const double log_gamma = std::log(Gamma());
+        return static_cast<int32_t>(std::ceil(std::log(magnitude) / log_gamma));
+    }
+
+    static double BucketValue(int32_t key) {
+        return 2.0 * std::pow(Gamma(), key) / (Gamma() + 1.0);
+    }
+
+    double ValueAtRank(const std::vector<std::pair<int32_t, uint64_t>>& negative,
+                       const std::vector<std::pair<int32_t, uint64_t>>& positive,
+                       uint64_t rank) const {
+        uint64_t seen = 0;
+        for (const auto& [key, n] : negative) {
+            seen += n;
+            if (rank < seen) {
+                return -BucketValue(key);
+            }
+        }
+        seen += zero_count_;
+        if (rank < seen) {
+            return 0.0;
+        }
+        for (const auto& [key, n] : positive) {
+            seen += n;
+            if (rank < seen) {
+                return BucketValue(key);
+            }
+        }
+        return positive.empty() ? 0.0 : BucketValue(positive.back().first);
+    }
+
+    std::unordered_map<int32_t, uint64_t> positive_;
+    std::unordered_map<int32_t, uint64_t> negative_;
+    uint64_t zero_count_ = 0;
+    uint64_t count_ = 0;
+};
+
+/**
+ * Aggregation request parsed from JSON
+ */
+struct AggregateSpec {
+    bool by_instrument = false;
+    bool by_publisher = false;
+    uint64_t bucket_ns = 0;  // 0 = no time buckets
+    std::optional<RecordFilter> filter;
+    std::vector<double> quantiles;  // Price quantiles to estimate
+
+    /**
+     * {"group_by": ["instrument_id", "publisher_id", "bucket"], "bucket_ns": n,
+     *  "filter": {...}, "quantiles": [0.5, 0.99]}
+     * All keys are optional; the filter takes the same form as dbento_dbn_file_open_filtered.
+     */
+    static AggregateSpec FromJson(const char* spec_json) {
+        AggregateSpec spec;
+        if (!spec_json || !*spec_json) {
+            return spec;
+        }
+        json j = json::parse(spec_json);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Aggregation spec must be a JSON object");
+        }
+        bool by_bucket = false;
+        if (j.contains("group_by") && !j["group_by"].is_null()) {
+            for (const auto& key : j["group_by"]) {
+                std::string name = key.get<std::string>();
+                if (name == "instrument_id") {
+                    spec.by_instrument = true;
+                } else if (name == "publisher_id") {
+                    spec.by_publisher = true;
+                } else if (name == "bucket") {
+                    by_bucket = true;
+                } else {
+                    throw std::invalid_argument("Unknown group_by key: " + name);
+                }
+            }
+        }
+        if (by_bucket) {
+            spec.bucket_ns = j.value("bucket_ns", uint64_t{0});
+            if (spec.bucket_ns == 0) {
+                throw std::invalid_argument("Grouping by bucket requires a positive bucket_ns");
+            }
+        }
+        if (j.contains("filter") && !j["filter"].is_null()) {
+            spec.filter = RecordFilter::FromJson(j["filter"].dump());
+        }
+        if (j.contains("quantiles") && !j["quantiles"].is_null()) {
+            spec.quantiles = j["quantiles"].get<std::vector<double>>();
+            for (double q : spec.quantiles) {
+                if (!(q >= 0.0 && q <= 1.0)) {
+                    throw std::invalid_argument("Quantiles must be between 0 and 1");
+                }
+            }
+        }
+        return spec;
+    }
+};
+
+struct GroupKey {
+    uint32_t instrument_id;
+    uint16_t publisher_id;
+    uint64_t bucket;
+
+    bool operator==(const GroupKey& other) const {
+        return instrument_id == other.instrument_id && publisher_id == other.publisher_id && bucket == other.bucket;
+    }
+    bool operator<(const GroupKey& other) const {
+        return std::tie(instrument_id, publisher_id, bucket) <
+               std::tie(other.instrument_id, other.publisher_id, other.bucket);
+    }
+};
+
+struct GroupKeyHash {
+    size_t operator()(const GroupKey& key) const {
+        uint64_t h = (static_cast<uint64_t>(key.instrument_id) << 16) ^ key.publisher_id;
+        h ^= key.bucket + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+        return static_cast<size_t>(h * 0xBF58476D1CE4E5B9ull);
+    }
+};
+
+/**
+ * Running statistics of one group
+ *
+ * Price statistics cover trades only: records with action 'T' (trades, MBP,
+ * consolidated and MBO trade events). Book updates, fills, BBO snapshots, bars and
+ * statistics carry prices that are not trades, so they only count toward `count`
+ * and, for top-of-book records, the spread. Open and close are the prices of the
+ * earliest and latest trades by ts_event; ties across units go to the unit that
+ * comes first in the files.
+ */
+struct GroupState {
+    uint64_t count = 0;
+    // Price statistics over trades with a defined price
+    uint64_t priced = 0;
+    uint64_t volume = 0;
+    double notional = 0.0;  // Sum of price * size, in fixed-point price units
+    int64_t low = INT64_MAX;
+    int64_t high = INT64_MIN;
+    uint64_t open_ts = UINT64_MAX;
+    uint64_t open_order = UINT64_MAX;
+    int64_t open = 0;
+    uint64_t close_ts = 0;
+    uint64_t close_order = 0;
+    int64_t close = 0;
+    // Top-of-book spread over records carrying a bid and an ask
+    uint64_t spread_count = 0;
+    double spread_sum = 0.0;
+    int64_t spread_min = INT64_MAX;
+    int64_t spread_max = INT64_MIN;
+    std::unique_ptr<QuantileSketch> sketch;
+
+    void AddTrade(uint64_t ts, uint64_t order, int64_t price, uint64_t size) {
+        ++priced;
+        volume += size;
+        notional += static_cast<double>(price) * static_cast<double>(size);
+        low = std::min(low, price);
+        high = std::max(high, price);
+        if (ts < open_ts || (ts == open_ts && order < open_order)) {
+            open_ts = ts;
+            open_order = order;
+            open = price;
+        }
+        if (priced == 1 || ts > close_ts || (ts == close_ts && order >= close_order)) {
+            close_ts = ts;
+            close_order = order;
+            close = price;
+        }
+        if (sketch) {
+            sketch->Add(static_cast<double>(price));
+        }
+    }
+
+    void AddSpread(int64_t spread) {
+        ++spread_count;
+        spread_sum += static_cast<double>(spread);
+        spread_min = std::min(spread_min, spread);
+        spread_max = std::max(spread_max, spread);
+    }
+
+    void Merge(GroupState& other) {
+        count += other.count;
+        if (other.priced > 0) {
+            if (other.open_ts < open_ts || (other.open_ts == open_ts && other.open_order < open_order)) {
+                open_ts = other.open_ts;
+                open_order = other.open_order;
+                open = other.open;
+            }
+            if (priced == 0 || other.close_ts > close_ts ||
+                (other.close_ts == close_ts && other.close_order >= close_order)) {
+                close_ts = other.close_ts;
+                close_order = other.close_order;
+                close = other.close;
+            }
+            priced += other.priced;
+            volume += other.volume;
+            notional += other.notional;
+            low = std::min(low, other.low);
+            high = std::max(high, other.high);
+        }
+        spread_count += other.spread_count;
+        spread_sum += other.spread_sum;
+        spread_min = std::min(spread_min, other.spread_min);
+        spread_max = std::max(spread_max, other.spread_max);
+        if (other.sketch) {
+            if (sketch) {
+                sketch->Merge(*other.sketch);
+            } else {
+                sketch = std::move(other.sketch);
+            }
+        }
+    }
+};
+
+using GroupTable = std::unordered_map<GroupKey, GroupState, GroupKeyHash>;
+
+template <typename T>
+T Load(const uint8_t* record, size_t offset) {
+    T value;
+    std::memcpy(&value, record + offset, sizeof(T));
+    return value;
+}
+
+/**
+ * Thread-local aggregation state of one worker
+ */
+class Aggregator {
+public:
+    explicit Aggregator(const AggregateSpec& spec)
+        : spec_(spec)
+    {
+        if (spec.filter) {
+            filter_.emplace(*spec.filter);
+        }
+    }
+
+    /**
+     * Aggregate every record of a unit
+     * @param unit_order Position of the unit in file order, for open/close tie-breaks
+     */
+    void Scan(const DbnScanFile& file, const DbnScanUnit& unit, uint64_t unit_order) {
+        auto stream = databento_native::OpenScanUnit(file, unit);
+        uint64_t order = unit_order << 40;
+        if (file.Version() == db::kDbnVersion) {
+            // Current-version records are aggregated straight from the decompressed bytes
+            databento_native::RawRecordScanner scanner{stream.get(), 0};
+            uint64_t offset;
+            while (const uint8_t* record = scanner.Next(&offset)) {
+                Add(record, static_cast<size_t>(record[0]) * db::RecordHeader::kLengthMultiplier, order++);
+            }
+            return;
+        }
+        db::DbnDecoder decoder{db::ILogReceiver::Default(),
+            std::make_unique<databento_native::SpliceReadable>(file.header, std::move(stream)),
+            db::VersionUpgradePolicy::UpgradeToV3};
+        decoder.DecodeMetadata();
+        while (const db::Record* record = decoder.DecodeRecord()) {
+            Add(reinterpret_cast<const uint8_t*>(&record->Header()), record->Size(), order++);
+        }
+    }
+
+    GroupTable& Table() { return table_; }
+    uint64_t Scanned() const { return filter_ ? filter_->Scanned() : scanned_; }
+    uint64_t Passed() const { return filter_ ? filter_->Passed() : scanned_; }
+
+private:
+    void Add(const uint8_t* record, size_t length, uint64_t order) {
+        if (filter_) {
+            if (!filter_->Matches(record, length)) {
+                return;
+            }
+        } else {
+            ++scanned_;
+        }
+
+        uint64_t ts = databento_native::RawRecordTsEvent(record);
+        GroupKey key{
+            spec_.by_instrument ? databento_native::RawRecordInstrumentId(record) : 0,
+            spec_.by_publisher ? Load<uint16_t>(record, 2) : uint16_t{0},
+            spec_.bucket_ns ? ts - ts % spec_.bucket_ns : 0};
+        GroupState& state = Lookup(key);
+        ++state.count;
+
+        uint8_t rtype = record[1];
+        const auto& layout = databento_native::RecordFieldLayouts()[rtype];
+        // A record shorter than its layout is counted, but its fields aren't read
+        if (length < layout.record_size) {
+            return;
+        }
+        if (layout.action >= 0 && record[layout.action] == static_cast<uint8_t>(db::Action::Trade)) {
+            auto price = Load<int64_t>(record, layout.price);
+            if (price != db::kUndefPrice) {
+                state.AddTrade(ts, order, price, Load<uint32_t>(record, layout.size));
+            }
+        }
+        if (layout.bid_price >= 0) {
+            auto bid = Load<int64_t>(record, layout.bid_price);
+            auto ask = Load<int64_t>(record, layout.bid_price + sizeof(int64_t));
+            if (bid != db::kUndefPrice && ask != db::kUndefPrice) {
+                state.AddSpread(ask - bid);
+            }
+        }
+    }
+
+    GroupState& Lookup(const GroupKey& key) {
+        // Consecutive records usually share a group; skip the hash lookup for them
+        if (last_state_ && last_key_ == key) {
+            return *last_state_;
+        }
+        auto [it, inserted] = table_.try_emplace(key);
+        if (inserted && !spec_.quantiles.empty()) {
+            it->second.sketch = std::make_unique<QuantileSketch>();
+        }
+        last_key_ = key;
+        last_state_ = &it->second;
+        return it->second;
+    }
+
+    const AggregateSpec& spec_;
+    std::optional<RecordFilter> filter_;
+    GroupTable table_;
+    GroupKey last_key_{};
+    GroupState* last_state_ = nullptr;  // Stable: unordered_map never moves its nodes
+    uint64_t scanned_ = 0;
+};
+
+json NullableFixed(bool defined, double value) {
+    return defined ? json(static_cast<int64_t>(std::llround(value))) : json(nullptr);
+}
+
+/**
+ * Column-oriented result table; prices are fixed-point (1e-9) and absent values null
+ */
+json ResultTable(const AggregateSpec& spec, GroupTable& table, uint64_t scanned, uint64_t passed) {
+    std::vector<std::pair<GroupKey, GroupState*>> rows;
+    rows.reserve(table.size());
+    for (auto& [key, state] : table) {
+        rows.emplace_back(key, &state);
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    json instrument_ids = json::array(), publisher_ids = json::array(), buckets = json::array();
+    json counts = json::array(), volumes = json::array(), notionals = json::array(), vwaps = json::array();
+    json opens = json::array(), highs = json::array(), lows = json::array(), closes = json::array();
+    json first_ts = json::array(), last_ts = json::array();
+    json spread_counts = json::array(), spread_means = json::array();
+    json spread_mins = json::array(), spread_maxs = json::array();
+    std::vector<json> quantile_columns(spec.quantiles.size(), json::array());
+
+    for (const auto& [key, state] : rows) {
+        if (spec.by_instrument) instrument_ids.push_back(key.instrument_id);
+        if (spec.by_publisher) publisher_ids.push_back(key.publisher_id);
+        if (spec.bucket_ns) buckets.push_back(key.bucket);
+        bool priced = state->priced > 0;
+        counts.push_back(state->count);
+        volumes.push_back(state->volume);
+        notionals.push_back(state->notional / static_cast<double>(db::kFixedPriceScale));
+        vwaps.push_back(NullableFixed(state->volume > 0, state->notional / static_cast<double>(state->volume)));
+        opens.push_back(priced ? json(state->open) : json(nullptr));
+        highs.push_back(priced ? json(state->high) : json(nullptr));
+        lows.push_back(priced ? json(state->low) : json(nullptr));
+        closes.push_back(priced ? json(state->close) : json(nullptr));
+        first_ts.push_back(priced ? json(state->open_ts) : json(nullptr));
+        last_ts.push_back(priced ? json(state->close_ts) : json(nullptr));
+        bool spread = state->spread_count > 0;
+        spread_counts.push_back(state->spread_count);
+        spread_means.push_back(NullableFixed(spread, state->spread_sum / static_cast<double>(state->spread_count)));
+        spread_mins.push_back(spread ? json(state->spread_min) : json(nullptr));
+        spread_maxs.push_back(spread ? json(state->spread_max) : json(nullptr));
+        if (!spec.quantiles.empty()) {
+            bool sketched = state->sketch && state->sketch->Count() > 0;
+            std::vector<double> values = sketched ? state->sketch->Quantiles(spec.quantiles) : std::vector<double>{};
+            for (size_t q = 0; q < spec.quantiles.size(); ++q) {
+                quantile_columns[q].push_back(NullableFixed(sketched, sketched ? values[q] : 0.0));
+            }
+        }
+    }
+
+    json columns = json::object();
+    if (spec.by_instrument) columns["instrument_id"] = std::move(instrument_ids);
+    if (spec.by_publisher) columns["publisher_id"] = std::move(publisher_ids);
+    if (spec.bucket_ns) columns["bucket_start"] = std::move(buckets);
+    columns["count"] = std::move(counts);
+    columns["volume"] = std::move(volumes);
+    columns["notional"] = std::move(notionals);
+    columns["vwap"] = std::move(vwaps);
+    columns["open"] = std::move(opens);
+    columns["high"] = std::move(highs);
+    columns["low"] = std::move(lows);
+    columns["close"] = std::move(closes);
+    columns["first_ts"] = std::move(first_ts);
+    columns["last_ts"] = std::move(last_ts);
+    columns["spread_count"] = std::move(spread_counts);
+    columns["spread_mean"] = std::move(spread_means);
+    columns["spread_min"] = std::move(spread_mins);
+    columns["spread_max"] = std::move(spread_maxs);
+    if (!spec.quantiles.empty()) {
+        json quantiles = json::array();
+        for (size_t q = 0; q < spec.quantiles.size(); ++q) {
+            quantiles.push_back({{"q", spec.quantiles[q]}, {"values", std::move(quantile_columns[q])}});
+        }
+        columns["price_quantiles"] = std::move(quantiles);
+    }
+
+    return {
+        {"row_count", rows.size()},
+        {"records_scanned", scanned},
+        {"records_passed", passed},
+        {"columns", std::move(columns)}};
+}
+
+/**
+ * Scan all units on a worker pool and reduce the per-worker tables
+ */
+json RunAggregation(const std::vector<std::filesystem::path>& paths, const AggregateSpec& spec, size_t threads) {
+    std::vector<DbnScanFile> files;
+    files.reserve(paths.size());
+    for (const auto& path : paths) {
+        files.push_back(databento_native::OpenScanFile(path));
+    }
+    std::vector<DbnScanUnit> units = databento_native::PlanScanUnits(files, threads * kUnitsPerWorker);
+    threads = std::max<size_t>(1, std::min(threads, units.size()));
+
+    // Units are scheduled largest first; their file-order rank breaks open/close ties
+    std::vector<uint64_t> unit_order(units.size());
+    {
+        std::vector<size_t> by_position(units.size());
+        for (size_t i = 0; i < units.size(); ++i) {
+            by_position[i] = i;
+        }
+        std::sort(by_position.begin(), by_position.end(), [&units](size_t a, size_t b) {
+            return std::tie(units[a].file, units[a].first_block) < std::tie(units[b].file, units[b].first_block);
+        });
+        for (size_t rank = 0; rank < by_position.size(); ++rank) {
+            unit_order[by_position[rank]] = rank;
+        }
+    }
+
+    std::vector<std::unique_ptr<Aggregator>> workers;
+    for (size_t i = 0; i < threads; ++i) {
+        workers.push_back(std::make_unique<Aggregator>(spec));
+    }
+    databento_native::RunOnWorkers(units.size(), threads, [&](size_t unit, size_t worker) {
+        workers[worker]->Scan(files[units[unit].file], units[unit], unit_order[unit]);
+    });
+
+    GroupTable& result = workers[0]->Table();
+    uint64_t scanned = workers[0]->Scanned();
+    uint64_t passed = workers[0]->Passed();
+    for (size_t i = 1; i < workers.size(); ++i) {
+        for (auto& [key, state] : workers[i]->Table()) {
+            result[key].Merge(state);
+        }
+        scanned += workers[i]->Scanned();
+        passed += workers[i]->Passed();
+        workers[i].reset();
+    }
+    return ResultTable(spec, result, scanned, passed);
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Aggregation API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_aggregate(
+    const char** file_paths,
+    size_t file_count,
+    const char* spec_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        size_t worker_count = ResolveThreadCount(threads);
+        AggregateSpec spec = AggregateSpec::FromJson(spec_json);
+        std::string json_str = RunAggregation(paths, spec, worker_count).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
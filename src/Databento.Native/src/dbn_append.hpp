@@ -0,0 +1,410 @@
+#pragma once
+
+#include "async_writable.hpp"
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "mapped_file.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/constants.hpp>
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/iwritable.hpp>
+#include <zstd.h>
+#include <zstd_errors.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace databento_native {
+
+// zstd skippable frame magic; readers skip these frames without decoding them
+constexpr uint32_t kZstdSkippableMagic = 0x184D2A50;
+constexpr size_t kZstdSkippableHeaderSize = 8;
+
+/**
+ * Where and how to continue writing an existing DBN file
+ */
+struct DbnAppendPlan {
+    databento::Metadata metadata;   // Existing header
+    size_t header_size = 0;         // Prelude and metadata, in bytes
+    bool compressed = false;
+    uint64_t keep_bytes = 0;        // File bytes to keep; the rest is replaced
+    std::vector<std::byte> refeed;  // Complete records of a final frame cut mid-record, to be written as a new frame
+    uint64_t records = 0;           // Complete records in the file
+    uint64_t max_ts_event = 0;
+    uint64_t dropped_bytes = 0;     // Logical bytes of a partial trailing record or frame
+};
+
+namespace detail {
+
+/**
+ * Walk complete records to the end of a stream, tolerating a partial last record
+ * @return Logical offset just past the last complete record
+ */
+inline uint64_t WalkCompleteRecords(databento::IReadable* input, uint64_t start, uint64_t* count,
+                                    uint64_t* max_ts_event) {
+    constexpr size_t kChunkSize = 1024 * 1024;
+    std::vector<std::byte> buffer(kChunkSize);
+    size_t begin = 0;  // First unparsed byte in buffer
+    size_t end = 0;
+    uint64_t record_end = start;
+    while (true) {
+        if (begin > 0) {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        size_t n = input->ReadSome(buffer.data() + end, buffer.size() - end);
+        if (n == 0) {
+            break;
+        }
+        end += n;
+        while (end - begin >= kRecordHeaderSize) {
+            const auto* record = reinterpret_cast<const uint8_t*>(buffer.data() + begin);
+            size_t length = static_cast<size_t>(record[0]) * 4;
+            if (length < kRecordHeaderSize) {
+                throw std::runtime_error("Malformed DBN record length at offset " + std::to_string(record_end));
+            }
+            if (end - begin < length) {
+                break;
+            }
+            *max_ts_event = std::max(*max_ts_event, RawRecordTsEvent(record));
+            ++*count;
+            begin += length;
+            record_end += length;
+        }
+    }
+    return record_end;
+}
+
+/**
+ * Complete frames of a zstd file, ignoring a frame cut short by a crash
+ * Skippable frames are included; `*complete_end` is set to the end of the last
+ * complete frame. Only a frame that runs past the end of the file counts as cut short.
+ * @throws std::runtime_error if any other frame is invalid
+ */
+inline std::vector<ZstdFrame> ScanCompleteZstdFrames(const uint8_t* data, size_t size, size_t* complete_end) {
+    std::vector<ZstdFrame> frames;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t frame_size = ZSTD_findFrameCompressedSize(data + pos, size - pos);
+        if (ZSTD_isError(frame_size)) {
+            if (ZSTD_getErrorCode(frame_size) != ZSTD_error_srcSize_wrong) {
+                throw std::runtime_error("Invalid zstd frame at offset " + std::to_string(pos) + ": " +
+                                         ZSTD_getErrorName(frame_size));
+            }
+            break;
+        }
+        frames.push_back({pos, frame_size});
+        pos += frame_size;
+    }
+    *complete_end = pos;
+    return frames;
+}
+
+// Make a rename or removal in the directory holding `path` durable
+inline void SyncParentDirectory(const std::filesystem::path& path) {
+#ifndef _WIN32
+    std::filesystem::path directory = path.parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open " + directory.string());
+    }
+    int result = ::fsync(fd);
+    ::close(fd);
+    if (result != 0) {
+        throw std::runtime_error("Failed to sync " + directory.string());
+    }
+#else
+    (void)path;  // NTFS journals directory changes itself
+#endif
+}
+
+inline void ApplyPatch(const std::filesystem::path& path, uint64_t offset, const std::byte* data, size_t size,
+                       bool truncate) {
+    if (truncate) {
+        std::filesystem::resize_file(path, offset);
+    }
+    SyncableFile file{path, SyncableFile::Mode::Update};
+    file.Seek(offset);
+    file.WriteAll(data, size);
+    file.Sync();
+    file.Close();
+}
+
+}  // namespace detail
+
+/**
+ * Journal of an in-place patch, written next to the file as `<file>.patch`
+ */
+constexpr char kDbnPatchMagic[8] = {'D', 'B', 'N', 'P', 'A', 'T', 'C', 'H'};
+
+struct DbnPatchHeader {
+    char magic[8];
+    uint64_t offset;    // Where the patch bytes go
+    uint64_t size;      // Patch bytes following this header
+    uint32_t truncate;  // Nonzero: the file ends after the patch bytes
+    uint32_t reserved;
+};
+static_assert(sizeof(DbnPatchHeader) == 32, "Patch journal header must be 32 bytes");
+
+inline std::filesystem::path DbnPatchJournalPath(const std::filesystem::path& path) {
+    std::filesystem::path journal = path;
+    journal += ".patch";
+    return journal;
+}
+
+/**
+ * Overwrite bytes of an existing file so that a crash never loses what was there
+ *
+ * The patch is written to a journal, synced and renamed into place before the file is
+ * touched; the journal is removed once the file is synced. A crash therefore leaves
+ * either the file as it was or a complete journal, which RecoverDbnPatch applies again.
+ * @param truncate Whether the file ends after `data` (replacing its tail)
+ */
+inline void PatchDbnFile(const std::filesystem::path& path, uint64_t offset, const std::vector<std::byte>& data,
+                         bool truncate) {
+    std::filesystem::path journal = DbnPatchJournalPath(path);
+    std::filesystem::path temp_path = journal;
+    temp_path += ".tmp";
+
+    DbnPatchHeader header{};
+    std::memcpy(header.magic, kDbnPatchMagic, sizeof(header.magic));
+    header.offset = offset;
+    header.size = data.size();
+    header.truncate = truncate ? 1 : 0;
+    {
+        SyncableFile out{temp_path};
+        out.WriteAll(reinterpret_cast<const std::byte*>(&header), sizeof(header));
+        out.WriteAll(data.data(), data.size());
+        out.Sync();
+        out.Close();
+    }
+    std::filesystem::rename(temp_path, journal);
+    detail::SyncParentDirectory(journal);
+
+    detail::ApplyPatch(path, offset, data.data(), data.size(), truncate);
+    // Durably gone before anything else is written, or a later recovery would undo it
+    std::filesystem::remove(journal);
+    detail::SyncParentDirectory(journal);
+}
+
+/**
+ * Finish a PatchDbnFile interrupted by a crash
+ * A journal that was never completed is discarded, since the file was not touched yet.
+ * @return Whether a patch was applied
+ * @throws std::runtime_error if the journal is corrupt; the file is left alone
+ */
+inline bool RecoverDbnPatch(const std::filesystem::path& path) {
+    std::filesystem::path journal = DbnPatchJournalPath(path);
+    std::filesystem::path temp_path = journal;
+    temp_path += ".tmp";
+    std::error_code ec;
+    std::filesystem::remove(temp_path, ec);
+    if (!std::filesystem::exists(journal)) {
+        return false;
+    }
+
+    DbnPatchHeader header;
+    std::vector<std::byte> data;
+    {
+        MappedFile file{journal};
+        if (file.Size() < sizeof(header)) {
+            throw std::runtime_error("Corrupt patch journal " + journal.string());
+        }
+        std::memcpy(&header, file.Data(), sizeof(header));
+        if (std::memcmp(header.magic, kDbnPatchMagic, sizeof(kDbnPatchMagic)) != 0 ||
+            header.size != file.Size() - sizeof(header)) {
+            throw std::runtime_error("Corrupt patch journal " + journal.string());
+        }
+        const auto* bytes = reinterpret_cast<const std::byte*>(file.Data() + sizeof(header));
+        data.assign(bytes, bytes + header.size);
+    }
+    if (header.offset > std::filesystem::file_size(path)) {
+        throw std::runtime_error("Patch journal " + journal.string() + " does not match " + path.string());
+    }
+    detail::ApplyPatch(path, header.offset, data.data(), data.size(), header.truncate != 0);
+    std::filesystem::remove(journal);
+    detail::SyncParentDirectory(journal);
+    return true;
+}
+
+/**
+ * Inspect a DBN file to continue writing it
+ *
+ * Finds the end of the last complete record, so a file cut short by a crash (partial
+ * record, or partial zstd frame) is continued from a clean boundary. For compressed
+ * files the complete frames are decompressed once, in parallel when there are several.
+ * Frames up to the record boundary are kept as they are. When the boundary falls inside
+ * a frame, because the frame after it was lost, that frame's complete records are handed
+ * back as `refeed`, to replace the frame through PatchDbnFile. A patch left behind by an
+ * earlier crash is applied first.
+ * @param thread_count Threads for decompressing a multi-frame file
+ * @throws std::runtime_error if a zstd frame before the end of the file is invalid
+ */
+inline DbnAppendPlan PlanDbnAppend(const std::filesystem::path& path, size_t thread_count) {
+    RecoverDbnPatch(path);
+    DbnAppendPlan plan;
+    auto file = std::make_shared<MappedFile>(path);
+    file->Advise(MappedAccess::Sequential);
+    const auto* data = file->Data();
+    plan.compressed = StartsWithZstdMagic(data, file->Size());
+
+    std::vector<ZstdFrame> frames;
+    std::vector<uint64_t> frame_starts;  // Logical offset of each frame
+    std::vector<uint64_t> frame_sizes;   // Decompressed size of each frame
+    uint64_t logical_size = file->Size();
+    std::unique_ptr<databento::IReadable> input;
+    if (plan.compressed) {
+        size_t complete_end;
+        frames = detail::ScanCompleteZstdFrames(data, file->Size(), &complete_end);
+        std::vector<ZstdFrame> data_frames;
+        std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+        std::vector<std::byte> scratch;
+        logical_size = 0;
+        for (const auto& frame : frames) {
+            frame_starts.push_back(logical_size);
+            frame_sizes.push_back(0);
+            if (!StartsWithZstdMagic(data + frame.offset, frame.size)) {
+                continue;  // Skippable
+            }
+            unsigned long long content_size = ZSTD_getFrameContentSize(data + frame.offset, frame.size);
+            if (content_size == ZSTD_CONTENTSIZE_UNKNOWN || content_size == ZSTD_CONTENTSIZE_ERROR) {
+                DecompressZstdFrame(dctx.get(), data + frame.offset, frame.size, &scratch);
+                content_size = scratch.size();
+            }
+            logical_size += content_size;
+            frame_sizes.back() = content_size;
+            data_frames.push_back(frame);
+        }
+        if (data_frames.empty()) {
+            throw std::runtime_error("No complete zstd frame in " + path.string());
+        }
+        input = std::make_unique<ParallelZstdReadable>(file, std::move(data_frames), thread_count);
+        plan.dropped_bytes = file->Size() - complete_end;  // Compressed bytes of a partial frame
+    } else {
+        input = std::make_unique<MemoryReadable>(file, 0);
+    }
+
+    std::vector<std::byte> header = ReadDbnHeader(input.get());
+    plan.header_size = header.size();
+    auto [version, metadata_size] = databento::DbnDecoder::DecodeMetadataVersionAndSize(header.data(), header.size());
+    if (version != databento::kDbnVersion) {
+        throw std::invalid_argument("Cannot append to a DBN version " + std::to_string(version) +
+                                    " file; upgrade it to version " + std::to_string(databento::kDbnVersion) +
+                                    " first");
+    }
+    plan.metadata = databento::DbnDecoder::DecodeMetadataFields(
+        version, header.data() + kDbnPreludeSize, header.data() + kDbnPreludeSize + metadata_size);
+
+    uint64_t record_end = detail::WalkCompleteRecords(input.get(), plan.header_size, &plan.records,
+                                                      &plan.max_ts_event);
+    input.reset();
+
+    if (!plan.compressed) {
+        plan.keep_bytes = record_end;
+        plan.dropped_bytes = file->Size() - record_end;
+        return plan;
+    }
+
+    // Keep the frames up to the one holding the record boundary. If the boundary ends it,
+    // that frame stays too; otherwise its complete records are written again as a new frame
+    plan.dropped_bytes += logical_size - record_end;
+    size_t k = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (StartsWithZstdMagic(data + frames[i].offset, frames[i].size) && frame_starts[i] < record_end) {
+            k = i;
+        }
+    }
+    const ZstdFrame& last = frames[k];
+    if (frame_starts[k] + frame_sizes[k] == record_end) {
+        plan.keep_bytes = last.offset + last.size;
+        return plan;
+    }
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    DecompressZstdFrame(dctx.get(), data + last.offset, last.size, &plan.refeed);
+    plan.refeed.resize(static_cast<size_t>(record_end - frame_starts[k]));
+    plan.keep_bytes = last.offset;
+    return plan;
+}
+
+/**
+ * Rewrite the metadata header of a DBN file in place
+ *
+ * The new header must encode to the same size as the old one. For compressed files
+ * the first frame is decompressed, patched and compressed again; if it comes out
+ * smaller, the gap is filled with a skippable frame, and if it comes out larger the
+ * header is left alone. The bytes are replaced through PatchDbnFile, so a crash
+ * midway cannot corrupt the header or the first frame's records.
+ * @return Whether the header was rewritten
+ */
+inline bool RewriteDbnHeader(const std::filesystem::path& path, const std::vector<std::byte>& header, int zstd_level) {
+    std::vector<std::byte> patched;
+    {
+        MappedFile file{path};
+        const auto* data = file.Data();
+        if (!StartsWithZstdMagic(data, file.Size())) {
+            if (file.Size() < header.size()) {
+                return false;
+            }
+            patched = header;
+        } else {
+            size_t frame_size = ZSTD_findFrameCompressedSize(data, file.Size());
+            if (ZSTD_isError(frame_size)) {
+                return false;
+            }
+            std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+            std::vector<std::byte> content;
+            DecompressZstdFrame(dctx.get(), data, frame_size, &content);
+            if (content.size() < header.size()) {
+                return false;  // Header spans frames
+            }
+            std::memcpy(content.data(), header.data(), header.size());
+
+            CompressZstdFrame(content.data(), content.size(), zstd_level, &patched);
+            size_t size = patched.size();
+            if (size != frame_size && size + kZstdSkippableHeaderSize > frame_size) {
+                return false;
+            }
+            patched.resize(frame_size);
+            if (size < frame_size) {
+                uint32_t magic = kZstdSkippableMagic;
+                auto skip = static_cast<uint32_t>(frame_size - size - kZstdSkippableHeaderSize);
+                std::memcpy(patched.data() + size, &magic, sizeof(magic));
+                std::memcpy(patched.data() + size + sizeof(magic), &skip, sizeof(skip));
+                std::fill(patched.begin() + static_cast<ptrdiff_t>(size + kZstdSkippableHeaderSize),
+                          patched.end(), std::byte{0});
+            }
+        }
+    }
+
+    PatchDbnFile(path, 0, patched, false);
+    return true;
+}
+
+/**
+ * Encode metadata as a DBN prelude and metadata block
+ */
+inline std::vector<std::byte> EncodeDbnHeader(const databento::Metadata& metadata) {
+    std::vector<std::byte> header;
+    VectorWritable writable{&header};
+    databento::DbnEncoder::EncodeMetadata(metadata, &writable);
+    return header;
+}
+
+}  // namespace databento_native
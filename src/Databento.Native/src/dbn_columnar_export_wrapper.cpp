@@ -0,0 +1,184 @@
+#include "databento_native.h"
+#include "columnar_format.hpp"
+#include "common_helpers.hpp"
+#include "metadata_json.hpp"
+#include <databento/dbn_file_store.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <array>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace db = databento;
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::MetadataToJson;
+using databento_native::OutputStem;
+using databento_native::ResolveThreadCount;
+using databento_native::ValidateDistinctOutputStems;
+using databento_native::ValidateInputFiles;
+using databento_native::ValidateNonEmptyString;
+using databento_native::ColumnarFileWriter;
+using databento_native::ColumnarSchema;
+
+// ============================================================================
+// Columnar Export Internals
+// ============================================================================
+
+namespace {
+
+constexpr const char* kColumnarExtension = ".dbnc";
+
+struct ExportOptions {
+    size_t row_group_rows = databento_native::kDefaultColumnarRowGroupRows;
+    int zstd_level = databento_native::kDefaultColumnarZstdLevel;
+
+    /**
+     * {"row_group_size": rows, "compression_level": 1-22, "compression": "zstd" | "none"}
+     */
+    static ExportOptions FromJson(const char* options_json) {
+        ExportOptions options;
+        if (!options_json || options_json[0] == '\0') {
+            return options;
+        }
+        json j = json::parse(options_json);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Export options must be a JSON object");
+        }
+        if (j.contains("row_group_size") && !j["row_group_size"].is_null()) {
+            options.row_group_rows = j["row_group_size"].get<size_t>();
+            if (options.row_group_rows == 0) {
+                throw std::invalid_argument("Row group size must be positive");
+            }
+        }
+        if (j.contains("compression_level") && !j["compression_level"].is_null()) {
+            options.zstd_level = j["compression_level"].get<int>();
+            if (options.zstd_level < 1 || options.zstd_level > ZSTD_maxCLevel()) {
+                throw std::invalid_argument("Compression level must be between 1 and " +
+                                            std::to_string(ZSTD_maxCLevel()));
+            }
+        }
+        if (j.contains("compression") && !j["compression"].is_null()) {
+            std::string compression = j["compression"].get<std::string>();
+            if (compression == "none") {
+                options.zstd_level = 0;
+            } else if (compression != "zstd") {
+                throw std::invalid_argument("Unknown compression: " + compression);
+            }
+        }
+        return options;
+    }
+};
+
+/**
+ * Export one DBN file into one columnar file per record type it contains
+ * @return Summary of the outputs written
+ */
+json ExportFile(const std::filesystem::path& path, const std::filesystem::path& output_dir,
+                const ExportOptions& options) {
+    db::DbnFileStore store{db::ILogReceiver::Default(), path, db::VersionUpgradePolicy::UpgradeToV3};
+    const db::Metadata& metadata = store.GetMetadata();
+    const std::string metadata_json = MetadataToJson(metadata).dump();
+    const std::string stem = OutputStem(path);
+
+    std::array<std::unique_ptr<ColumnarFileWriter>, 256> writers{};
+    uint64_t records = 0;
+    uint64_t skipped = 0;
+    while (const db::Record* record = store.NextRecord()) {
+        ++records;
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&record->Header());
+        auto& writer = writers[bytes[1]];
+        if (!writer) {
+            const ColumnarSchema* schema = databento_native::ColumnarSchemaFor(bytes[1]);
+            if (!schema) {
+                ++skipped;
+                continue;
+            }
+            writer = std::make_unique<ColumnarFileWriter>(
+                output_dir / (stem + "." + schema->name + kColumnarExtension), *schema, metadata.ts_out,
+                metadata_json, options.row_group_rows, options.zstd_level);
+        }
+        if (record->Size() < writer->Stride()) {
+            ++skipped;
+            continue;
+        }
+        writer->Append(bytes);
+    }
+
+    json outputs = json::array();
+    for (size_t rtype = 0; rtype < writers.size(); ++rtype) {
+        auto& writer = writers[rtype];
+        if (!writer) {
+            continue;
+        }
+        writer->Finish();
+        outputs.push_back({
+            {"path", writer->Path().string()},
+            {"schema", databento_native::ColumnarSchemaFor(static_cast<uint8_t>(rtype))->name},
+            {"rows", writer->RowCount()},
+            {"row_groups", writer->RowGroupCount()},
+            {"bytes", std::filesystem::file_size(writer->Path())}
+        });
+    }
+    return {{"input", path.string()}, {"records", records}, {"records_skipped", skipped}, {"outputs", outputs}};
+}
+
+json RunExport(const std::vector<std::filesystem::path>& paths, const std::filesystem::path& output_dir,
+               const ExportOptions& options, size_t threads) {
+    std::vector<json> results(paths.size());
+    databento_native::RunOnWorkers(paths.size(), threads, [&](size_t file, size_t) {
+        results[file] = ExportFile(paths[file], output_dir, options);
+    });
+
+    uint64_t rows = 0;
+    uint64_t skipped = 0;
+    for (const auto& result : results) {
+        for (const auto& output : result["outputs"]) {
+            rows += output["rows"].get<uint64_t>();
+        }
+        skipped += result["records_skipped"].get<uint64_t>();
+    }
+    return {{"files", results}, {"rows_exported", rows}, {"records_skipped", skipped}};
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Columnar Export API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_columnar_export(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        size_t worker_count = ResolveThreadCount(threads);
+        ValidateNonEmptyString("output_dir", output_dir);
+        std::filesystem::path out_dir{output_dir};
+        if (!std::filesystem::is_directory(out_dir)) {
+            SafeStrCopy(error_buffer, error_buffer_size, ("Directory does not exist: " + out_dir.string()).c_str());
+            return nullptr;
+        }
+
+        ValidateDistinctOutputStems(paths);
+
+        ExportOptions options = ExportOptions::FromJson(options_json);
+        std::string json_str = RunExport(paths, out_dir, options, worker_count).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
@@ -0,0 +1,249 @@
+#include "databento_native.h"
+#include "columnar_format.hpp"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "mapped_file.hpp"
+#include <nlohmann/json.hpp>
+#include <zstd.h>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::ValidateNonEmptyString;
+using databento_native::MappedFile;
+using databento_native::MappedAccess;
+using databento_native::ColumnarFooter;
+using databento_native::ColumnChunkInfo;
+using databento_native::ColumnEncoding;
+
+// ============================================================================
+// DBN Columnar Reader Wrapper Structure
+// ============================================================================
+
+namespace {
+
+const char* EncodingName(ColumnEncoding encoding) {
+    switch (encoding) {
+        case ColumnEncoding::Plain: return "plain";
+        case ColumnEncoding::DeltaOfDelta: return "delta_of_delta";
+        case ColumnEncoding::Delta: return "delta";
+        case ColumnEncoding::Varint: return "varint";
+        case ColumnEncoding::Dictionary: return "dictionary";
+    }
+    return "unknown";
+}
+
+json StatValue(uint64_t value, bool is_signed) {
+    return is_signed ? json(static_cast<int64_t>(value)) : json(value);
+}
+
+}  // namespace
+
+/**
+ * Columnar file mapped read-only; column chunks are decompressed and decoded
+ * straight from the mapping into the caller's buffer
+ */
+struct DbnColumnarReaderWrapper {
+    MappedFile mapped;
+    ColumnarFooter footer;
+    ZSTD_DCtx* dctx = nullptr;
+    std::vector<uint8_t> scratch;  // Decompressed chunk awaiting decode
+
+    explicit DbnColumnarReaderWrapper(const std::filesystem::path& path)
+        : mapped(path)
+    {
+        // Column reads jump between chunks; don't read ahead of them
+        mapped.Advise(MappedAccess::Random);
+        footer = ColumnarFooter::Parse(mapped.Data(), mapped.Size());
+        dctx = ZSTD_createDCtx();
+        if (!dctx) {
+            throw std::runtime_error("Failed to create zstd decompression context");
+        }
+    }
+
+    ~DbnColumnarReaderWrapper() {
+        ZSTD_freeDCtx(dctx);
+    }
+
+    DbnColumnarReaderWrapper(const DbnColumnarReaderWrapper&) = delete;
+    DbnColumnarReaderWrapper& operator=(const DbnColumnarReaderWrapper&) = delete;
+
+    /**
+     * Decode one column chunk into `out` (row_count * width bytes)
+     */
+    void ReadChunk(size_t row_group, size_t column, uint8_t* out) {
+        const auto& group = footer.row_groups[row_group];
+        const ColumnChunkInfo& chunk = group.chunks[column];
+        const uint8_t* encoded = mapped.Data() + chunk.offset;
+        if (chunk.compressed) {
+            // The footer bounds encoded_size by the row count; the frame must agree before it's allocated
+            if (ZSTD_getFrameContentSize(encoded, static_cast<size_t>(chunk.stored_size)) != chunk.encoded_size) {
+                throw std::runtime_error("Corrupt column chunk");
+            }
+            scratch.resize(static_cast<size_t>(chunk.encoded_size));
+            size_t size = ZSTD_decompressDCtx(dctx, scratch.data(), scratch.size(), encoded,
+                                              static_cast<size_t>(chunk.stored_size));
+            if (ZSTD_isError(size) || size != scratch.size()) {
+                throw std::runtime_error("Corrupt column chunk");
+            }
+            encoded = scratch.data();
+        }
+        databento_native::DecodeColumnChunk(chunk.encoding, encoded, static_cast<size_t>(chunk.encoded_size),
+                                            static_cast<size_t>(group.row_count), footer.columns[column].width, out);
+    }
+
+    json SchemaToJson() const {
+        json columns = json::array();
+        for (const auto& column : footer.columns) {
+            columns.push_back({
+                {"name", column.name},
+                {"width", column.width},
+                {"signed", column.is_signed},
+                {"encoding", EncodingName(column.encoding)}
+            });
+        }
+        json row_groups = json::array();
+        uint64_t first_row = 0;
+        for (const auto& group : footer.row_groups) {
+            json stats = json::array();
+            for (size_t i = 0; i < group.chunks.size(); ++i) {
+                const auto& chunk = group.chunks[i];
+                bool is_signed = footer.columns[i].is_signed;
+                stats.push_back({
+                    {"min", StatValue(chunk.min, is_signed)},
+                    {"max", StatValue(chunk.max, is_signed)},
+                    {"encoding", EncodingName(chunk.encoding)},
+                    {"encoded_size", chunk.encoded_size},
+                    {"stored_size", chunk.stored_size}
+                });
+            }
+            row_groups.push_back({{"first_row", first_row}, {"rows", group.row_count}, {"columns", stats}});
+            first_row += group.row_count;
+        }
+        return {
+            {"rtype", footer.rtype},
+            {"schema", footer.schema},
+            {"row_count", first_row},
+            {"metadata", json::parse(footer.metadata_json)},
+            {"columns", columns},
+            {"row_groups", row_groups}
+        };
+    }
+};
+
+static DbnColumnarReaderWrapper* GetColumnarReader(DbnColumnarReaderHandle handle, char* error_buffer,
+                                                   size_t error_buffer_size) {
+    databento_native::ValidationError validation_error;
+    auto* wrapper = databento_native::ValidateAndCast<DbnColumnarReaderWrapper>(
+        handle, databento_native::HandleType::DbnColumnarReader, &validation_error);
+    if (!wrapper) {
+        SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+    }
+    return wrapper;
+}
+
+// ============================================================================
+// DBN Columnar Reader API Implementation
+// ============================================================================
+
+DATABENTO_API DbnColumnarReaderHandle dbento_dbn_columnar_open(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        ValidateNonEmptyString("file_path", file_path);
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, ("File does not exist: " + path.string()).c_str());
+            return nullptr;
+        }
+
+        auto wrapper = std::make_unique<DbnColumnarReaderWrapper>(path);
+        return reinterpret_cast<DbnColumnarReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnColumnarReader, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API const char* dbento_dbn_columnar_get_schema(
+    DbnColumnarReaderHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetColumnarReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return nullptr;
+        }
+        std::string json_str = wrapper->SchemaToJson().dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_columnar_read_column(
+    DbnColumnarReaderHandle handle,
+    size_t row_group,
+    size_t column,
+    uint8_t* values,
+    size_t values_size,
+    size_t* row_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetColumnarReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+        if (!values || !row_count) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        const ColumnarFooter& footer = wrapper->footer;
+        if (row_group >= footer.row_groups.size() || column >= footer.columns.size()) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Row group or column index out of range");
+            return -2;
+        }
+
+        auto rows = static_cast<size_t>(footer.row_groups[row_group].row_count);
+        *row_count = rows;
+        if (rows * footer.columns[column].width > values_size) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Value buffer too small");
+            return -3;
+        }
+        wrapper->ReadChunk(row_group, column, values);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_columnar_close(DbnColumnarReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnColumnarReaderWrapper>(
+            handle, databento_native::HandleType::DbnColumnarReader, nullptr);
+        if (wrapper) {
+            delete wrapper;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
@@ -1,108 +1,362 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
-#include <databento/dbn_file_store.hpp>
+#include "dbn_index.hpp"
+#include "mapped_file.hpp"
+#include "metadata_json.hpp"
+#include "prefetch_io.hpp"
+#include "record_filter.hpp"
+#include "record_utils.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/dbn_decoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/log.hpp>
 #include <databento/enums.hpp>
 #include <databento/datetime.hpp>
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <cstring>
 #include <filesystem>
+#include <thread>
+#include <utility>
 
 namespace db = databento;
 using json = nlohmann::json;
 using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::MetadataToJson;
+using databento_native::OpenParallelZstd;
+using databento_native::DbnFileIndex;
+using databento_native::BuildAndSaveIndex;
+using databento_native::MappedFile;
+using databento_native::RecordFilter;
+using databento_native::PrefetchOptions;
+using databento_native::IoBackend;
 
 // ============================================================================
 // DBN File Reader Wrapper Structure
 // ============================================================================
 
+namespace {
+
+// Files at least this large get their index built in the background on open
+constexpr uintmax_t kAutoIndexMinFileSize = 64ull * 1024 * 1024;
+// Records evaluated per filter run in the batch fast path
+constexpr size_t kFilterRunRecords = 4096;
+
+}  // namespace
+
 struct DbnFileReaderWrapper {
-    std::unique_ptr<db::DbnFileStore> file_store;
+    std::unique_ptr<db::DbnDecoder> decoder;
+    db::Metadata metadata;
     std::filesystem::path file_path;
+    size_t decompression_threads;
+    // Overlapped reads for the decoder's input; unset = plain synchronous reads
+    std::optional<PrefetchOptions> prefetch;
+    IoBackend io_backend = IoBackend::Sync;
+    // Record decoded but not yet handed out (didn't fit in the caller's buffer)
+    const db::Record* held_record = nullptr;
+
+    // Seek and selective-read support, loaded on demand
+    std::optional<DbnFileIndex> index;
+    std::atomic<bool> cancel_index{false};  // Declared first: outlives the pending build
+    std::future<DbnFileIndex> pending_index;
+    std::shared_ptr<const MappedFile> mapped;
+    std::vector<std::byte> header_bytes;
+    // Selected instruments (sorted); empty = all
+    std::vector<uint32_t> instrument_filter;
+
+    // Pushed-down record filter. Current-version files are then scanned raw
+    // (no decoder) so the filter sees contiguous runs of records.
+    std::optional<RecordFilter> filter;
+    std::unique_ptr<db::IReadable> raw_input;
+    std::unique_ptr<databento_native::RawRecordScanner> raw_scanner;
+    db::Record raw_record{nullptr};
+    std::vector<uint8_t> filter_keep;
+
+    /**
+     * @param decompression_threads Threads for multi-frame zstd files (1 = decode on the calling thread)
+     * @param record_filter Optional filter applied before records are handed out
+     * @param prefetch_options Read ahead of the decoder with this many buffers in flight
+     */
+    DbnFileReaderWrapper(const std::filesystem::path& path, size_t decompression_threads,
+                         std::optional<RecordFilter> record_filter = std::nullopt,
+                         std::optional<PrefetchOptions> prefetch_options = std::nullopt)
+        : file_path(path), decompression_threads(decompression_threads), prefetch(prefetch_options),
+          filter(std::move(record_filter)) {
+        if (filter) {
+            OpenMapped();
+            const auto* bytes = header_bytes.data();
+            auto [version, metadata_size] = db::DbnDecoder::DecodeMetadataVersionAndSize(bytes, header_bytes.size());
+            if (version == db::kDbnVersion) {
+                // No upgrade needed, so records can be filtered in place
+                metadata = db::DbnDecoder::DecodeMetadataFields(
+                    version, bytes + databento_native::kDbnPreludeSize,
+                    bytes + databento_native::kDbnPreludeSize + metadata_size);
+                raw_input = OpenParallelZstd(file_path, decompression_threads);
+                if (!raw_input) {
+                    raw_input = databento_native::OpenDbnStreamAt(mapped, 0, 0, 0);
+                }
+                databento_native::SkipBytes(raw_input.get(), header_bytes.size());
+                raw_scanner = std::make_unique<databento_native::RawRecordScanner>(
+                    raw_input.get(), header_bytes.size());
+            }
+        }
+        if (!raw_scanner) {
+            decoder = std::make_unique<db::DbnDecoder>(
+                db::ILogReceiver::Default(), OpenInput(), db::VersionUpgradePolicy::UpgradeToV3);
+            metadata = decoder->DecodeMetadata();
+        }
 
-    explicit DbnFileReaderWrapper(const std::filesystem::path& path)
-        : file_path(path) {
-        file_store = std::make_unique<db::DbnFileStore>(path);
+        index = DbnFileIndex::Load(file_path);
+        if (!index && std::filesystem::file_size(file_path) >= kAutoIndexMinFileSize) {
+            pending_index = std::async(std::launch::async, BuildAndSaveIndex, file_path, &cancel_index);
+        }
     }
-};
 
-// ============================================================================
-// Helper Functions
-// ============================================================================
+    ~DbnFileReaderWrapper() {
+        // Don't hold up close for an index nobody asked for
+        cancel_index = true;
+    }
+
+    bool IsOpen() const { return decoder || raw_scanner; }
+
+    std::unique_ptr<db::IReadable> OpenInput() {
+        if (prefetch) {
+            // Raw file bytes; the decoder detects and streams zstd itself
+            auto input = std::make_unique<databento_native::PrefetchFileReadable>(
+                file_path, prefetch->buffer_size, prefetch->queue_depth);
+            io_backend = input->Backend();
+            return input;
+        }
+        std::unique_ptr<db::IReadable> input = OpenParallelZstd(file_path, decompression_threads);
+        if (!input) {
+            // Uncompressed or single-frame: the decoder detects and streams zstd itself
+            input = std::make_unique<db::InFileStream>(file_path);
+        }
+        return input;
+    }
+
+    // Returns the held record if any, otherwise the next selected one that passes the filter (nullptr at EOF)
+    const db::Record* NextRecord() {
+        if (held_record) {
+            return std::exchange(held_record, nullptr);
+        }
+        while (const db::Record* record = DecodeNext()) {
+            if (filter && !filter->Matches(reinterpret_cast<const uint8_t*>(&record->Header()), record->Size())) {
+                continue;
+            }
+            if (IsSelected(record->Header().instrument_id)) {
+                return record;
+            }
+        }
+        return nullptr;
+    }
+
+    bool IsSelected(uint32_t instrument_id) const {
+        return instrument_filter.empty() ||
+            std::binary_search(instrument_filter.begin(), instrument_filter.end(), instrument_id);
+    }
 
-// Allocate a string that can be freed with dbento_free_string
-static char* AllocateString(const std::string& str) {
-    // Validate size to prevent overflow
-    if (str.size() > SIZE_MAX - 1) {
-        return nullptr;  // String too large
+    /**
+     * Filtered batch read over raw runs; only valid in raw mode
+     * Records stay in the scanner until copied, so nothing needs to be held back.
+     * @return Records written; 0 with *too_small set if the next match doesn't fit
+     */
+    size_t NextFilteredBatch(uint8_t* buffer, size_t buffer_size, size_t* offsets, size_t max_records,
+                             bool* too_small) {
+        size_t used = 0;
+        size_t count = 0;
+        *too_small = false;
+        while (count < max_records) {
+            const uint8_t* run;
+            size_t stride;
+            size_t run_length = raw_scanner->PeekRun(kFilterRunRecords, &run, &stride);
+            if (run_length == 0) {
+                break;
+            }
+            filter_keep.resize(run_length);
+            filter->MatchRun(run, run_length, stride, filter_keep.data());
+
+            size_t consumed = 0;
+            size_t passed = 0;
+            for (; consumed < run_length; ++consumed) {
+                if (!filter_keep[consumed]) {
+                    continue;
+                }
+                const uint8_t* record = run + consumed * stride;
+                if (IsSelected(databento_native::RawRecordInstrumentId(record))) {
+                    if (count == max_records || used + stride > buffer_size) {
+                        break;
+                    }
+                    std::memcpy(buffer + used, record, stride);
+                    offsets[count++] = used;
+                    used += stride;
+                }
+                ++passed;
+            }
+            filter->AddCounts(consumed, passed);
+            raw_scanner->Consume(consumed * stride);
+            if (consumed < run_length) {
+                *too_small = count == 0;
+                break;
+            }
+        }
+        return count;
     }
 
-    char* result = new char[str.size() + 1];
+    const DbnFileIndex& Index() {
+        if (!index) {
+            if (pending_index.valid()) {
+                index = pending_index.get();
+            } else {
+                index = BuildAndSaveIndex(file_path, nullptr);
+            }
+        }
+        return *index;
+    }
 
-    // Use memcpy instead of strcpy for safety
-    std::memcpy(result, str.c_str(), str.size());
-    result[str.size()] = '\0';
+    /**
+     * Position the reader at the first selected record with ts_event >= ts_event
+     * Resumes from the nearest index checkpoint and decodes forward from there
+     */
+    void SeekTime(uint64_t ts_event) {
+        ptrdiff_t block = Index().FindCheckpoint(ts_event);
+        Reposition(block < 0 ? 0 : static_cast<size_t>(block));
+
+        while (const db::Record* record = NextRecord()) {
+            if (databento_native::RecordTsEvent(record->Header()) >= ts_event) {
+                held_record = record;
+                break;
+            }
+        }
+    }
 
-    return result;
+    /**
+     * Restrict reading to the given instruments and restart from the first record
+     * Only index blocks containing them are decompressed and decoded
+     */
+    void SelectInstruments(std::vector<uint32_t> instrument_ids) {
+        std::sort(instrument_ids.begin(), instrument_ids.end());
+        instrument_ids.erase(std::unique(instrument_ids.begin(), instrument_ids.end()), instrument_ids.end());
+        instrument_filter = std::move(instrument_ids);
+        Reposition(0);
+    }
+
+private:
+    // Re-creates the decoder at an index block, honoring the instrument selection
+    void Reposition(size_t first_block) {
+        const DbnFileIndex& file_index = Index();
+        OpenMapped();
+
+        const auto& checkpoints = file_index.Checkpoints();
+        std::unique_ptr<db::IReadable> tail;
+        if (!instrument_filter.empty()) {
+            auto blocks = file_index.BlocksFor(instrument_filter.data(), instrument_filter.size());
+            blocks.erase(blocks.begin(), std::lower_bound(blocks.begin(), blocks.end(), first_block));
+            tail = std::make_unique<databento_native::BlockRangeReadable>(mapped, file_index, std::move(blocks));
+        } else if (first_block >= checkpoints.size()) {
+            tail = databento_native::OpenDbnStreamAt(mapped, 0, 0, header_bytes.size());  // Empty file
+        } else {
+            const auto& checkpoint = checkpoints[first_block];
+            if (file_index.Compressed() && decompression_threads >= 2) {
+                tail = OpenParallelTail(checkpoint);
+            }
+            if (!tail) {
+                tail = databento_native::OpenDbnStreamAt(mapped,
+                    checkpoint.frame_file_offset, checkpoint.frame_logical_offset, checkpoint.logical_offset);
+            }
+        }
+
+        held_record = nullptr;
+        if (raw_scanner) {
+            raw_scanner.reset();
+            raw_input = std::move(tail);
+            raw_scanner = std::make_unique<databento_native::RawRecordScanner>(raw_input.get(), 0);
+            return;
+        }
+        // Re-decode from the original header so version upgrades still apply
+        decoder = std::make_unique<db::DbnDecoder>(db::ILogReceiver::Default(),
+            std::make_unique<databento_native::SpliceReadable>(header_bytes, std::move(tail)),
+            db::VersionUpgradePolicy::UpgradeToV3);
+        decoder->DecodeMetadata();
+    }
+
+    // Maps the file and captures its raw header on first use
+    void OpenMapped() {
+        if (!mapped) {
+            mapped = std::make_shared<MappedFile>(file_path);
+            auto start = databento_native::OpenDbnStreamAt(mapped, 0, 0, 0);
+            header_bytes = databento_native::ReadDbnHeader(start.get());
+        }
+    }
+
+    // Decodes the next record, or reads it raw in filter mode (nullptr at EOF)
+    const db::Record* DecodeNext() {
+        if (!raw_scanner) {
+            return decoder->DecodeRecord();
+        }
+        uint64_t offset;
+        const uint8_t* record = raw_scanner->Next(&offset);
+        if (!record) {
+            return nullptr;
+        }
+        raw_record = db::Record{reinterpret_cast<db::RecordHeader*>(const_cast<uint8_t*>(record))};
+        return &raw_record;
+    }
+
+    // Frame-parallel stream from the checkpoint's frame onwards; nullptr for single-frame files
+    std::unique_ptr<db::IReadable> OpenParallelTail(const databento_native::DbnIndexCheckpoint& checkpoint) {
+        auto frames = databento_native::ScanZstdFrames(mapped->Data(), mapped->Size());
+        auto first = std::find_if(frames.begin(), frames.end(),
+            [&checkpoint](const databento_native::ZstdFrame& frame) {
+                return frame.offset >= checkpoint.frame_file_offset;
+            });
+        if (frames.end() - first < 2) {
+            return nullptr;
+        }
+        frames.erase(frames.begin(), first);
+        std::unique_ptr<db::IReadable> tail = std::make_unique<databento_native::ParallelZstdReadable>(
+            mapped, std::move(frames), decompression_threads);
+        databento_native::SkipBytes(tail.get(), checkpoint.logical_offset - checkpoint.frame_logical_offset);
+        return tail;
+    }
+};
+
+static size_t DefaultDecompressionThreads() {
+    // Leave a core for the consumer; more than 8 workers rarely helps a single stream
+    unsigned int hw = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hw > 1 ? hw - 1 : 1, 1, 8);
 }
 
-// Convert Metadata to JSON
-static json MetadataToJson(const db::Metadata& metadata) {
-    json j;
-    j["version"] = metadata.version;
-    j["dataset"] = metadata.dataset;
-
-    if (metadata.schema.has_value()) {
-        j["schema"] = static_cast<int>(metadata.schema.value());
-    } else {
-        j["schema"] = nullptr;
-    }
-
-    // Convert UnixNanos to int64 nanoseconds
-    j["start"] = static_cast<int64_t>(metadata.start.time_since_epoch().count());
-    j["end"] = static_cast<int64_t>(metadata.end.time_since_epoch().count());
-    j["limit"] = metadata.limit;
-
-    if (metadata.stype_in.has_value()) {
-        j["stype_in"] = static_cast<int>(metadata.stype_in.value());
-    } else {
-        j["stype_in"] = nullptr;
-    }
-
-    j["stype_out"] = static_cast<int>(metadata.stype_out);
-    j["ts_out"] = metadata.ts_out;
-    j["symbol_cstr_len"] = metadata.symbol_cstr_len;
-    j["symbols"] = metadata.symbols;
-    j["partial"] = metadata.partial;
-    j["not_found"] = metadata.not_found;
-
-    // Convert mappings
-    json mappings_array = json::array();
-    for (const auto& mapping : metadata.mappings) {
-        json mapping_obj;
-        mapping_obj["raw_symbol"] = mapping.raw_symbol;
-
-        json intervals_array = json::array();
-        for (const auto& interval : mapping.intervals) {
-            json interval_obj;
-            // Convert date::year_month_day to string
-            std::ostringstream oss_start, oss_end;
-            oss_start << interval.start_date;
-            oss_end << interval.end_date;
-            interval_obj["start_date"] = oss_start.str();
-            interval_obj["end_date"] = oss_end.str();
-            interval_obj["symbol"] = interval.symbol;
-            intervals_array.push_back(interval_obj);
-        }
-
-        mapping_obj["intervals"] = intervals_array;
-        mappings_array.push_back(mapping_obj);
-    }
-
-    j["mappings"] = mappings_array;
-    return j;
+static DbnFileReaderHandle OpenReader(
+    const char* file_path,
+    size_t decompression_threads,
+    char* error_buffer,
+    size_t error_buffer_size,
+    std::optional<RecordFilter> filter = std::nullopt,
+    std::optional<PrefetchOptions> prefetch = std::nullopt)
+{
+    if (!file_path) {
+        SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+        return nullptr;
+    }
+
+    // Check if file exists
+    std::filesystem::path path{file_path};
+    if (!std::filesystem::exists(path)) {
+        SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<DbnFileReaderWrapper>(path, decompression_threads, std::move(filter), prefetch);
+    return reinterpret_cast<DbnFileReaderHandle>(
+        databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, std::move(wrapper)));
 }
 
 // ============================================================================
@@ -115,21 +369,81 @@ DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open(
     size_t error_buffer_size)
 {
     try {
-        if (!file_path) {
-            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+        return OpenReader(file_path, DefaultDecompressionThreads(), error_buffer, error_buffer_size);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_ex(
+    const char* file_path,
+    int decompression_threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (decompression_threads < 0 || decompression_threads > 256) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Decompression threads must be between 0 and 256");
             return nullptr;
         }
+        size_t threads = decompression_threads == 0
+            ? DefaultDecompressionThreads()
+            : static_cast<size_t>(decompression_threads);
+        return OpenReader(file_path, threads, error_buffer, error_buffer_size);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
 
-        // Check if file exists
-        std::filesystem::path path{file_path};
-        if (!std::filesystem::exists(path)) {
-            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_filtered(
+    const char* file_path,
+    int decompression_threads,
+    const char* filter_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!filter_json) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Filter cannot be null");
+            return nullptr;
+        }
+        if (decompression_threads < 0 || decompression_threads > 256) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Decompression threads must be between 0 and 256");
             return nullptr;
         }
+        size_t threads = decompression_threads == 0
+            ? DefaultDecompressionThreads()
+            : static_cast<size_t>(decompression_threads);
+        return OpenReader(file_path, threads, error_buffer, error_buffer_size, RecordFilter::FromJson(filter_json));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
 
-        auto* wrapper = new DbnFileReaderWrapper(path);
-        return reinterpret_cast<DbnFileReaderHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, wrapper));
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_prefetched(
+    const char* file_path,
+    size_t buffer_size,
+    size_t queue_depth,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (queue_depth > databento_native::kMaxPrefetchQueueDepth) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Queue depth must be at most 256");
+            return nullptr;
+        }
+        if (buffer_size != 0 && buffer_size < 4096) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Buffer size must be at least 4096 bytes");
+            return nullptr;
+        }
+        return OpenReader(file_path, 1, error_buffer, error_buffer_size, std::nullopt,
+                          PrefetchOptions{buffer_size, queue_depth});
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -146,14 +460,13 @@ DATABENTO_API const char* dbento_dbn_file_get_metadata(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
             handle, databento_native::HandleType::DbnFileReader, &validation_error);
-        if (!wrapper || !wrapper->file_store) {
+        if (!wrapper || !wrapper->IsOpen()) {
             SafeStrCopy(error_buffer, error_buffer_size,
-                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+                wrapper ? "Decoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
         }
 
-        const db::Metadata& metadata = wrapper->file_store->GetMetadata();
-        json j = MetadataToJson(metadata);
+        json j = MetadataToJson(wrapper->metadata);
         std::string json_str = j.dump();
         return AllocateString(json_str);
     }
@@ -176,13 +489,13 @@ DATABENTO_API int dbento_dbn_file_next_record(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
             handle, databento_native::HandleType::DbnFileReader, &validation_error);
-        if (!wrapper || !wrapper->file_store) {
+        if (!wrapper || !wrapper->IsOpen()) {
             SafeStrCopy(error_buffer, error_buffer_size,
-                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+                wrapper ? "Decoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return -1;
         }
 
-        const db::Record* record = wrapper->file_store->NextRecord();
+        const db::Record* record = wrapper->NextRecord();
 
         // nullptr indicates end of file
         if (!record) {
@@ -195,6 +508,7 @@ DATABENTO_API int dbento_dbn_file_next_record(
         uint8_t rec_type = static_cast<uint8_t>(record->RType());
 
         if (rec_size > record_buffer_size) {
+            wrapper->held_record = record;  // Not consumed; retry with a larger buffer
             SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
             return -1;
         }
@@ -214,6 +528,171 @@ DATABENTO_API int dbento_dbn_file_next_record(
     }
 }
 
+DATABENTO_API int dbento_dbn_file_next_records(
+    DbnFileReaderHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Decoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!record_buffer || !record_offsets || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        if (wrapper->raw_scanner && !wrapper->held_record) {
+            bool too_small = false;
+            size_t count = wrapper->NextFilteredBatch(
+                record_buffer, record_buffer_size, record_offsets, max_records, &too_small);
+            *record_count = count;
+            if (too_small) {
+                SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+                return -3;
+            }
+            return count == 0 ? 1 : 0;  // 1 = EOF
+        }
+
+        size_t used = 0;
+        size_t count = 0;
+        while (count < max_records) {
+            const db::Record* record = wrapper->NextRecord();
+            if (!record) {
+                break;
+            }
+
+            size_t rec_size = record->Size();
+            if (used + rec_size > record_buffer_size) {
+                // Keep it for the next call; only an error if even one record doesn't fit
+                wrapper->held_record = record;
+                if (count == 0) {
+                    SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+                    *record_count = 0;
+                    return -3;
+                }
+                break;
+            }
+
+            std::memcpy(record_buffer + used, &record->Header(), rec_size);
+            record_offsets[count++] = used;
+            used += rec_size;
+        }
+
+        *record_count = count;
+        return count == 0 ? 1 : 0;  // 1 = EOF
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_seek_time(
+    DbnFileReaderHandle handle,
+    int64_t ts_event_ns,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Decoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (ts_event_ns < 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Timestamp cannot be negative");
+            return -2;
+        }
+
+        wrapper->SeekTime(static_cast<uint64_t>(ts_event_ns));
+        return wrapper->held_record ? 0 : 1;  // 1 = no record at or after the timestamp
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_select_instruments(
+    DbnFileReaderHandle handle,
+    const uint32_t* instrument_ids,
+    size_t instrument_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Decoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!instrument_ids && instrument_count > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        wrapper->SelectInstruments(std::vector<uint32_t>(instrument_ids, instrument_ids + instrument_count));
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_get_filter_stats(
+    DbnFileReaderHandle handle,
+    uint64_t* records_scanned,
+    uint64_t* records_passed)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, nullptr);
+        if (!wrapper || !records_scanned || !records_passed) {
+            return -1;
+        }
+        *records_scanned = wrapper->filter ? wrapper->filter->Scanned() : 0;
+        *records_passed = wrapper->filter ? wrapper->filter->Passed() : 0;
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_get_io_backend(DbnFileReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, nullptr);
+        if (!wrapper) {
+            return -1;
+        }
+        return static_cast<int>(wrapper->io_backend);
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
 DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle)
 {
     try {
@@ -228,3 +707,39 @@ DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle)
         // Swallow exceptions in cleanup
     }
 }
+
+// ============================================================================
+// DBN Index API Implementation
+// ============================================================================
+
+DATABENTO_API int64_t dbento_dbn_build_index(
+    const char* file_path,
+    uint64_t record_interval,
+    uint64_t byte_interval,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return -1;
+        }
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+            return -1;
+        }
+        if (record_interval == 0 && byte_interval == 0) {
+            record_interval = databento_native::kDefaultIndexRecordInterval;
+            byte_interval = databento_native::kDefaultIndexByteInterval;
+        }
+
+        DbnFileIndex index = DbnFileIndex::Build(path, record_interval, byte_interval);
+        index.Save(path);
+        return static_cast<int64_t>(index.Checkpoints().size());
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
@@ -1,6 +1,9 @@
 #include "databento_native.h"
+#include "async_writable.hpp"
 #include "common_helpers.hpp"
+#include "dbn_append.hpp"
 #include "handle_validation.hpp"
+#include "zstd_frame_io.hpp"
 #include <databento/dbn_encoder.hpp>
 #include <databento/file_stream.hpp>
 #include <databento/dbn.hpp>
@@ -8,24 +11,46 @@
 #include <databento/datetime.hpp>
 #include <databento/record.hpp>
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <cstring>
 #include <filesystem>
+#include <optional>
 #include <sstream>
+#include <thread>
 #include <date/date.h>
 
 namespace db = databento;
 using json = nlohmann::json;
 using databento_native::SafeStrCopy;
+using databento_native::AsyncFileWritable;
+using databento_native::FramedZstdWritable;
+using databento_native::SyncableFile;
 
 // ============================================================================
 // DBN File Writer Wrapper Structure
 // ============================================================================
 
+// Header state of a writer appending to an existing file, rewritten on close
+struct DbnAppendState {
+    db::Metadata original;      // Header as found in the file
+    size_t header_size = 0;     // Encoded size of `original`
+    db::Metadata metadata;      // Header to write, with symbols merged from the caller
+    uint64_t records = 0;       // Records in the file, including those appended
+    uint64_t max_ts_event = 0;
+    int zstd_level = 3;
+};
+
 struct DbnFileWriterWrapper {
+    // Declaration order matters: members are destroyed in reverse, so the
+    // compressor flushes its last frame before the file stream closes
     std::unique_ptr<db::OutFileStream> file_stream;
-    std::unique_ptr<db::DbnEncoder> encoder;
+    std::unique_ptr<SyncableFile> append_file;        // Set instead of file_stream in append mode
+    std::unique_ptr<FramedZstdWritable> zstd_stream;  // Null when writing uncompressed
+    std::unique_ptr<AsyncFileWritable> async_stream;  // Set instead of the above in async mode
+    std::unique_ptr<db::DbnEncoder> encoder;          // Null in append mode; the header exists
+    std::unique_ptr<DbnAppendState> append;
     std::filesystem::path file_path;
 
     DbnFileWriterWrapper(const std::filesystem::path& path,
@@ -35,6 +60,140 @@ struct DbnFileWriterWrapper {
         , encoder(std::move(enc))
         , file_path(path) {
     }
+
+    DbnFileWriterWrapper(const std::filesystem::path& path,
+                         const db::Metadata& metadata,
+                         int compression_level,
+                         size_t frame_size)
+        : file_path(path) {
+        file_stream = std::make_unique<db::OutFileStream>(path);
+        zstd_stream = std::make_unique<FramedZstdWritable>(file_stream.get(), compression_level, frame_size);
+        encoder = std::make_unique<db::DbnEncoder>(metadata, zstd_stream.get());
+    }
+
+    DbnFileWriterWrapper(const std::filesystem::path& path,
+                         const db::Metadata& metadata,
+                         const AsyncFileWritable::Options& options)
+        : file_path(path) {
+        async_stream = std::make_unique<AsyncFileWritable>(path, options);
+        encoder = std::make_unique<db::DbnEncoder>(metadata, async_stream.get());
+    }
+
+    DbnFileWriterWrapper(const std::filesystem::path& path,
+                         const databento_native::DbnAppendPlan& plan,
+                         const AsyncFileWritable::Options& options,
+                         bool async)
+        : file_path(path) {
+        // Drop a partial trailing record or frame. A final frame cut mid-record is replaced
+        // by a frame of its complete records through a journaled patch, so they stay on
+        // disk throughout; new records then start a new frame
+        if (!plan.refeed.empty()) {
+            std::vector<std::byte> frame;
+            databento_native::CompressZstdFrame(plan.refeed.data(), plan.refeed.size(), options.zstd_level, &frame);
+            databento_native::PatchDbnFile(path, plan.keep_bytes, frame, true);
+        } else if (plan.keep_bytes < std::filesystem::file_size(path)) {
+            std::filesystem::resize_file(path, plan.keep_bytes);  // Holds no complete record
+        }
+
+        if (async) {
+            AsyncFileWritable::Options append_options = options;
+            append_options.compress = plan.compressed;
+            append_options.append = true;
+            async_stream = std::make_unique<AsyncFileWritable>(path, append_options);
+        } else {
+            append_file = std::make_unique<SyncableFile>(path, SyncableFile::Mode::Append);
+            if (plan.compressed) {
+                zstd_stream = std::make_unique<FramedZstdWritable>(
+                    append_file.get(), options.zstd_level, options.frame_size);
+            }
+        }
+
+        append = std::make_unique<DbnAppendState>();
+        append->original = plan.metadata;
+        append->header_size = plan.header_size;
+        append->records = plan.records;
+        append->max_ts_event = plan.max_ts_event;
+        append->zstd_level = options.zstd_level;
+    }
+
+    ~DbnFileWriterWrapper() {
+        try {
+            Close();
+        }
+        catch (...) {
+            // Destructors must not throw
+        }
+    }
+
+    // Stream the encoder writes to; validated records are appended to it as is,
+    // which is all DbnEncoder::EncodeRecord does
+    db::IWritable* Output() {
+        if (async_stream) {
+            return async_stream.get();
+        }
+        if (zstd_stream) {
+            return zstd_stream.get();
+        }
+        return append_file ? static_cast<db::IWritable*>(append_file.get()) : file_stream.get();
+    }
+
+    void CountRecords(size_t count, uint64_t max_ts_event) {
+        if (append) {
+            append->records += count;
+            append->max_ts_event = std::max(append->max_ts_event, max_ts_event);
+        }
+    }
+
+    // Finish the last frame and close the file; in append mode, then bring the header's
+    // end timestamp and limit up to date
+    void Close() {
+        encoder.reset();
+        if (async_stream) {
+            async_stream->Close();
+            async_stream.reset();
+        }
+        if (zstd_stream) {
+            zstd_stream->Finish();
+            zstd_stream.reset();
+        }
+        if (append_file) {
+            append_file->Close();
+            append_file.reset();
+        }
+        file_stream.reset();
+        if (append) {
+            std::unique_ptr<DbnAppendState> state = std::move(append);
+            UpdateAppendHeader(*state);
+        }
+    }
+
+private:
+    void UpdateAppendHeader(const DbnAppendState& state) {
+        db::Metadata metadata = state.metadata;
+        auto end = static_cast<uint64_t>(metadata.end.time_since_epoch().count());
+        if (end != db::kUndefTimestamp && state.max_ts_event >= end && state.records > 0) {
+            metadata.end = db::UnixNanos{std::chrono::duration<uint64_t, std::nano>{state.max_ts_event + 1}};
+        }
+        if (metadata.limit != 0) {
+            metadata.limit = std::max<uint64_t>(metadata.limit, state.records);
+        }
+        // Symbol lists change the header's length, so they are only kept when the
+        // header still fits; otherwise fall back to the lists already in the file
+        std::vector<std::byte> header = databento_native::EncodeDbnHeader(metadata);
+        if (header.size() != state.header_size) {
+            metadata.symbols = state.original.symbols;
+            metadata.partial = state.original.partial;
+            metadata.not_found = state.original.not_found;
+            metadata.mappings = state.original.mappings;
+            header = databento_native::EncodeDbnHeader(metadata);
+        }
+        if (header == databento_native::EncodeDbnHeader(state.original)) {
+            return;  // Nothing changed
+        }
+        if (header.size() == state.header_size) {
+            databento_native::RewriteDbnHeader(file_path, header, state.zstd_level);
+        }
+    }
 };
 
 // ============================================================================
@@ -106,6 +265,111 @@ static db::Metadata ParseMetadataFromJson(const std::string& json_str) {
     return metadata;
 }
 
+// Parse {"compression": "zstd" | "none", "compression_level": 1-22, "frame_size": bytes,
+//        "compression_threads": n, "queue_size": bytes}
+static AsyncFileWritable::Options ParseAsyncOptions(const char* options_json) {
+    AsyncFileWritable::Options options;
+    if (!options_json || options_json[0] == '\0') {
+        return options;
+    }
+    json j = json::parse(options_json);
+    if (!j.is_object()) {
+        throw std::invalid_argument("Writer options must be a JSON object");
+    }
+    if (j.contains("compression") && !j["compression"].is_null()) {
+        std::string compression = j["compression"].get<std::string>();
+        if (compression == "none") {
+            options.compress = false;
+        } else if (compression != "zstd") {
+            throw std::invalid_argument("Unknown compression: " + compression);
+        }
+    }
+    if (j.contains("compression_level") && !j["compression_level"].is_null()) {
+        options.zstd_level = j["compression_level"].get<int>();
+    }
+    if (j.contains("frame_size") && !j["frame_size"].is_null()) {
+        options.frame_size = j["frame_size"].get<size_t>();
+    }
+    if (j.contains("compression_threads") && !j["compression_threads"].is_null()) {
+        options.compression_threads = std::max<size_t>(1, j["compression_threads"].get<size_t>());
+    }
+    if (j.contains("queue_size") && !j["queue_size"].is_null()) {
+        options.queue_size = j["queue_size"].get<size_t>();
+    }
+    return options;
+}
+
+// Check that `count` records exactly fill `length` bytes, using each record's own
+// length field; returns an error message, or nullopt when the buffer is well formed.
+// The highest ts_event in the buffer is stored in `max_ts_event` when given.
+static std::optional<std::string> ValidateRecordBuffer(const uint8_t* bytes, size_t length, size_t count,
+                                                       uint64_t* max_ts_event = nullptr) {
+    size_t pos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (length - pos < sizeof(db::RecordHeader)) {
+            return "Buffer ends inside record " + std::to_string(i) + " at offset " + std::to_string(pos);
+        }
+        size_t record_length = static_cast<size_t>(bytes[pos]) * db::RecordHeader::kLengthMultiplier;
+        if (record_length < sizeof(db::RecordHeader)) {
+            return "Record " + std::to_string(i) + " at offset " + std::to_string(pos) +
+                   " has invalid length " + std::to_string(record_length);
+        }
+        if (record_length > length - pos) {
+            return "Record " + std::to_string(i) + " at offset " + std::to_string(pos) +
+                   " extends past the end of the buffer";
+        }
+        if (max_ts_event) {
+            *max_ts_event = std::max(*max_ts_event, databento_native::RawRecordTsEvent(bytes + pos));
+        }
+        pos += record_length;
+    }
+    if (pos != length) {
+        return std::to_string(length - pos) + " bytes follow the last of " + std::to_string(count) + " records";
+    }
+    return std::nullopt;
+}
+
+// Append the entries of `extra` missing from `values`, keeping the existing order
+static void MergeSymbolList(std::vector<std::string>* values, const std::vector<std::string>& extra) {
+    for (const auto& value : extra) {
+        if (std::find(values->begin(), values->end(), value) == values->end()) {
+            values->push_back(value);
+        }
+    }
+}
+
+// Check that `update` describes the same stream as the file's header and merge its
+// symbols and mappings into `metadata`
+static void MergeAppendMetadata(db::Metadata* metadata, const db::Metadata& update) {
+    if (update.dataset != metadata->dataset || update.schema != metadata->schema ||
+        update.stype_in != metadata->stype_in || update.stype_out != metadata->stype_out ||
+        update.ts_out != metadata->ts_out) {
+        throw std::invalid_argument(
+            "Metadata does not match the existing file (dataset, schema, stype_in, stype_out and ts_out must be equal)");
+    }
+    MergeSymbolList(&metadata->symbols, update.symbols);
+    MergeSymbolList(&metadata->partial, update.partial);
+    MergeSymbolList(&metadata->not_found, update.not_found);
+    for (const auto& mapping : update.mappings) {
+        auto existing = std::find_if(metadata->mappings.begin(), metadata->mappings.end(),
+            [&mapping](const db::SymbolMapping& m) { return m.raw_symbol == mapping.raw_symbol; });
+        if (existing == metadata->mappings.end()) {
+            metadata->mappings.push_back(mapping);
+            continue;
+        }
+        for (const auto& interval : mapping.intervals) {
+            bool known = std::any_of(existing->intervals.begin(), existing->intervals.end(),
+                [&interval](const db::MappingInterval& i) {
+                    return i.start_date == interval.start_date && i.end_date == interval.end_date &&
+                           i.symbol == interval.symbol;
+                });
+            if (!known) {
+                existing->intervals.push_back(interval);
+            }
+        }
+    }
+}
+
 // ============================================================================
 // DBN File Writer API Implementation
 // ============================================================================
@@ -133,9 +397,117 @@ DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create(
         auto encoder = std::make_unique<db::DbnEncoder>(metadata, file_stream.get());
 
         // Create wrapper
-        auto* wrapper = new DbnFileWriterWrapper(path, std::move(file_stream), std::move(encoder));
+        auto wrapper = std::make_unique<DbnFileWriterWrapper>(path, std::move(file_stream), std::move(encoder));
+        return reinterpret_cast<DbnFileWriterHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_ex(
+    const char* file_path,
+    const char* metadata_json,
+    int compression,
+    int compression_level,
+    size_t frame_size,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (compression == 0) {
+            return dbento_dbn_file_create(file_path, metadata_json, error_buffer, error_buffer_size);
+        }
+        if (compression != 1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid compression (0 = none, 1 = zstd)");
+            return nullptr;
+        }
+        if (!file_path || !metadata_json) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path and metadata cannot be null");
+            return nullptr;
+        }
+
+        db::Metadata metadata = ParseMetadataFromJson(metadata_json);
+        std::filesystem::path path{file_path};
+
+        auto wrapper = std::make_unique<DbnFileWriterWrapper>(path, metadata, compression_level, frame_size);
+        return reinterpret_cast<DbnFileWriterHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_async(
+    const char* file_path,
+    const char* metadata_json,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path || !metadata_json) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path and metadata cannot be null");
+            return nullptr;
+        }
+
+        db::Metadata metadata = ParseMetadataFromJson(metadata_json);
+        AsyncFileWritable::Options options = ParseAsyncOptions(options_json);
+        std::filesystem::path path{file_path};
+
+        auto wrapper = std::make_unique<DbnFileWriterWrapper>(path, metadata, options);
         return reinterpret_cast<DbnFileWriterHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_open_append(
+    const char* file_path,
+    const char* metadata_json,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+
+        bool async = false;
+        if (options_json && options_json[0] != '\0') {
+            json j = json::parse(options_json);
+            if (j.is_object() && j.contains("compression") && !j["compression"].is_null()) {
+                throw std::invalid_argument("Appended records are compressed like the existing file; "
+                                            "compression cannot be set");
+            }
+            if (j.is_object() && j.contains("async") && !j["async"].is_null()) {
+                async = j["async"].get<bool>();
+            }
+        }
+        AsyncFileWritable::Options options = ParseAsyncOptions(options_json);
+
+        std::filesystem::path path{file_path};
+        size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        databento_native::DbnAppendPlan plan = databento_native::PlanDbnAppend(path, threads);
+        db::Metadata merged = plan.metadata;
+        if (metadata_json && metadata_json[0] != '\0') {
+            // Validated before the file is touched
+            MergeAppendMetadata(&merged, ParseMetadataFromJson(metadata_json));
+        }
+
+        auto wrapper = std::make_unique<DbnFileWriterWrapper>(path, plan, options, async);
+        wrapper->append->metadata = std::move(merged);
+        return reinterpret_cast<DbnFileWriterHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -154,9 +526,9 @@ DATABENTO_API int dbento_dbn_file_write_record(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
             handle, databento_native::HandleType::DbnFileWriter, &validation_error);
-        if (!wrapper || !wrapper->encoder) {
+        if (!wrapper || !wrapper->Output()) {
             SafeStrCopy(error_buffer, error_buffer_size,
-                wrapper ? "Encoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+                wrapper ? "Writer is closed" : databento_native::GetValidationErrorMessage(validation_error));
             return -1;
         }
 
@@ -164,16 +536,15 @@ DATABENTO_API int dbento_dbn_file_write_record(
             SafeStrCopy(error_buffer, error_buffer_size, "Invalid record data");
             return -1;
         }
+        uint64_t max_ts_event = 0;
+        if (auto error = ValidateRecordBuffer(record_bytes, record_length, 1, &max_ts_event)) {
+            SafeStrCopy(error_buffer, error_buffer_size, error->c_str());
+            return -1;
+        }
 
-        // Create Record from raw bytes (Record constructor requires mutable pointer)
-        // Copy data to mutable buffer to avoid const_cast undefined behavior
-        std::vector<uint8_t> mutable_copy(record_bytes, record_bytes + record_length);
-        const db::Record record{reinterpret_cast<db::RecordHeader*>(mutable_copy.data())};
-
-        // SAFETY: EncodeRecord processes the record synchronously and does not store
-        // the pointer. The mutable_copy vector remains alive until after EncodeRecord
-        // returns, ensuring no use-after-free. This is safe by design of databento-cpp.
-        wrapper->encoder->EncodeRecord(record);
+        // Written straight from the caller's memory; the record is not copied
+        wrapper->Output()->WriteAll(reinterpret_cast<const std::byte*>(record_bytes), record_length);
+        wrapper->CountRecords(1, max_ts_event);
 
         return 0; // Success
     }
@@ -183,13 +554,126 @@ DATABENTO_API int dbento_dbn_file_write_record(
     }
 }
 
+DATABENTO_API int dbento_dbn_file_write_records(
+    DbnFileWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper || !wrapper->Output()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Writer is closed" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (count == 0 && length == 0) {
+            return 0;
+        }
+        if (!records) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid record data");
+            return -1;
+        }
+        // Validate the whole batch first, so a malformed buffer writes nothing
+        uint64_t max_ts_event = 0;
+        if (auto error = ValidateRecordBuffer(records, length, count, &max_ts_event)) {
+            SafeStrCopy(error_buffer, error_buffer_size, error->c_str());
+            return -1;
+        }
+
+        wrapper->Output()->WriteAll(reinterpret_cast<const std::byte*>(records), length);
+        wrapper->CountRecords(count, max_ts_event);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_flush(
+    DbnFileWriterHandle handle,
+    int sync,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!wrapper->async_stream) {
+            if (sync != 0) {
+                SafeStrCopy(error_buffer, error_buffer_size, "Sync requires a writer created in asynchronous mode");
+                return -1;
+            }
+            return 0;  // Synchronous writers write on the caller's thread
+        }
+
+        if (sync != 0) {
+            wrapper->async_stream->Sync();
+        } else {
+            wrapper->async_stream->Flush();
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_close_writer_ex(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        int result = 0;
+        try {
+            // Finishes the last frame (rethrowing a background write error), closes the
+            // file and, for appends, updates the header
+            wrapper->Close();
+        }
+        catch (const std::exception& e) {
+            SafeStrCopy(error_buffer, error_buffer_size, e.what());
+            result = -1;
+        }
+        // The handle is released either way; the destructor cleans up after a failed close
+        databento_native::DestroyValidatedHandle(handle);
+        delete wrapper;
+        return result;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
 DATABENTO_API void dbento_dbn_file_close_writer(DbnFileWriterHandle handle)
 {
     try {
         auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
             handle, databento_native::HandleType::DbnFileWriter, nullptr);
         if (wrapper) {
-            // Destructor will automatically flush and close the file stream
+            // Destructor finishes the last frame, closes the file and, for appends,
+            // updates the header
             delete wrapper;
             databento_native::DestroyValidatedHandle(handle);
         }
@@ -0,0 +1,840 @@
+#pragma once
+
+#include "mapped_file.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/ireadable.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+// "DBN" + version byte + uint32 metadata length
+constexpr size_t kDbnPreludeSize = 8;
+// Offsets within the common record header (identical in every DBN version)
+constexpr size_t kRecordHeaderSize = 16;
+constexpr size_t kRecordInstrumentIdOffset = 4;
+constexpr size_t kRecordTsEventOffset = 8;
+
+constexpr uint64_t kDefaultIndexRecordInterval = 4096;
+constexpr uint64_t kDefaultIndexByteInterval = 1024 * 1024;
+
+// ============================================================================
+// Readable Building Blocks
+// ============================================================================
+
+/**
+ * Discard the next `length` bytes of a stream
+ */
+inline void SkipBytes(databento::IReadable* input, uint64_t length) {
+    std::byte scratch[16384];
+    while (length > 0) {
+        size_t n = input->ReadSome(scratch, static_cast<size_t>(std::min<uint64_t>(length, sizeof(scratch))));
+        if (n == 0) {
+            throw std::runtime_error("Unexpected end of DBN stream");
+        }
+        length -= n;
+    }
+}
+
+/**
+ * IReadable over a byte range of a mapped file
+ */
+class MemoryReadable : public databento::IReadable {
+public:
+    MemoryReadable(std::shared_ptr<const MappedFile> file, size_t offset)
+        : file_(std::move(file))
+        , pos_(std::min(offset, file_->Size()))
+    {}
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        if (length > file_->Size() - pos_) {
+            throw std::runtime_error("Unexpected end of DBN file");
+        }
+        ReadSome(buffer, length);
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        size_t n = std::min(max_length, file_->Size() - pos_);
+        std::memcpy(buffer, file_->Data() + pos_, n);
+        pos_ += n;
+        return n;
+    }
+
+private:
+    std::shared_ptr<const MappedFile> file_;
+    size_t pos_;
+};
+
+/**
+ * IReadable that yields a fixed prefix, then continues with another stream
+ * Used to put the original DBN header in front of a stream positioned mid-file
+ */
+class SpliceReadable : public databento::IReadable {
+public:
+    SpliceReadable(std::vector<std::byte> prefix, std::unique_ptr<databento::IReadable> tail)
+        : prefix_(std::move(prefix))
+        , tail_(std::move(tail))
+    {}
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t n = ReadPrefix(buffer, length);
+        if (n < length) {
+            tail_->ReadExact(buffer + n, length - n);
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        size_t n = ReadPrefix(buffer, max_length);
+        if (n > 0) {
+            return n;
+        }
+        return tail_->ReadSome(buffer, max_length);
+    }
+
+private:
+    size_t ReadPrefix(std::byte* buffer, size_t max_length) {
+        size_t n = std::min(max_length, prefix_.size() - prefix_pos_);
+        std::memcpy(buffer, prefix_.data() + prefix_pos_, n);
+        prefix_pos_ += n;
+        return n;
+    }
+
+    std::vector<std::byte> prefix_;
+    size_t prefix_pos_ = 0;
+    std::unique_ptr<databento::IReadable> tail_;
+};
+
+/**
+ * Read the DBN prelude and metadata block from the start of a stream
+ * @return Raw header bytes; the stream is left at the first record
+ */
+inline std::vector<std::byte> ReadDbnHeader(databento::IReadable* input) {
+    std::vector<std::byte> header(kDbnPreludeSize);
+    input->ReadExact(header.data(), kDbnPreludeSize);
+    if (std::memcmp(header.data(), "DBN", 3) != 0) {
+        throw std::invalid_argument("Not a DBN stream");
+    }
+    uint32_t metadata_size;
+    std::memcpy(&metadata_size, header.data() + 4, sizeof(metadata_size));
+    header.resize(kDbnPreludeSize + metadata_size);
+    input->ReadExact(header.data() + kDbnPreludeSize, metadata_size);
+    return header;
+}
+
+/**
+ * Open the decompressed (logical) byte stream of a DBN file at a given offset
+ *
+ * For zstd files, decompression starts at the frame containing the offset and
+ * the bytes before it within that frame are discarded.
+ * @param frame_file_offset Compressed file offset of the enclosing frame (ignored when uncompressed)
+ * @param frame_logical_offset Logical offset of that frame's first byte (ignored when uncompressed)
+ * @param logical_offset Logical offset to position the stream at
+ */
+inline std::unique_ptr<databento::IReadable> OpenDbnStreamAt(
+    std::shared_ptr<const MappedFile> file,
+    uint64_t frame_file_offset,
+    uint64_t frame_logical_offset,
+    uint64_t logical_offset)
+{
+    if (!StartsWithZstdMagic(file->Data(), file->Size())) {
+        return std::make_unique<MemoryReadable>(std::move(file), static_cast<size_t>(logical_offset));
+    }
+    if (logical_offset < frame_logical_offset) {
+        throw std::invalid_argument("Logical offset precedes its frame");
+    }
+    auto stream = std::make_unique<ZstdStreamReadable>(std::move(file), frame_file_offset, frame_logical_offset);
+    SkipBytes(stream.get(), logical_offset - frame_logical_offset);
+    return stream;
+}
+
+/**
+ * Iterates raw records from the logical DBN stream without decoding them
+ *
+ * Records are returned in their stored version; pointers are valid until the next call.
+ */
+class RawRecordScanner {
+public:
+    /**
+     * @param input Stream positioned at a record boundary
+     * @param logical_offset Logical offset of that boundary
+     */
+    RawRecordScanner(databento::IReadable* input, uint64_t logical_offset)
+        : input_(input)
+        , buffer_(kChunkSize)
+        , buffer_offset_(logical_offset)
+    {}
+
+    /**
+     * @param logical_offset Set to the logical offset of the returned record
+     * @return Next record, or nullptr at end of stream
+     */
+    const uint8_t* Next(uint64_t* logical_offset) {
+        if (!EnsureAvailable(1)) {
+            return nullptr;
+        }
+        size_t length = static_cast<size_t>(buffer_[pos_]) * 4;
+        if (length < kRecordHeaderSize) {
+            throw std::runtime_error("Malformed DBN record length");
+        }
+        if (!EnsureAvailable(length)) {
+            throw std::runtime_error("Truncated DBN record");
+        }
+        const uint8_t* record = buffer_.data() + pos_;
+        *logical_offset = buffer_offset_ + pos_;
+        pos_ += length;
+        return record;
+    }
+
+    /**
+     * Contiguous run of records sharing the first record's length and rtype
+     * The run is not consumed; call Consume with the bytes actually used.
+     * @param max_records Maximum run length
+     * @param run Output: first record of the run
+     * @param stride Output: length of each record
+     * @return Records in the run (at least 1), or 0 at end of stream
+     */
+    size_t PeekRun(size_t max_records, const uint8_t** run, size_t* stride) {
+        if (!EnsureAvailable(1)) {
+            return 0;
+        }
+        size_t length = static_cast<size_t>(buffer_[pos_]) * 4;
+        if (length < kRecordHeaderSize) {
+            throw std::runtime_error("Malformed DBN record length");
+        }
+        if (!EnsureAvailable(length)) {
+            throw std::runtime_error("Truncated DBN record");
+        }
+        size_t count = 1;
+        size_t next = pos_ + length;
+        while (count < max_records && end_ - next >= length &&
+               buffer_[next] == buffer_[pos_] && buffer_[next + 1] == buffer_[pos_ + 1]) {
+            next += length;
+            ++count;
+        }
+        *run = buffer_.data() + pos_;
+        *stride = length;
+        return count;
+    }
+
+    void Consume(size_t bytes) { pos_ += bytes; }
+
+    /**
+     * Logical offset just past the last record returned
+     */
+    uint64_t Offset() const { return buffer_offset_ + pos_; }
+
+private:
+    static constexpr size_t kChunkSize = 1024 * 1024;
+
+    // False only when the stream ends with fewer than `length` bytes left
+    bool EnsureAvailable(size_t length) {
+        while (end_ - pos_ < length) {
+            if (pos_ > 0) {
+                std::memmove(buffer_.data(), buffer_.data() + pos_, end_ - pos_);
+                buffer_offset_ += pos_;
+                end_ -= pos_;
+                pos_ = 0;
+            }
+            if (buffer_.size() - end_ < kChunkSize / 2) {
+                buffer_.resize(std::max(buffer_.size() * 2, length));
+            }
+            size_t n = input_->ReadSome(reinterpret_cast<std::byte*>(buffer_.data() + end_), buffer_.size() - end_);
+            if (n == 0) {
+                return false;
+            }
+            end_ += n;
+        }
+        return true;
+    }
+
+    databento::IReadable* input_;
+    std::vector<uint8_t> buffer_;
+    uint64_t buffer_offset_;  // Logical offset of buffer_[0]
+    size_t pos_ = 0;
+    size_t end_ = 0;
+};
+
+inline uint32_t RawRecordInstrumentId(const uint8_t* record) {
+    uint32_t instrument_id;
+    std::memcpy(&instrument_id, record + kRecordInstrumentIdOffset, sizeof(instrument_id));
+    return instrument_id;
+}
+
+inline uint64_t RawRecordTsEvent(const uint8_t* record) {
+    uint64_t ts;
+    std::memcpy(&ts, record + kRecordTsEventOffset, sizeof(ts));
+    return ts;
+}
+
+// ============================================================================
+// Sparse File Index
+// ============================================================================
+
+/**
+ * Resume point in a DBN file; also the start of an index block
+ *
+ * max_ts_before is the highest ts_event of every record before the checkpoint,
+ * so seeking to T may start at any checkpoint with max_ts_before < T without
+ * skipping a matching record, even when ts_event is not strictly monotonic.
+ */
+struct DbnIndexCheckpoint {
+    uint64_t max_ts_before;
+    uint64_t record_index;
+    uint64_t logical_offset;        // Offset in the decompressed stream
+    uint64_t frame_file_offset;     // Compressed offset of the enclosing zstd frame (0 if uncompressed)
+    uint64_t frame_logical_offset;  // Logical offset of that frame's first byte
+};
+
+/**
+ * Posting list location for one instrument
+ */
+struct DbnInstrumentPostings {
+    uint32_t instrument_id;
+    uint32_t block_count;
+    uint64_t first_posting;  // Index into the shared posting array
+};
+
+/**
+ * Sparse index over a DBN file, persisted as a `<file>.idx` sidecar
+ *
+ * Checkpoints are taken every N records or M decompressed bytes and split the
+ * file into blocks. For each instrument_id the index keeps the sorted list of
+ * blocks containing at least one of its records, so selective reads can skip
+ * every other block.
+ *
+ * The sidecar records the source file's size and modification time and is
+ * ignored once either changes. Single-frame zstd files have only one frame to
+ * start from, so seeking in them still decompresses from the beginning but
+ * skips decoding; files written with independent frames seek directly.
+ * Integers are stored in host byte order (little-endian on all supported targets).
+ */
+class DbnFileIndex {
+public:
+    static constexpr char kMagic[8] = {'D', 'B', 'N', 'T', 'S', 'I', 'D', 'X'};
+    // v2 added per-instrument block postings
+    static constexpr uint32_t kVersion = 2;
+
+    static std::filesystem::path SidecarPath(const std::filesystem::path& dbn_path) {
+        std::filesystem::path sidecar = dbn_path;
+        sidecar += ".idx";
+        return sidecar;
+    }
+
+    /**
+     * Scan a DBN file and collect checkpoints and instrument postings
+     * @param cancel Optional flag polled between records; the build throws once it is set
+     */
+    static DbnFileIndex Build(const std::filesystem::path& dbn_path,
+                              uint64_t record_interval = kDefaultIndexRecordInterval,
+                              uint64_t byte_interval = kDefaultIndexByteInterval,
+                              const std::atomic<bool>* cancel = nullptr)
+    {
+        if (record_interval == 0 && byte_interval == 0) {
+            throw std::invalid_argument("Record and byte intervals cannot both be zero");
+        }
+
+        DbnFileIndex index;
+        index.record_interval_ = record_interval;
+        index.byte_interval_ = byte_interval;
+        index.source_size_ = std::filesystem::file_size(dbn_path);
+        index.source_mtime_ = SourceMtime(dbn_path);
+
+        auto file = std::make_shared<MappedFile>(dbn_path);
+        file->Advise(MappedAccess::Sequential);
+        index.compressed_ = StartsWithZstdMagic(file->Data(), file->Size());
+
+        std::unique_ptr<databento::IReadable> input;
+        ZstdStreamReadable* zstd = nullptr;
+        if (index.compressed_) {
+            auto stream = std::make_unique<ZstdStreamReadable>(file, 0, 0);
+            zstd = stream.get();
+            input = std::move(stream);
+        } else {
+            input = std::make_unique<MemoryReadable>(file, 0);
+        }
+
+        uint64_t records_begin = ReadDbnHeader(input.get()).size();
+        RawRecordScanner scanner{input.get(), records_begin};
+
+        std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+        std::vector<uint32_t>* last_list = nullptr;
+        uint32_t last_instrument = 0;
+        uint64_t max_ts = 0;
+        uint64_t count = 0;
+        uint64_t last_checkpoint_offset = 0;
+        uint64_t offset;
+        while (const uint8_t* record = scanner.Next(&offset)) {
+            if ((count & 0xFFF) == 0 && cancel && cancel->load(std::memory_order_relaxed)) {
+                throw std::runtime_error("Index build cancelled");
+            }
+            bool due = count == 0 ||
+                (record_interval > 0 && count - index.checkpoints_.back().record_index >= record_interval) ||
+                (byte_interval > 0 && offset - last_checkpoint_offset >= byte_interval);
+            if (due) {
+                DbnIndexCheckpoint checkpoint{max_ts, count, offset, 0, 0};
+                if (zstd) {
+                    std::tie(checkpoint.frame_file_offset, checkpoint.frame_logical_offset) = zstd->FrameAt(offset);
+                }
+                index.checkpoints_.push_back(checkpoint);
+                last_checkpoint_offset = offset;
+            }
+            max_ts = std::max(max_ts, RawRecordTsEvent(record));
+
+            // Consecutive records usually share an instrument; skip the hash lookup for them
+            uint32_t instrument_id = RawRecordInstrumentId(record);
+            if (!last_list || instrument_id != last_instrument) {
+                last_list = &postings[instrument_id];
+                last_instrument = instrument_id;
+            }
+            auto block = static_cast<uint32_t>(index.checkpoints_.size() - 1);
+            if (last_list->empty() || last_list->back() != block) {
+                last_list->push_back(block);
+            }
+            ++count;
+        }
+        index.record_count_ = count;
+
+        index.instruments_.reserve(postings.size());
+        for (const auto& [instrument_id, blocks] : postings) {
+            index.instruments_.push_back({instrument_id, static_cast<uint32_t>(blocks.size()), 0});
+        }
+        std::sort(index.instruments_.begin(), index.instruments_.end(),
+            [](const DbnInstrumentPostings& a, const DbnInstrumentPostings& b) {
+                return a.instrument_id < b.instrument_id;
+            });
+        for (auto& entry : index.instruments_) {
+            const auto& blocks = postings[entry.instrument_id];
+            entry.first_posting = index.postings_.size();
+            index.postings_.insert(index.postings_.end(), blocks.begin(), blocks.end());
+        }
+        return index;
+    }
+
+    /**
+     * Load the sidecar for a DBN file
+     * Counts and offsets read from disk are checked before anything is sized from
+     * them, so a truncated or corrupt sidecar is treated as missing and rebuilt.
+     * @return Index, or nullopt if missing, unreadable, stale, corrupt or an older format
+     */
+    static std::optional<DbnFileIndex> Load(const std::filesystem::path& dbn_path) {
+        std::error_code ec;
+        uint64_t source_size = std::filesystem::file_size(dbn_path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        std::filesystem::path sidecar = SidecarPath(dbn_path);
+        uint64_t sidecar_size = std::filesystem::file_size(sidecar, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        std::ifstream in(sidecar, std::ios::binary);
+        if (!in) {
+            return std::nullopt;
+        }
+
+        char magic[sizeof(kMagic)];
+        uint32_t version = 0;
+        uint32_t flags = 0;
+        uint64_t checkpoint_count = 0;
+        uint64_t instrument_count = 0;
+        uint64_t posting_count = 0;
+        DbnFileIndex index;
+        in.read(magic, sizeof(magic));
+        ReadPod(in, &version);
+        ReadPod(in, &flags);
+        ReadPod(in, &index.source_size_);
+        ReadPod(in, &index.source_mtime_);
+        ReadPod(in, &index.record_count_);
+        ReadPod(in, &index.record_interval_);
+        ReadPod(in, &index.byte_interval_);
+        ReadPod(in, &checkpoint_count);
+        ReadPod(in, &instrument_count);
+        ReadPod(in, &posting_count);
+        if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || version != kVersion ||
+            index.source_size_ != source_size || index.source_mtime_ != SourceMtime(dbn_path) ||
+            checkpoint_count > index.record_count_ + 1 || posting_count > index.record_count_ ||
+            instrument_count > posting_count) {
+            return std::nullopt;
+        }
+        // The arrays must fill the rest of the file exactly
+        uint64_t remaining = sidecar_size - std::min<uint64_t>(sidecar_size, kHeaderSize);
+        if (!TakeArrayBytes<DbnIndexCheckpoint>(checkpoint_count, &remaining) ||
+            !TakeArrayBytes<DbnInstrumentPostings>(instrument_count, &remaining) ||
+            !TakeArrayBytes<uint32_t>(posting_count, &remaining) || remaining != 0) {
+            return std::nullopt;
+        }
+        index.compressed_ = (flags & kFlagCompressed) != 0;
+        index.checkpoints_.resize(static_cast<size_t>(checkpoint_count));
+        index.instruments_.resize(static_cast<size_t>(instrument_count));
+        index.postings_.resize(static_cast<size_t>(posting_count));
+        ReadArray(in, &index.checkpoints_);
+        ReadArray(in, &index.instruments_);
+        ReadArray(in, &index.postings_);
+        if (!in) {
+            return std::nullopt;
+        }
+        for (const auto& checkpoint : index.checkpoints_) {
+            if (checkpoint.frame_file_offset > source_size ||
+                checkpoint.frame_logical_offset > checkpoint.logical_offset) {
+                return std::nullopt;
+            }
+        }
+        for (const auto& entry : index.instruments_) {
+            if (entry.first_posting > posting_count || entry.block_count > posting_count - entry.first_posting) {
+                return std::nullopt;
+            }
+        }
+        for (uint32_t block : index.postings_) {
+            if (block >= checkpoint_count) {
+                return std::nullopt;
+            }
+        }
+        return index;
+    }
+
+    /**
+     * Write the sidecar next to the DBN file
+     * The file is written under a temporary name and renamed, so readers never see a partial index
+     */
+    void Save(const std::filesystem::path& dbn_path) const {
+        std::filesystem::path sidecar = SidecarPath(dbn_path);
+        std::filesystem::path temp = sidecar;
+        temp += ".tmp";
+        {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw std::runtime_error("Failed to create index file: " + temp.string());
+            }
+            uint32_t flags = compressed_ ? kFlagCompressed : 0;
+            out.write(kMagic, sizeof(kMagic));
+            WritePod(out, kVersion);
+            WritePod(out, flags);
+            WritePod(out, source_size_);
+            WritePod(out, source_mtime_);
+            WritePod(out, record_count_);
+            WritePod(out, record_interval_);
+            WritePod(out, byte_interval_);
+            WritePod(out, static_cast<uint64_t>(checkpoints_.size()));
+            WritePod(out, static_cast<uint64_t>(instruments_.size()));
+            WritePod(out, static_cast<uint64_t>(postings_.size()));
+            WriteArray(out, checkpoints_);
+            WriteArray(out, instruments_);
+            WriteArray(out, postings_);
+            if (!out.flush()) {
+                throw std::runtime_error("Failed to write index file: " + temp.string());
+            }
+        }
+        std::filesystem::rename(temp, sidecar);
+    }
+
+    /**
+     * Latest checkpoint from which seeking to `ts_event` loses no matching record
+     * @return Block index of the checkpoint, or -1 for an empty file
+     */
+    ptrdiff_t FindCheckpoint(uint64_t ts_event) const {
+        // max_ts_before is non-decreasing, so the candidates form a prefix
+        auto it = std::partition_point(checkpoints_.begin(), checkpoints_.end(),
+            [ts_event](const DbnIndexCheckpoint& checkpoint) {
+                return checkpoint.record_index == 0 || checkpoint.max_ts_before < ts_event;
+            });
+        return (it - checkpoints_.begin()) - 1;
+    }
+
+    /**
+     * Sorted, de-duplicated blocks containing any of the given instruments
+     */
+    std::vector<uint32_t> BlocksFor(const uint32_t* instrument_ids, size_t count) const {
+        std::vector<uint32_t> blocks;
+        for (size_t i = 0; i < count; ++i) {
+            auto it = std::lower_bound(instruments_.begin(), instruments_.end(), instrument_ids[i],
+                [](const DbnInstrumentPostings& entry, uint32_t id) { return entry.instrument_id < id; });
+            if (it != instruments_.end() && it->instrument_id == instrument_ids[i]) {
+                auto first = postings_.begin() + static_cast<ptrdiff_t>(it->first_posting);
+                blocks.insert(blocks.end(), first, first + it->block_count);
+            }
+        }
+        std::sort(blocks.begin(), blocks.end());
+        blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+        return blocks;
+    }
+
+    /**
+     * Logical byte range of a block; the last block's end is UINT64_MAX (end of stream)
+     */
+    std::pair<uint64_t, uint64_t> BlockRange(size_t block) const {
+        uint64_t end = block + 1 < checkpoints_.size() ? checkpoints_[block + 1].logical_offset : UINT64_MAX;
+        return {checkpoints_[block].logical_offset, end};
+    }
+
+    const std::vector<DbnIndexCheckpoint>& Checkpoints() const { return checkpoints_; }
+    uint64_t RecordCount() const { return record_count_; }
+    size_t InstrumentCount() const { return instruments_.size(); }
+    bool Compressed() const { return compressed_; }
+
+private:
+    static constexpr uint32_t kFlagCompressed = 1;
+    // Magic, version and flags, then eight uint64 fields ahead of the arrays
+    static constexpr uint64_t kHeaderSize = sizeof(kMagic) + 2 * sizeof(uint32_t) + 8 * sizeof(uint64_t);
+
+    static int64_t SourceMtime(const std::filesystem::path& path) {
+        std::error_code ec;
+        auto mtime = std::filesystem::last_write_time(path, ec);
+        return ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+    }
+
+    template <typename T>
+    static void ReadPod(std::ifstream& in, T* value) {
+        in.read(reinterpret_cast<char*>(value), sizeof(T));
+    }
+
+    template <typename T>
+    static void WritePod(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /**
+     * Subtract the size of `count` elements of T from `remaining`
+     * @return false if they don't fit
+     */
+    template <typename T>
+    static bool TakeArrayBytes(uint64_t count, uint64_t* remaining) {
+        if (count > *remaining / sizeof(T)) {
+            return false;
+        }
+        *remaining -= count * sizeof(T);
+        return true;
+    }
+
+    template <typename T>
+    static void ReadArray(std::ifstream& in, std::vector<T>* values) {
+        in.read(reinterpret_cast<char*>(values->data()), static_cast<std::streamsize>(values->size() * sizeof(T)));
+    }
+
+    template <typename T>
+    static void WriteArray(std::ofstream& out, const std::vector<T>& values) {
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    std::vector<DbnIndexCheckpoint> checkpoints_;
+    std::vector<DbnInstrumentPostings> instruments_;  // Sorted by instrument_id
+    std::vector<uint32_t> postings_;
+    uint64_t source_size_ = 0;
+    int64_t source_mtime_ = 0;
+    uint64_t record_count_ = 0;
+    uint64_t record_interval_ = 0;
+    uint64_t byte_interval_ = 0;
+    bool compressed_ = false;
+};
+
+/**
+ * Build the index for a DBN file and persist it next to the file
+ * A read-only directory only costs the sidecar; the in-memory index is still returned.
+ */
+inline DbnFileIndex BuildAndSaveIndex(const std::filesystem::path& path, const std::atomic<bool>* cancel = nullptr) {
+    DbnFileIndex index = DbnFileIndex::Build(path, kDefaultIndexRecordInterval, kDefaultIndexByteInterval, cancel);
+    try {
+        index.Save(path);
+    }
+    catch (const std::exception&) {
+        // Keep the in-memory index
+    }
+    return index;
+}
+
+// ============================================================================
+// Selective Block Reads
+// ============================================================================
+
+/**
+ * IReadable over selected blocks of a DBN file's logical stream, back to back
+ *
+ * Blocks must be in ascending order. Zstd input keeps decompressing forward
+ * while the next block is within the current frame and reopens at the next
+ * block's frame otherwise, so skipped frames are never decompressed.
+ */
+class BlockRangeReadable : public databento::IReadable {
+public:
+    BlockRangeReadable(std::shared_ptr<const MappedFile> file, const DbnFileIndex& index, std::vector<uint32_t> blocks)
+        : file_(std::move(file))
+        , index_(index)
+        , blocks_(std::move(blocks))
+    {}
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t read = 0;
+        while (read < length) {
+            size_t n = ReadSome(buffer + read, length - read);
+            if (n == 0) {
+                throw std::runtime_error("Unexpected end of DBN stream");
+            }
+            read += n;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        while (true) {
+            if (stream_ && position_ < range_end_) {
+                uint64_t remaining = range_end_ - position_;
+                size_t n = stream_->ReadSome(buffer, static_cast<size_t>(std::min<uint64_t>(max_length, remaining)));
+                if (n > 0) {
+                    position_ += n;
+                    return n;
+                }
+                if (range_end_ != UINT64_MAX) {
+                    throw std::runtime_error("Unexpected end of DBN stream");
+                }
+            }
+            if (next_block_ >= blocks_.size()) {
+                return 0;
+            }
+            OpenNextRange();
+        }
+    }
+
+private:
+    // Positions the stream at the next run of adjacent blocks
+    void OpenNextRange() {
+        size_t first = blocks_[next_block_];
+        size_t last = first;
+        while (++next_block_ < blocks_.size() && blocks_[next_block_] == last + 1) {
+            last = blocks_[next_block_];
+        }
+        const DbnIndexCheckpoint& checkpoint = index_.Checkpoints()[first];
+        uint64_t begin = checkpoint.logical_offset;
+        range_end_ = index_.BlockRange(last).second;
+
+        bool same_frame = stream_ && index_.Compressed() &&
+            checkpoint.frame_logical_offset <= position_ && position_ <= begin;
+        if (same_frame) {
+            SkipBytes(stream_.get(), begin - position_);
+        } else {
+            stream_ = OpenDbnStreamAt(file_, checkpoint.frame_file_offset, checkpoint.frame_logical_offset, begin);
+        }
+        position_ = begin;
+    }
+
+    std::shared_ptr<const MappedFile> file_;
+    const DbnFileIndex& index_;
+    std::vector<uint32_t> blocks_;
+    size_t next_block_ = 0;
+    std::unique_ptr<databento::IReadable> stream_;
+    uint64_t position_ = 0;  // Logical offset of stream_
+    uint64_t range_end_ = 0;
+};
+
+// ============================================================================
+// Parallel Scan Planning
+// ============================================================================
+
+/**
+ * One input file of a parallel scan
+ */
+struct DbnScanFile {
+    std::filesystem::path path;
+    std::shared_ptr<const MappedFile> mapped;
+    std::vector<std::byte> header;      // Raw prelude and metadata
+    std::optional<DbnFileIndex> index;  // Absent for compressed files without a sidecar
+
+    uint8_t Version() const { return static_cast<uint8_t>(header[3]); }
+};
+
+/**
+ * Contiguous range of index blocks of one file, scanned start to end by one worker
+ */
+struct DbnScanUnit {
+    size_t file;
+    size_t first_block;
+    size_t end_block;  // Exclusive; both are ignored when the file has no index
+    uint64_t records;  // Expected record count, for scheduling only
+};
+
+/**
+ * Map a file and load its index for a parallel scan
+ * A missing index is built for uncompressed files, where the scan is a cheap walk over the
+ * mapping; compressed files without a sidecar are scanned whole by a single worker.
+ */
+inline DbnScanFile OpenScanFile(const std::filesystem::path& path) {
+    DbnScanFile file;
+    file.path = path;
+    auto mapped = std::make_shared<MappedFile>(path);
+    mapped->Advise(MappedAccess::Sequential);
+    file.mapped = mapped;
+    file.header = ReadDbnHeader(OpenDbnStreamAt(file.mapped, 0, 0, 0).get());
+    file.index = DbnFileIndex::Load(path);
+    if (!file.index && !StartsWithZstdMagic(mapped->Data(), mapped->Size())) {
+        file.index = BuildAndSaveIndex(path);
+    }
+    return file;
+}
+
+/**
+ * Split files into units of roughly equal record counts
+ *
+ * Compressed files are only cut where a new zstd frame starts, so no worker
+ * decompresses bytes that belong to another unit. Units are returned largest
+ * first, which keeps the tail of a work-stealing scan short.
+ * @param target_units Desired number of units across all files
+ */
+inline std::vector<DbnScanUnit> PlanScanUnits(const std::vector<DbnScanFile>& files, size_t target_units) {
+    uint64_t total_records = 0;
+    for (const auto& file : files) {
+        total_records += file.index ? file.index->RecordCount() : 0;
+    }
+    uint64_t unit_records = std::max<uint64_t>(1, total_records / std::max<size_t>(1, target_units));
+
+    std::vector<DbnScanUnit> units;
+    for (size_t f = 0; f < files.size(); ++f) {
+        const auto& index = files[f].index;
+        if (!index) {
+            // Unknown size: schedule it first, since it can't be split
+            units.push_back({f, 0, 0, UINT64_MAX});
+            continue;
+        }
+        const auto& checkpoints = index->Checkpoints();
+        size_t first = 0;
+        for (size_t block = 1; block <= checkpoints.size(); ++block) {
+            uint64_t records = (block < checkpoints.size() ? checkpoints[block].record_index : index->RecordCount()) -
+                checkpoints[first].record_index;
+            bool at_end = block == checkpoints.size();
+            bool can_cut = at_end || !index->Compressed() ||
+                checkpoints[block].frame_file_offset != checkpoints[block - 1].frame_file_offset;
+            if (at_end || (can_cut && records >= unit_records)) {
+                units.push_back({f, first, block, records});
+                first = block;
+            }
+        }
+    }
+    std::stable_sort(units.begin(), units.end(),
+        [](const DbnScanUnit& a, const DbnScanUnit& b) { return a.records > b.records; });
+    return units;
+}
+
+/**
+ * Stream of the records in a unit, without the file header
+ */
+inline std::unique_ptr<databento::IReadable> OpenScanUnit(const DbnScanFile& file, const DbnScanUnit& unit) {
+    if (!file.index) {
+        return OpenDbnStreamAt(file.mapped, 0, 0, file.header.size());
+    }
+    std::vector<uint32_t> blocks;
+    for (size_t block = unit.first_block; block < unit.end_block; ++block) {
+        blocks.push_back(static_cast<uint32_t>(block));
+    }
+    return std::make_unique<BlockRangeReadable>(file.mapped, *file.index, std::move(blocks));
+}
+
+}  // namespace databento_native
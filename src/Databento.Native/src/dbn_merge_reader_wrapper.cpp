@@ -0,0 +1,494 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "handle_validation.hpp"
+#include "mapped_file.hpp"
+#include "metadata_json.hpp"
+#include "record_utils.hpp"
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace db = databento;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::MetadataToJson;
+using databento_native::ValidateInputFiles;
+using databento_native::MappedFile;
+using databento_native::MappedAccess;
+
+// ============================================================================
+// DBN Merge Reader Internals
+// ============================================================================
+
+namespace {
+
+// Decoded bytes per block and input; two blocks per input are held, one being
+// merged and one being decoded ahead, small enough that hundreds of inputs stay
+// cache friendly and large enough to amortize handing work to the decode pool
+constexpr size_t kInputBufferBytes = 64 * 1024;
+// Key of an exhausted input; sorts after every real timestamp
+constexpr uint64_t kExhaustedKey = UINT64_MAX;
+
+enum class MergeOrder {
+    EventTime = 0,    // ts_event
+    ReceiveTime = 1   // ts_recv where the schema has one, ts_event otherwise
+};
+
+/**
+ * A run of decoded records from one input, back to back
+ */
+struct MergeBlock {
+    std::vector<uint8_t> buffer;     // Decoded records, back to back
+    std::vector<uint64_t> keys;      // Merge key of each record
+    std::vector<uint32_t> offsets;   // Offset of each record in `buffer`
+    bool eof = false;                // The input has nothing after this block
+
+    /**
+     * Decode the next run of records from `decoder`, replacing the block's contents
+     */
+    void Decode(db::DbnDecoder* decoder, MergeOrder order) {
+        buffer.clear();
+        keys.clear();
+        offsets.clear();
+        eof = false;
+        while (buffer.size() < kInputBufferBytes) {
+            const db::Record* record = decoder->DecodeRecord();
+            if (!record) {
+                eof = true;
+                break;
+            }
+            size_t size = record->Size();
+            size_t offset = buffer.size();
+            buffer.resize(offset + size);
+            std::memcpy(buffer.data() + offset, &record->Header(), size);
+            offsets.push_back(static_cast<uint32_t>(offset));
+            keys.push_back(order == MergeOrder::EventTime
+                ? databento_native::RecordTsEvent(record->Header())
+                : databento_native::RecordIndexTs(*record));
+        }
+    }
+};
+
+/**
+ * One input file of the merge
+ *
+ * The merge consumes `current` while a read-ahead worker decodes the following
+ * block into `ahead`, so decompression and decoding stay off the consumer thread.
+ */
+struct MergeInput {
+    std::unique_ptr<db::DbnDecoder> decoder;  // Used only by the read-ahead workers after open
+    db::Metadata metadata;
+    MergeBlock current;
+    MergeBlock ahead;
+    size_t next = 0;                 // Index of the current record in `current`
+    // Guarded by the read-ahead mutex
+    bool ahead_ready = false;
+    std::exception_ptr error;
+
+    bool HasRecord() const { return next < current.keys.size(); }
+    const uint8_t* Current() const { return current.buffer.data() + current.offsets[next]; }
+    size_t CurrentSize() const { return static_cast<size_t>(Current()[0]) * db::RecordHeader::kLengthMultiplier; }
+    uint64_t CurrentKey() const { return HasRecord() ? current.keys[next] : kExhaustedKey; }
+};
+
+/**
+ * Workers that decode each input's next block while the merge consumes the current one
+ *
+ * At most one block per input is in flight, so each decoder is only ever used by
+ * one worker at a time. The pool is shared by all inputs, which keeps the thread
+ * count bounded however many files are merged.
+ */
+class MergeReadAhead {
+public:
+    MergeReadAhead(std::vector<MergeInput>& inputs, MergeOrder order)
+        : inputs_(inputs)
+        , order_(order)
+    {
+        size_t threads = std::min<size_t>(inputs.size(), std::max(1u, std::thread::hardware_concurrency()));
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this]() { Run(); });
+        }
+        // Decode the first block of every input in parallel
+        try {
+            for (size_t i = 0; i < inputs_.size(); ++i) {
+                Request(i);
+            }
+            for (size_t i = 0; i < inputs_.size(); ++i) {
+                TakeAhead(i);
+            }
+        }
+        catch (...) {
+            Stop();
+            throw;
+        }
+    }
+
+    ~MergeReadAhead() {
+        Stop();
+    }
+
+    MergeReadAhead(const MergeReadAhead&) = delete;
+    MergeReadAhead& operator=(const MergeReadAhead&) = delete;
+
+    /**
+     * Move an input past its current record, switching to the read-ahead block when
+     * the current one is used up
+     * @throws The decode error of the read-ahead block, if any
+     */
+    void Advance(size_t index) {
+        MergeInput& input = inputs_[index];
+        if (input.next + 1 < input.current.keys.size()) {
+            ++input.next;
+            return;
+        }
+        if (input.current.eof) {
+            input.next = input.current.keys.size();
+            return;
+        }
+        TakeAhead(index);
+    }
+
+private:
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void Request(size_t index) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(index);
+        }
+        work_cv_.notify_one();
+    }
+
+    // Wait for an input's read-ahead block, make it current and queue the next one
+    void TakeAhead(size_t index) {
+        MergeInput& input = inputs_[index];
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_cv_.wait(lock, [&input]() { return input.ahead_ready; });
+            if (input.error) {
+                std::rethrow_exception(input.error);
+            }
+            input.ahead_ready = false;
+        }
+        std::swap(input.current, input.ahead);
+        input.next = 0;
+        if (!input.current.eof) {
+            Request(index);
+        }
+    }
+
+    void Run() {
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+                if (stop_) {
+                    return;
+                }
+                index = queue_.front();
+                queue_.pop_front();
+            }
+            MergeInput& input = inputs_[index];
+            std::exception_ptr error;
+            try {
+                input.ahead.Decode(input.decoder.get(), order_);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                input.error = error;
+                input.ahead_ready = true;
+            }
+            ready_cv_.notify_all();
+        }
+    }
+
+    std::vector<MergeInput>& inputs_;
+    MergeOrder order_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;   // Signals queued inputs and stop
+    std::condition_variable ready_cv_;  // Signals finished blocks
+    std::deque<size_t> queue_;          // Inputs whose next block should be decoded
+    bool stop_ = false;
+};
+
+/**
+ * Tournament tree of losers over the inputs' current keys
+ *
+ * Node 0 holds the overall winner and nodes 1..k-1 the loser of each match;
+ * leaf i sits at position k + i. After the winner advances, only the log2(k)
+ * matches on its path are replayed. Ties go to the lower input index, so
+ * records with equal keys come out in the order the files were given.
+ */
+class LoserTree {
+public:
+    explicit LoserTree(const std::vector<MergeInput>& inputs)
+        : inputs_(inputs)
+        , tree_(inputs.size())
+    {
+        size_t k = inputs_.size();
+        std::vector<uint32_t> winners(2 * k);
+        for (size_t i = 0; i < k; ++i) {
+            winners[k + i] = static_cast<uint32_t>(i);
+        }
+        for (size_t node = k - 1; node > 0; --node) {
+            uint32_t left = winners[2 * node];
+            uint32_t right = winners[2 * node + 1];
+            bool left_wins = Less(left, right);
+            winners[node] = left_wins ? left : right;
+            tree_[node] = left_wins ? right : left;
+        }
+        tree_[0] = k == 1 ? 0 : winners[1];
+    }
+
+    uint32_t Winner() const { return tree_[0]; }
+
+    /**
+     * Restore the tree after the winner's key changed
+     */
+    void Replay() {
+        uint32_t winner = tree_[0];
+        for (size_t node = (winner + tree_.size()) / 2; node > 0; node /= 2) {
+            if (Less(tree_[node], winner)) {
+                std::swap(tree_[node], winner);
+            }
+        }
+        tree_[0] = winner;
+    }
+
+private:
+    bool Less(uint32_t a, uint32_t b) const {
+        uint64_t key_a = inputs_[a].CurrentKey();
+        uint64_t key_b = inputs_[b].CurrentKey();
+        return key_a < key_b || (key_a == key_b && a < b);
+    }
+
+    const std::vector<MergeInput>& inputs_;
+    std::vector<uint32_t> tree_;
+};
+
+}  // namespace
+
+// ============================================================================
+// DBN Merge Reader Wrapper Structure
+// ============================================================================
+
+struct DbnMergeReaderWrapper {
+    std::vector<MergeInput> inputs;
+    std::unique_ptr<MergeReadAhead> read_ahead;  // Declared after `inputs`, so it stops first
+    std::unique_ptr<LoserTree> tree;
+    std::exception_ptr error;  // First decode error; every later read reports it
+
+    DbnMergeReaderWrapper(const std::vector<std::filesystem::path>& paths, MergeOrder merge_order)
+        : inputs(paths.size())
+    {
+        for (size_t i = 0; i < paths.size(); ++i) {
+            auto mapped = std::make_shared<MappedFile>(paths[i]);
+            // Kernel read-ahead keeps each file streaming while the merge interleaves them
+            mapped->Advise(MappedAccess::Sequential);
+            MergeInput& input = inputs[i];
+            input.decoder = std::make_unique<db::DbnDecoder>(db::ILogReceiver::Default(),
+                databento_native::OpenDbnStreamAt(std::move(mapped), 0, 0, 0),
+                db::VersionUpgradePolicy::UpgradeToV3);
+            input.metadata = input.decoder->DecodeMetadata();
+            input.current.buffer.reserve(kInputBufferBytes + sizeof(db::Mbp10Msg));
+            input.ahead.buffer.reserve(kInputBufferBytes + sizeof(db::Mbp10Msg));
+        }
+        read_ahead = std::make_unique<MergeReadAhead>(inputs, merge_order);
+        tree = std::make_unique<LoserTree>(inputs);
+    }
+
+    /**
+     * Input holding the next record in merge order, or nullptr when all are exhausted
+     */
+    MergeInput* Peek(uint32_t* source) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        uint32_t winner = tree->Winner();
+        if (!inputs[winner].HasRecord()) {
+            return nullptr;
+        }
+        *source = winner;
+        return &inputs[winner];
+    }
+
+    void Pop() {
+        try {
+            read_ahead->Advance(tree->Winner());
+        }
+        catch (...) {
+            error = std::current_exception();
+            throw;
+        }
+        tree->Replay();
+    }
+};
+
+static DbnMergeReaderWrapper* GetMergeReader(DbnMergeReaderHandle handle, char* error_buffer, size_t error_buffer_size) {
+    databento_native::ValidationError validation_error;
+    auto* wrapper = databento_native::ValidateAndCast<DbnMergeReaderWrapper>(
+        handle, databento_native::HandleType::DbnMergeReader, &validation_error);
+    if (!wrapper || !wrapper->tree) {
+        SafeStrCopy(error_buffer, error_buffer_size,
+            wrapper ? "Merge reader not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+        return nullptr;
+    }
+    return wrapper;
+}
+
+// ============================================================================
+// DBN Merge Reader API Implementation
+// ============================================================================
+
+DATABENTO_API DbnMergeReaderHandle dbento_dbn_merge_open(
+    const char** file_paths,
+    size_t file_count,
+    int order_by,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (order_by < static_cast<int>(MergeOrder::EventTime) ||
+            order_by > static_cast<int>(MergeOrder::ReceiveTime)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid merge order");
+            return nullptr;
+        }
+
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        auto wrapper = std::make_unique<DbnMergeReaderWrapper>(paths, static_cast<MergeOrder>(order_by));
+        return reinterpret_cast<DbnMergeReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnMergeReader, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API const char* dbento_dbn_merge_get_metadata(
+    DbnMergeReaderHandle handle,
+    size_t file_index,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetMergeReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return nullptr;
+        }
+        if (file_index >= wrapper->inputs.size()) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File index out of range");
+            return nullptr;
+        }
+
+        std::string json_str = MetadataToJson(wrapper->inputs[file_index].metadata).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_merge_next_records(
+    DbnMergeReaderHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    uint32_t* source_indices,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetMergeReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+        if (!record_buffer || !record_offsets || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        size_t used = 0;
+        size_t count = 0;
+        uint32_t source = 0;
+        while (count < max_records) {
+            MergeInput* input = wrapper->Peek(&source);
+            if (!input) {
+                break;
+            }
+
+            size_t rec_size = input->CurrentSize();
+            if (used + rec_size > record_buffer_size) {
+                // The record stays at the head of its input for the next call
+                if (count == 0) {
+                    SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+                    *record_count = 0;
+                    return -3;
+                }
+                break;
+            }
+
+            std::memcpy(record_buffer + used, input->Current(), rec_size);
+            record_offsets[count] = used;
+            if (source_indices) {
+                source_indices[count] = source;
+            }
+            ++count;
+            used += rec_size;
+            wrapper->Pop();
+        }
+
+        *record_count = count;
+        return count == 0 ? 1 : 0;  // 1 = EOF
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_merge_close(DbnMergeReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnMergeReaderWrapper>(
+            handle, databento_native::HandleType::DbnMergeReader, nullptr);
+        if (wrapper) {
+            delete wrapper;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
@@ -0,0 +1,353 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "mapped_file.hpp"
+#include "metadata_json.hpp"
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/record.hpp>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace db = databento;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::MetadataToJson;
+using databento_native::MappedFile;
+using databento_native::MappedAccess;
+
+// ============================================================================
+// Memory-Mapped DBN Reader Wrapper Structure
+// ============================================================================
+
+namespace {
+
+// "DBN" + version byte + uint32 metadata length
+constexpr size_t kPreludeSize = 8;
+constexpr uint32_t kZstdMagic = 0xFD2FB528;
+
+}  // namespace
+
+struct DbnMmapReaderWrapper {
+    std::unique_ptr<MappedFile> file;
+    db::Metadata metadata;
+    const uint8_t* records_begin = nullptr;  // First record in the mapping
+    const uint8_t* records_end = nullptr;
+    const uint8_t* cursor = nullptr;
+
+    explicit DbnMmapReaderWrapper(const std::filesystem::path& path) {
+        file = std::make_unique<MappedFile>(path);
+        const uint8_t* data = file->Data();
+        size_t size = file->Size();
+
+        if (size >= sizeof(uint32_t)) {
+            uint32_t magic;
+            std::memcpy(&magic, data, sizeof(magic));
+            if (magic == kZstdMagic) {
+                throw std::invalid_argument(
+                    "File is zstd-compressed; memory-mapped reading requires uncompressed DBN");
+            }
+        }
+        if (size < kPreludeSize) {
+            throw std::invalid_argument("File too small to contain DBN metadata");
+        }
+
+        const auto* bytes = reinterpret_cast<const std::byte*>(data);
+        auto [version, metadata_size] = db::DbnDecoder::DecodeMetadataVersionAndSize(bytes, size);
+        // Records are handed out in place, so there is no chance to upgrade them
+        if (version != db::kDbnVersion) {
+            throw std::invalid_argument("Cannot map a DBN version " + std::to_string(version) +
+                                        " file; upgrade it to version " + std::to_string(db::kDbnVersion) +
+                                        " with dbento_dbn_upgrade first");
+        }
+        if (metadata_size > size - kPreludeSize) {
+            throw std::invalid_argument("DBN metadata extends past end of file");
+        }
+        metadata = db::DbnDecoder::DecodeMetadataFields(
+            version, bytes + kPreludeSize, bytes + kPreludeSize + metadata_size);
+
+        records_begin = data + kPreludeSize + metadata_size;
+        records_end = data + size;
+        cursor = records_begin;
+    }
+
+    /**
+     * Length of the record at `pos`, or 0 when the remaining bytes can't hold a whole record
+     */
+    size_t RecordLengthAt(const uint8_t* pos) const {
+        size_t remaining = static_cast<size_t>(records_end - pos);
+        if (remaining < sizeof(db::RecordHeader)) {
+            return 0;
+        }
+        size_t length = static_cast<size_t>(pos[0]) * db::RecordHeader::kLengthMultiplier;
+        if (length < sizeof(db::RecordHeader) || length > remaining) {
+            return 0;
+        }
+        return length;
+    }
+};
+
+static DbnMmapReaderWrapper* GetMmapReader(DbnMmapReaderHandle handle, char* error_buffer, size_t error_buffer_size) {
+    databento_native::ValidationError validation_error;
+    auto* wrapper = databento_native::ValidateAndCast<DbnMmapReaderWrapper>(
+        handle, databento_native::HandleType::DbnMmapReader, &validation_error);
+    if (!wrapper || !wrapper->file) {
+        SafeStrCopy(error_buffer, error_buffer_size,
+            wrapper ? "Mapped file not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+        return nullptr;
+    }
+    return wrapper;
+}
+
+// ============================================================================
+// Memory-Mapped DBN Reader API Implementation
+// ============================================================================
+
+DATABENTO_API DbnMmapReaderHandle dbento_dbn_mmap_open(
+    const char* file_path,
+    int access_hint,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+        if (access_hint < static_cast<int>(MappedAccess::Normal) ||
+            access_hint > static_cast<int>(MappedAccess::WillNeed)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid access hint");
+            return nullptr;
+        }
+
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+            return nullptr;
+        }
+
+        auto wrapper = std::make_unique<DbnMmapReaderWrapper>(path);
+        wrapper->file->Advise(static_cast<MappedAccess>(access_hint));
+        return reinterpret_cast<DbnMmapReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnMmapReader, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API const char* dbento_dbn_mmap_get_metadata(
+    DbnMmapReaderHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return nullptr;
+        }
+
+        std::string json_str = MetadataToJson(wrapper->metadata).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_mmap_next_record(
+    DbnMmapReaderHandle handle,
+    const uint8_t** record,
+    size_t* record_length,
+    uint8_t* record_type,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+        if (!record || !record_length || !record_type) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        if (wrapper->cursor == wrapper->records_end) {
+            *record = nullptr;
+            *record_length = 0;
+            return 1;  // EOF
+        }
+
+        size_t length = wrapper->RecordLengthAt(wrapper->cursor);
+        if (length == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Truncated or malformed record");
+            return -3;
+        }
+
+        *record = wrapper->cursor;
+        *record_length = length;
+        *record_type = wrapper->cursor[1];
+        wrapper->cursor += length;
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_mmap_borrow_records(
+    DbnMmapReaderHandle handle,
+    size_t max_bytes,
+    size_t max_records,
+    const uint8_t** records,
+    size_t* total_length,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+        if (!records || !total_length || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        const uint8_t* start = wrapper->cursor;
+        const uint8_t* pos = start;
+        size_t count = 0;
+        while (count < max_records && pos != wrapper->records_end) {
+            size_t length = wrapper->RecordLengthAt(pos);
+            if (length == 0) {
+                if (count == 0) {
+                    SafeStrCopy(error_buffer, error_buffer_size, "Truncated or malformed record");
+                    return -3;
+                }
+                break;  // Report the bad record on the next call
+            }
+            if (static_cast<size_t>(pos + length - start) > max_bytes) {
+                break;
+            }
+            pos += length;
+            ++count;
+        }
+
+        *records = start;
+        *total_length = static_cast<size_t>(pos - start);
+        *record_count = count;
+        wrapper->cursor = pos;
+
+        if (count == 0 && pos == wrapper->records_end) {
+            return 1;  // EOF
+        }
+        if (count == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Next record is larger than max_bytes");
+            return -4;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_mmap_get_records(
+    DbnMmapReaderHandle handle,
+    const uint8_t** records,
+    size_t* total_length)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, nullptr, 0);
+        if (!wrapper || !records || !total_length) {
+            return -1;
+        }
+        *records = wrapper->records_begin;
+        *total_length = static_cast<size_t>(wrapper->records_end - wrapper->records_begin);
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int64_t dbento_dbn_mmap_tell(DbnMmapReaderHandle handle)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        return static_cast<int64_t>(wrapper->cursor - wrapper->records_begin);
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_mmap_seek(DbnMmapReaderHandle handle, size_t offset)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        size_t total = static_cast<size_t>(wrapper->records_end - wrapper->records_begin);
+        if (offset > total || offset % db::RecordHeader::kLengthMultiplier != 0) {
+            return -2;
+        }
+        wrapper->cursor = wrapper->records_begin + offset;
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_mmap_advise(
+    DbnMmapReaderHandle handle,
+    int access_hint,
+    size_t offset,
+    size_t length)
+{
+    try {
+        auto* wrapper = GetMmapReader(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        if (access_hint < static_cast<int>(MappedAccess::Normal) ||
+            access_hint > static_cast<int>(MappedAccess::WillNeed)) {
+            return -2;
+        }
+        size_t base = static_cast<size_t>(wrapper->records_begin - wrapper->file->Data());
+        wrapper->file->Advise(static_cast<MappedAccess>(access_hint), base + offset, length);
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_mmap_close(DbnMmapReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnMmapReaderWrapper>(
+            handle, databento_native::HandleType::DbnMmapReader, nullptr);
+        if (wrapper) {
+            delete wrapper;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
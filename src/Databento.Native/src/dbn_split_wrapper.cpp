@@ -0,0 +1,754 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "record_utils.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/enums.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <zstd.h>
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <date/date.h>
+
+namespace db = databento;
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::OutputStem;
+using databento_native::ResolveThreadCount;
+using databento_native::ValidateDistinctOutputStems;
+using databento_native::ValidateInputFiles;
+using databento_native::ValidateNonEmptyString;
+
+// ============================================================================
+// Splitter Internals
+// ============================================================================
+
+namespace {
+
+constexpr uint64_t kNanosPerDay = 86'400'000'000'000ULL;
+constexpr size_t kDefaultChunkSize = 1024 * 1024;
+constexpr size_t kDefaultMaxBufferedBytes = 256 * 1024 * 1024;
+constexpr size_t kDefaultMaxOpenFiles = 256;
+constexpr int kDefaultZstdLevel = 3;
+
+struct SplitOptions {
+    bool by_instrument = true;
+    bool by_date = true;
+    bool by_schema = false;
+    int zstd_level = kDefaultZstdLevel;  // 0 = uncompressed output
+    size_t chunk_size = kDefaultChunkSize;
+    size_t max_buffered_bytes = kDefaultMaxBufferedBytes;
+    size_t max_open_files = kDefaultMaxOpenFiles;
+
+    /**
+     * {"partition_by": ["instrument", "date", "schema"], "compression": "zstd" | "none",
+     *  "compression_level": 1-22, "chunk_size": bytes, "max_buffered_bytes": bytes,
+     *  "max_open_files": n}
+     */
+    static SplitOptions FromJson(const char* options_json) {
+        SplitOptions options;
+        if (!options_json || options_json[0] == '\0') {
+            return options;
+        }
+        json j = json::parse(options_json);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Split options must be a JSON object");
+        }
+        if (j.contains("partition_by") && !j["partition_by"].is_null()) {
+            options.by_instrument = options.by_date = options.by_schema = false;
+            for (const auto& key : j["partition_by"]) {
+                std::string name = key.get<std::string>();
+                if (name == "instrument") {
+                    options.by_instrument = true;
+                } else if (name == "date") {
+                    options.by_date = true;
+                } else if (name == "schema") {
+                    options.by_schema = true;
+                } else {
+                    throw std::invalid_argument("Unknown partition key: " + name);
+                }
+            }
+            if (!options.by_instrument && !options.by_date && !options.by_schema) {
+                throw std::invalid_argument("At least one partition key is required");
+            }
+        }
+        if (j.contains("compression_level") && !j["compression_level"].is_null()) {
+            options.zstd_level = j["compression_level"].get<int>();
+            if (options.zstd_level < 1 || options.zstd_level > ZSTD_maxCLevel()) {
+                throw std::invalid_argument("Compression level must be between 1 and " +
+                                            std::to_string(ZSTD_maxCLevel()));
+            }
+        }
+        if (j.contains("compression") && !j["compression"].is_null()) {
+            std::string compression = j["compression"].get<std::string>();
+            if (compression == "none") {
+                options.zstd_level = 0;
+            } else if (compression != "zstd") {
+                throw std::invalid_argument("Unknown compression: " + compression);
+            }
+        }
+        if (j.contains("chunk_size") && !j["chunk_size"].is_null()) {
+            options.chunk_size = j["chunk_size"].get<size_t>();
+            if (options.chunk_size == 0) {
+                throw std::invalid_argument("Chunk size must be positive");
+            }
+        }
+        if (j.contains("max_buffered_bytes") && !j["max_buffered_bytes"].is_null()) {
+            options.max_buffered_bytes = j["max_buffered_bytes"].get<size_t>();
+            if (options.max_buffered_bytes == 0) {
+                throw std::invalid_argument("Buffer limit must be positive");
+            }
+        }
+        if (j.contains("max_open_files") && !j["max_open_files"].is_null()) {
+            options.max_open_files = j["max_open_files"].get<size_t>();
+            if (options.max_open_files == 0) {
+                throw std::invalid_argument("Open file limit must be positive");
+            }
+        }
+        return options;
+    }
+};
+
+/**
+ * Partition of a record; keys that aren't split on are zero
+ */
+struct PartitionKey {
+    uint32_t instrument_id;
+    uint32_t day;  // Days since the Unix epoch (UTC)
+    uint16_t schema;
+
+    bool operator==(const PartitionKey& other) const {
+        return instrument_id == other.instrument_id && day == other.day && schema == other.schema;
+    }
+};
+
+struct PartitionKeyHash {
+    size_t operator()(const PartitionKey& key) const {
+        uint64_t h = (static_cast<uint64_t>(key.instrument_id) << 32) ^
+                     (static_cast<uint64_t>(key.day) << 16) ^ key.schema;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+};
+
+/**
+ * One output file of a split
+ *
+ * Records are compressed into independent zstd frames and appended to a body
+ * file next to the output. Once the input is exhausted the exact metadata header
+ * (symbols, start/end, mappings) is written in front of the body.
+ */
+struct Partition {
+    PartitionKey key;
+    std::filesystem::path path;
+    std::filesystem::path body_path;
+
+    // Reader-owned
+    std::vector<std::byte> buffer;
+    uint64_t records = 0;
+    std::unordered_set<uint32_t> instruments;
+
+    // Guarded by Splitter::mutex_
+    std::deque<std::vector<std::byte>> chunks;
+    bool scheduled = false;  // Queued for or owned by a worker
+    bool finalize = false;   // Write the header once the chunks are drained
+
+    // Owned by the worker holding the partition; handle bookkeeping under Splitter::files_mutex_
+    std::unique_ptr<std::ofstream> body;
+    std::list<Partition*>::iterator lru_position;
+    bool writing = false;
+    uint64_t bytes = 0;
+};
+
+std::string FormatDay(uint32_t day) {
+    date::year_month_day ymd{date::sys_days{date::days{day}}};
+    char text[16];
+    std::snprintf(text, sizeof(text), "%04d%02u%02u", static_cast<int>(ymd.year()),
+                  static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
+    return text;
+}
+
+std::optional<uint32_t> ParseInstrumentId(const std::string& symbol) {
+    uint32_t id;
+    auto [end, ec] = std::from_chars(symbol.data(), symbol.data() + symbol.size(), id);
+    if (ec != std::errc{} || end != symbol.data() + symbol.size()) {
+        return std::nullopt;
+    }
+    return id;
+}
+
+/**
+ * Splits DBN files into partitions with a pool of compression workers
+ *
+ * The caller's thread decodes the input once and appends each record to its
+ * partition's buffer. Full buffers are queued as chunks; a partition is handed
+ * to at most one worker at a time, so its chunks reach the body file in order.
+ * Queued chunks and unqueued buffers are each capped at max_buffered_bytes: the
+ * reader blocks while too much is queued, and spills every partition's buffer
+ * when too much is unqueued. At most max_open_files body files are open; the
+ * least recently written idle one is closed to make room.
+ */
+class Splitter {
+public:
+    Splitter(const SplitOptions& options, size_t threads)
+        : options_(options)
+        , max_open_files_(std::max(options.max_open_files, threads + 1))
+    {
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ~Splitter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    Splitter(const Splitter&) = delete;
+    Splitter& operator=(const Splitter&) = delete;
+
+    /**
+     * Split one DBN file into `output_dir/[schema/][instrument_id/][YYYYMMDD/]<stem>.dbn[.zst]`
+     * @return Summary of the outputs written
+     */
+    json SplitFile(const std::filesystem::path& path, const std::filesystem::path& output_dir,
+                   size_t decompression_threads) {
+        std::unique_ptr<db::IReadable> input = databento_native::OpenParallelZstd(path, decompression_threads);
+        if (!input) {
+            input = std::make_unique<db::InFileStream>(path);
+        }
+        db::DbnDecoder decoder{db::ILogReceiver::Default(), std::move(input), db::VersionUpgradePolicy::AsIs};
+        source_ = decoder.DecodeMetadata();
+        stem_ = OutputStem(path);
+        output_dir_ = output_dir;
+        partitions_.clear();
+        buffered_ = 0;
+
+        uint64_t records = 0;
+        uint64_t skipped = 0;
+        Partition* last = nullptr;
+        try {
+            while (const db::Record* record = decoder.DecodeRecord()) {
+                ++records;
+                std::optional<PartitionKey> key = KeyOf(*record);
+                if (!key) {
+                    ++skipped;
+                    continue;
+                }
+                Partition* partition = (last && last->key == *key) ? last : &Lookup(*key);
+                last = partition;
+
+                const auto* bytes = reinterpret_cast<const std::byte*>(&record->Header());
+                partition->buffer.insert(partition->buffer.end(), bytes, bytes + record->Size());
+                if (!options_.by_instrument) {
+                    partition->instruments.insert(record->Header().instrument_id);
+                }
+                ++partition->records;
+                buffered_ += record->Size();
+                if (partition->buffer.size() >= options_.chunk_size) {
+                    Submit(partition, false);
+                } else if (buffered_ > options_.max_buffered_bytes) {
+                    for (auto& entry : partitions_) {
+                        Submit(entry.second.get(), false);
+                    }
+                }
+            }
+            for (auto& entry : partitions_) {
+                Submit(entry.second.get(), true);
+            }
+            WaitIdle();
+        }
+        catch (...) {
+            Abandon();
+            throw;
+        }
+
+        json outputs = json::array();
+        std::vector<const Partition*> ordered;
+        ordered.reserve(partitions_.size());
+        for (const auto& entry : partitions_) {
+            ordered.push_back(entry.second.get());
+        }
+        std::sort(ordered.begin(), ordered.end(),
+            [](const Partition* a, const Partition* b) { return a->path < b->path; });
+        for (const Partition* partition : ordered) {
+            json output = {{"path", partition->path.string()}, {"records", partition->records},
+                           {"bytes", partition->bytes}};
+            output["instrument_id"] = options_.by_instrument ? json(partition->key.instrument_id) : json(nullptr);
+            output["date"] = options_.by_date ? json(FormatDay(partition->key.day)) : json(nullptr);
+            output["schema"] = options_.by_schema
+                ? json(db::ToString(static_cast<db::Schema>(partition->key.schema))) : json(nullptr);
+            outputs.push_back(std::move(output));
+        }
+        partitions_.clear();
+        return {{"input", path.string()}, {"records", records}, {"records_skipped", skipped}, {"outputs", outputs}};
+    }
+
+private:
+    std::optional<PartitionKey> KeyOf(const db::Record& record) const {
+        PartitionKey key{0, 0, 0};
+        if (options_.by_instrument) {
+            key.instrument_id = record.Header().instrument_id;
+        }
+        if (options_.by_date) {
+            key.day = static_cast<uint32_t>(databento_native::RecordIndexTs(record) / kNanosPerDay);
+        }
+        if (options_.by_schema) {
+            std::optional<db::Schema> schema = databento_native::SchemaForRType(record.RType());
+            if (!schema) {
+                return std::nullopt;
+            }
+            // MBP-1 and TBBO share an rtype; the source metadata tells them apart
+            if (*schema == db::Schema::Mbp1 && source_.schema == db::Schema::Tbbo) {
+                schema = db::Schema::Tbbo;
+            }
+            key.schema = static_cast<uint16_t>(*schema);
+        }
+        return key;
+    }
+
+    Partition& Lookup(const PartitionKey& key) {
+        auto& slot = partitions_[key];
+        if (!slot) {
+            slot = std::make_unique<Partition>();
+            slot->key = key;
+            if (options_.by_instrument) {
+                slot->instruments.insert(key.instrument_id);
+            }
+            std::filesystem::path dir = output_dir_;
+            if (options_.by_schema) {
+                dir /= db::ToString(static_cast<db::Schema>(key.schema));
+            }
+            if (options_.by_instrument) {
+                dir /= std::to_string(key.instrument_id);
+            }
+            if (options_.by_date) {
+                dir /= FormatDay(key.day);
+            }
+            std::filesystem::create_directories(dir);
+            slot->path = dir / (stem_ + (options_.zstd_level > 0 ? ".dbn.zst" : ".dbn"));
+            slot->body_path = slot->path;
+            slot->body_path += ".body.tmp";
+            std::filesystem::remove(slot->body_path);
+        }
+        return *slot;
+    }
+
+    /**
+     * Queue a partition's buffer as a chunk, blocking while too many bytes are queued
+     * @param finalize Also write the header once everything queued is on disk
+     */
+    void Submit(Partition* partition, bool finalize) {
+        if (partition->buffer.empty() && !finalize) {
+            return;
+        }
+        std::vector<std::byte> chunk;
+        chunk.swap(partition->buffer);
+        buffered_ -= chunk.size();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return error_ || queued_ < options_.max_buffered_bytes; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        if (!chunk.empty()) {
+            queued_ += chunk.size();
+            partition->chunks.push_back(std::move(chunk));
+        }
+        partition->finalize = partition->finalize || finalize;
+        if (!partition->scheduled) {
+            partition->scheduled = true;
+            ++active_;
+            ready_.push_back(partition);
+            lock.unlock();
+            work_cv_.notify_one();
+        }
+    }
+
+    void WaitIdle() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return error_ || active_ == 0; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+    // After a failure: drop queued work, wait out running workers and remove partial outputs
+    void Abandon() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Running workers stop at their next chunk
+            if (!error_) {
+                error_ = std::make_exception_ptr(std::runtime_error("Split abandoned"));
+            }
+            for (Partition* partition : ready_) {
+                Unschedule(partition);
+            }
+            ready_.clear();
+            done_cv_.wait(lock, [this]() { return active_ == 0; });
+            error_ = nullptr;
+            queued_ = 0;
+        }
+        std::error_code ec;
+        for (auto& entry : partitions_) {
+            CloseBody(entry.second.get());
+            std::filesystem::remove(entry.second->body_path, ec);
+        }
+        partitions_.clear();
+    }
+
+    void WorkerLoop() {
+        std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+        std::vector<std::byte> compressed;
+        while (true) {
+            Partition* partition;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this]() { return stopping_ || !ready_.empty(); });
+                if (stopping_) {
+                    return;
+                }
+                partition = ready_.front();
+                ready_.pop_front();
+            }
+
+            try {
+                if (!cctx) {
+                    throw std::bad_alloc();
+                }
+                Drain(partition, cctx.get(), &compressed);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                Unschedule(partition);
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    // Requires mutex_
+    void Unschedule(Partition* partition) {
+        partition->scheduled = false;
+        --active_;
+    }
+
+    /**
+     * Write the partition's queued chunks in order, then its header if finalizing
+     * The partition is unscheduled under the same lock that finds it empty, so a
+     * chunk queued concurrently either is seen here or reschedules the partition.
+     */
+    void Drain(Partition* partition, ZSTD_CCtx* cctx, std::vector<std::byte>* compressed) {
+        while (true) {
+            std::vector<std::byte> chunk;
+            bool finalize;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (error_ || (partition->chunks.empty() && !partition->finalize)) {
+                    Unschedule(partition);
+                    return;
+                }
+                if (partition->chunks.empty()) {
+                    partition->finalize = false;
+                    finalize = true;
+                } else {
+                    chunk = std::move(partition->chunks.front());
+                    partition->chunks.pop_front();
+                    finalize = false;
+                }
+            }
+            if (finalize) {
+                WriteOutput(partition, cctx, compressed);
+                std::lock_guard<std::mutex> lock(mutex_);
+                Unschedule(partition);
+                return;
+            }
+
+            const std::vector<std::byte>& data = Compress(cctx, chunk, compressed);
+            std::ofstream& body = AcquireBody(partition);
+            body.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            bool ok = body.good();
+            ReleaseBody(partition);
+            if (!ok) {
+                throw std::runtime_error("Failed to write " + partition->body_path.string());
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queued_ -= chunk.size();
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    // The chunk as one independent zstd frame, or unchanged when writing uncompressed
+    const std::vector<std::byte>& Compress(ZSTD_CCtx* cctx, const std::vector<std::byte>& chunk,
+                                           std::vector<std::byte>* compressed) const {
+        if (options_.zstd_level == 0) {
+            return chunk;
+        }
+        ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, options_.zstd_level);
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+        compressed->resize(ZSTD_compressBound(chunk.size()));
+        size_t size = ZSTD_compress2(cctx, compressed->data(), compressed->size(), chunk.data(), chunk.size());
+        if (ZSTD_isError(size)) {
+            throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+        }
+        compressed->resize(size);
+        return *compressed;
+    }
+
+    // Header followed by the body, written under a temporary name and renamed
+    void WriteOutput(Partition* partition, ZSTD_CCtx* cctx, std::vector<std::byte>* compressed) {
+        CloseBody(partition);
+        std::vector<std::byte> header;
+        databento_native::VectorWritable writable{&header};
+        db::DbnEncoder::EncodeMetadata(PartitionMetadata(*partition), &writable);
+        const std::vector<std::byte>& header_data = Compress(cctx, header, compressed);
+
+        std::filesystem::path temp_path = partition->path;
+        temp_path += ".tmp";
+        {
+            std::ofstream out{temp_path, std::ios::binary | std::ios::trunc};
+            out.write(reinterpret_cast<const char*>(header_data.data()),
+                      static_cast<std::streamsize>(header_data.size()));
+            std::ifstream body{partition->body_path, std::ios::binary};
+            if (body.is_open() && body.peek() != std::ifstream::traits_type::eof()) {
+                out << body.rdbuf();
+            }
+            out.flush();
+            if (!out.good()) {
+                throw std::runtime_error("Failed to write " + temp_path.string());
+            }
+        }
+        std::filesystem::rename(temp_path, partition->path);
+        std::filesystem::remove(partition->body_path);
+        partition->bytes = std::filesystem::file_size(partition->path);
+    }
+
+    /**
+     * Source metadata narrowed to a partition
+     * start/end are clipped to the partition's day; symbols and mappings keep only
+     * entries that resolve to an instrument in the partition within that range.
+     */
+    db::Metadata PartitionMetadata(const Partition& partition) const {
+        db::Metadata metadata = source_;
+        metadata.limit = 0;
+        date::sys_days first_day = date::sys_days::min();
+        date::sys_days last_day = date::sys_days::max();
+        if (options_.by_date) {
+            db::UnixNanos day_start{std::chrono::duration<uint64_t, std::nano>{partition.key.day * kNanosPerDay}};
+            db::UnixNanos day_end{std::chrono::duration<uint64_t, std::nano>{(partition.key.day + 1ULL) * kNanosPerDay}};
+            // An undefined end is the maximum timestamp, so it clips to the day as well
+            metadata.start = std::max(source_.start, day_start);
+            metadata.end = std::min(source_.end, day_end);
+            first_day = date::sys_days{date::days{partition.key.day}};
+            last_day = first_day + date::days{1};
+        }
+        if (options_.by_schema) {
+            metadata.schema = static_cast<db::Schema>(partition.key.schema);
+        }
+
+        if (source_.mappings.empty()) {
+            if (source_.stype_in == db::SType::InstrumentId) {
+                std::set<uint32_t> ids(partition.instruments.begin(), partition.instruments.end());
+                metadata.symbols.clear();
+                for (uint32_t id : ids) {
+                    metadata.symbols.push_back(std::to_string(id));
+                }
+                metadata.partial.clear();
+                metadata.not_found.clear();
+            }
+            return metadata;
+        }
+
+        metadata.mappings.clear();
+        std::set<std::string> kept;
+        for (const auto& mapping : source_.mappings) {
+            db::SymbolMapping narrowed{mapping.raw_symbol, {}};
+            for (const auto& interval : mapping.intervals) {
+                date::sys_days start{interval.start_date};
+                date::sys_days end{interval.end_date};
+                if (start >= last_day || end <= first_day) {
+                    continue;
+                }
+                // Non-numeric mapped symbols can't be matched to instruments; keep them whole
+                std::optional<uint32_t> id = ParseInstrumentId(interval.symbol);
+                if (id && !partition.instruments.count(*id)) {
+                    continue;
+                }
+                db::MappingInterval clipped = interval;
+                if (options_.by_date) {
+                    clipped.start_date = date::year_month_day{std::max(start, first_day)};
+                    clipped.end_date = date::year_month_day{std::min(end, last_day)};
+                }
+                narrowed.intervals.push_back(std::move(clipped));
+            }
+            if (!narrowed.intervals.empty()) {
+                kept.insert(mapping.raw_symbol);
+                metadata.mappings.push_back(std::move(narrowed));
+            }
+        }
+        auto keep_known = [&kept](std::vector<std::string>* symbols) {
+            symbols->erase(std::remove_if(symbols->begin(), symbols->end(),
+                [&kept](const std::string& symbol) { return !kept.count(symbol); }), symbols->end());
+        };
+        keep_known(&metadata.symbols);
+        keep_known(&metadata.partial);
+        metadata.not_found.clear();
+        return metadata;
+    }
+
+    std::ofstream& AcquireBody(Partition* partition) {
+        std::lock_guard<std::mutex> lock(files_mutex_);
+        partition->writing = true;
+        if (partition->body) {
+            lru_.splice(lru_.begin(), lru_, partition->lru_position);
+            return *partition->body;
+        }
+        // Workers hold at most one file each and max_open_files_ exceeds the worker
+        // count, so rotating busy files to the front always reaches an idle one
+        while (lru_.size() >= max_open_files_) {
+            Partition* victim = lru_.back();
+            if (victim->writing) {
+                lru_.splice(lru_.begin(), lru_, std::prev(lru_.end()));
+                continue;
+            }
+            victim->body.reset();
+            lru_.pop_back();
+        }
+        partition->body = std::make_unique<std::ofstream>(partition->body_path, std::ios::binary | std::ios::app);
+        if (!partition->body->is_open()) {
+            partition->body.reset();
+            partition->writing = false;
+            throw std::runtime_error("Failed to open " + partition->body_path.string());
+        }
+        lru_.push_front(partition);
+        partition->lru_position = lru_.begin();
+        return *partition->body;
+    }
+
+    void ReleaseBody(Partition* partition) {
+        std::lock_guard<std::mutex> lock(files_mutex_);
+        partition->writing = false;
+    }
+
+    void CloseBody(Partition* partition) {
+        std::lock_guard<std::mutex> lock(files_mutex_);
+        if (partition->body) {
+            partition->body.reset();
+            lru_.erase(partition->lru_position);
+        }
+    }
+
+    const SplitOptions& options_;
+    size_t max_open_files_;
+
+    // Reader state for the file being split
+    db::Metadata source_;
+    std::string stem_;
+    std::filesystem::path output_dir_;
+    std::unordered_map<PartitionKey, std::unique_ptr<Partition>, PartitionKeyHash> partitions_;
+    size_t buffered_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Partition*> ready_;
+    size_t queued_ = 0;
+    size_t active_ = 0;
+    std::exception_ptr error_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::mutex files_mutex_;
+    std::list<Partition*> lru_;
+};
+
+json RunSplit(const std::vector<std::filesystem::path>& paths, const std::filesystem::path& output_dir,
+              const SplitOptions& options, size_t threads) {
+    // Input decompression shares the cores; compression is the heavier side
+    size_t decompression_threads = threads / 4;
+    Splitter splitter{options, threads};
+    json files = json::array();
+    uint64_t records = 0;
+    uint64_t skipped = 0;
+    for (const auto& path : paths) {
+        json result = splitter.SplitFile(path, output_dir, decompression_threads);
+        records += result["records"].get<uint64_t>();
+        skipped += result["records_skipped"].get<uint64_t>();
+        files.push_back(std::move(result));
+    }
+    return {{"files", files}, {"records", records}, {"records_skipped", skipped}};
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Split API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_split(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        size_t worker_count = ResolveThreadCount(threads);
+        ValidateNonEmptyString("output_dir", output_dir);
+        std::filesystem::path out_dir{output_dir};
+        if (!std::filesystem::is_directory(out_dir)) {
+            SafeStrCopy(error_buffer, error_buffer_size, ("Directory does not exist: " + out_dir.string()).c_str());
+            return nullptr;
+        }
+
+        ValidateDistinctOutputStems(paths);
+
+        SplitOptions options = SplitOptions::FromJson(options_json);
+        std::string json_str = RunSplit(paths, out_dir, options, worker_count).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
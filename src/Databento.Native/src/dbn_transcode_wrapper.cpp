@@ -0,0 +1,498 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "handle_validation.hpp"
+#include "text_encoder.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace db = databento;
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::ResolveThreadCount;
+using databento_native::ValidateNonEmptyString;
+using databento_native::RecordTextEncoder;
+using databento_native::TextEncodeOptions;
+using databento_native::TextFormat;
+using databento_native::RecordLayout;
+using databento_native::TextSymbolResolver;
+
+// ============================================================================
+// Transcoder Internals
+// ============================================================================
+
+namespace {
+
+// Text produced per Fill before it is handed to the output
+constexpr size_t kTextBlockSize = 1024 * 1024;
+// Records per unit of a parallel transcode, so buffered text stays bounded
+constexpr uint64_t kUnitRecords = 64 * 1024;
+
+struct TranscodeCounts {
+    uint64_t records = 0;
+    uint64_t written = 0;
+
+    TranscodeCounts& operator+=(const TranscodeCounts& other) {
+        records += other.records;
+        written += other.written;
+        return *this;
+    }
+};
+
+std::unique_ptr<db::IReadable> OpenDbnInput(const std::filesystem::path& path, size_t decompression_threads) {
+    std::unique_ptr<db::IReadable> input = databento_native::OpenParallelZstd(path, decompression_threads);
+    if (!input) {
+        input = std::make_unique<db::InFileStream>(path);
+    }
+    return input;
+}
+
+/**
+ * Text of a DBN file, produced a block at a time on the calling thread
+ */
+class FileTextSource {
+public:
+    FileTextSource(const std::filesystem::path& path, const TextEncodeOptions& options, size_t decompression_threads)
+        : decoder_(db::ILogReceiver::Default(), OpenDbnInput(path, decompression_threads),
+                   db::VersionUpgradePolicy::UpgradeToV3)
+        , metadata_(decoder_.DecodeMetadata())
+        , encoder_(options, metadata_.ts_out,
+                   options.map_symbols ? std::make_shared<TextSymbolResolver>(metadata_) : nullptr)
+    {}
+
+    /**
+     * Append text until at least `min_bytes` were added or the file ends
+     * @return false once the file is exhausted and nothing was added
+     */
+    bool Fill(std::string* out, size_t min_bytes) {
+        size_t start = out->size();
+        while (out->size() - start < min_bytes) {
+            const db::Record* record = decoder_.DecodeRecord();
+            if (!record) {
+                break;
+            }
+            ++counts_.records;
+            if (encoder_.Encode(*record, out)) {
+                ++counts_.written;
+            }
+        }
+        return out->size() > start;
+    }
+
+    const TranscodeCounts& Counts() const { return counts_; }
+
+private:
+    db::DbnDecoder decoder_;
+    db::Metadata metadata_;
+    RecordTextEncoder encoder_;
+    TranscodeCounts counts_;
+};
+
+void WriteBlock(std::ofstream& out, const std::string& text, const std::filesystem::path& path) {
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    if (!out.good()) {
+        throw std::runtime_error("Failed to write " + path.string());
+    }
+}
+
+TranscodeCounts TranscodeSequential(const std::filesystem::path& input, const std::filesystem::path& output,
+                                    const TextEncodeOptions& options, size_t decompression_threads) {
+    FileTextSource source{input, options, decompression_threads};
+    std::ofstream out{output, std::ios::binary | std::ios::trunc};
+    if (!out.is_open()) {
+        throw std::runtime_error("Failed to open " + output.string());
+    }
+    std::string text;
+    text.reserve(kTextBlockSize * 2);
+    while (source.Fill(&text, kTextBlockSize)) {
+        WriteBlock(out, text, output);
+        text.clear();
+    }
+    out.flush();
+    if (!out.good()) {
+        throw std::runtime_error("Failed to write " + output.string());
+    }
+    return source.Counts();
+}
+
+/**
+ * Layout of the first record with one, which fixes the CSV columns
+ */
+const RecordLayout* FirstTextLayout(const std::filesystem::path& path) {
+    db::DbnDecoder decoder{db::ILogReceiver::Default(), OpenDbnInput(path, 1), db::VersionUpgradePolicy::UpgradeToV3};
+    decoder.DecodeMetadata();
+    while (const db::Record* record = decoder.DecodeRecord()) {
+        if (const RecordLayout* layout = databento_native::RecordLayoutFor(static_cast<uint8_t>(record->RType()))) {
+            return layout;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Format one unit of a parallel scan
+ */
+TranscodeCounts EncodeUnit(const databento_native::DbnScanFile& file, const databento_native::DbnScanUnit& unit,
+                           RecordTextEncoder* encoder, std::string* out) {
+    TranscodeCounts counts;
+    auto stream = databento_native::OpenScanUnit(file, unit);
+    auto encode = [&](const db::Record& record) {
+        ++counts.records;
+        if (encoder->Encode(record, out)) {
+            ++counts.written;
+        }
+    };
+    if (file.Version() == db::kDbnVersion) {
+        // Current-version records are formatted straight from the decompressed bytes
+        databento_native::RawRecordScanner scanner{stream.get(), 0};
+        uint64_t offset;
+        while (const uint8_t* bytes = scanner.Next(&offset)) {
+            encode(db::Record{reinterpret_cast<db::RecordHeader*>(const_cast<uint8_t*>(bytes))});
+        }
+        return counts;
+    }
+    db::DbnDecoder decoder{db::ILogReceiver::Default(),
+        std::make_unique<databento_native::SpliceReadable>(file.header, std::move(stream)),
+        db::VersionUpgradePolicy::UpgradeToV3};
+    decoder.DecodeMetadata();
+    while (const db::Record* record = decoder.DecodeRecord()) {
+        encode(*record);
+    }
+    return counts;
+}
+
+/**
+ * Transcode index blocks on worker threads and write them in file order
+ *
+ * Workers stay at most two units per worker ahead of the writer, which bounds the
+ * text held in memory.
+ * @return Counts, or nullopt when the file can't be split (no index, or symbols
+ *         resolved from in-stream mappings, which must be applied in order)
+ */
+std::optional<TranscodeCounts> TranscodeParallel(const std::filesystem::path& input,
+                                                 const std::filesystem::path& output,
+                                                 const TextEncodeOptions& options, size_t threads) {
+    databento_native::DbnScanFile file = databento_native::OpenScanFile(input);
+    if (!file.index) {
+        return std::nullopt;
+    }
+    const auto* header = file.header.data();
+    auto [version, metadata_size] = db::DbnDecoder::DecodeMetadataVersionAndSize(header, file.header.size());
+    db::Metadata metadata = db::DbnDecoder::DecodeMetadataFields(
+        version, header + databento_native::kDbnPreludeSize,
+        header + databento_native::kDbnPreludeSize + metadata_size);
+    if (options.map_symbols && metadata.mappings.empty()) {
+        return std::nullopt;
+    }
+
+    std::vector<databento_native::DbnScanFile> files;
+    files.push_back(std::move(file));
+    uint64_t target_units = std::max<uint64_t>(threads * 4, files[0].index->RecordCount() / kUnitRecords);
+    std::vector<databento_native::DbnScanUnit> units =
+        databento_native::PlanScanUnits(files, static_cast<size_t>(target_units));
+    if (units.size() < 2) {
+        return std::nullopt;
+    }
+    std::sort(units.begin(), units.end(),
+        [](const auto& a, const auto& b) { return a.first_block < b.first_block; });
+
+    const RecordLayout* csv_layout = options.format == TextFormat::Csv ? FirstTextLayout(input) : nullptr;
+    auto symbols = options.map_symbols ? std::make_shared<TextSymbolResolver>(metadata) : nullptr;
+
+    struct Slot {
+        std::string text;
+        TranscodeCounts counts;
+        std::exception_ptr error;
+        bool ready = false;
+    };
+    const size_t window = threads * 2;
+    std::vector<Slot> slots(window);
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t next_to_schedule = 0;
+    size_t next_to_write = 0;
+    bool stopping = false;
+
+    auto work = [&]() {
+        RecordTextEncoder encoder{options, metadata.ts_out, symbols};
+        encoder.SetCsvLayout(csv_layout, false);
+        std::string text;
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() {
+                    return stopping || next_to_schedule >= units.size() || next_to_schedule < next_to_write + window;
+                });
+                if (stopping || next_to_schedule >= units.size()) {
+                    return;
+                }
+                index = next_to_schedule++;
+            }
+
+            TranscodeCounts counts;
+            std::exception_ptr error;
+            try {
+                counts = EncodeUnit(files[0], units[index], &encoder, &text);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                Slot& slot = slots[index % window];
+                slot.text.swap(text);
+                slot.counts = counts;
+                slot.error = error;
+                slot.ready = true;
+            }
+            text.clear();
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        pool.emplace_back(work);
+    }
+    auto stop = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto& thread : pool) {
+            thread.join();
+        }
+    };
+
+    TranscodeCounts total;
+    try {
+        std::ofstream out{output, std::ios::binary | std::ios::trunc};
+        if (!out.is_open()) {
+            throw std::runtime_error("Failed to open " + output.string());
+        }
+        if (csv_layout && options.csv_header) {
+            std::string header_row;
+            RecordTextEncoder{options, metadata.ts_out, symbols}.AppendCsvHeader(*csv_layout, &header_row);
+            WriteBlock(out, header_row, output);
+        }
+        std::string text;
+        for (size_t i = 0; i < units.size(); ++i) {
+            TranscodeCounts counts;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                Slot& slot = slots[i % window];
+                cv.wait(lock, [&slot]() { return slot.ready; });
+                if (slot.error) {
+                    std::rethrow_exception(slot.error);
+                }
+                text.swap(slot.text);  // Old buffer goes back to the slot for reuse
+                counts = slot.counts;
+                slot.ready = false;
+                ++next_to_write;
+            }
+            cv.notify_all();
+            WriteBlock(out, text, output);
+            total += counts;
+        }
+        out.flush();
+        if (!out.good()) {
+            throw std::runtime_error("Failed to write " + output.string());
+        }
+    }
+    catch (...) {
+        stop();
+        throw;
+    }
+    stop();
+    return total;
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Transcoder Wrapper Structure
+// ============================================================================
+
+/**
+ * Pull-mode transcoder: text is produced as the caller reads it
+ */
+struct DbnTranscoderWrapper {
+    FileTextSource source;
+    std::string pending;
+    size_t pending_pos = 0;
+    bool at_end = false;
+
+    DbnTranscoderWrapper(const std::filesystem::path& path, const TextEncodeOptions& options)
+        : source(path, options, 1) {}
+};
+
+// ============================================================================
+// DBN Transcode API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_transcode(
+    const char* input_path,
+    const char* output_path,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        ValidateNonEmptyString("input_path", input_path);
+        ValidateNonEmptyString("output_path", output_path);
+        size_t worker_count = ResolveThreadCount(threads);
+        std::filesystem::path input{input_path};
+        if (!std::filesystem::exists(input)) {
+            SafeStrCopy(error_buffer, error_buffer_size, ("File does not exist: " + input.string()).c_str());
+            return nullptr;
+        }
+        std::filesystem::path output{output_path};
+
+        TextEncodeOptions options = TextEncodeOptions::FromJson(options_json);
+
+        // Written under a temporary name and renamed, so a failure never leaves a partial output
+        std::filesystem::path temp_path = output;
+        temp_path += ".transcode.tmp";
+        std::optional<TranscodeCounts> counts;
+        bool parallel = false;
+        try {
+            if (worker_count > 1) {
+                counts = TranscodeParallel(input, temp_path, options, worker_count);
+                parallel = counts.has_value();
+            }
+            if (!counts) {
+                counts = TranscodeSequential(input, temp_path, options, worker_count);
+            }
+            std::filesystem::rename(temp_path, output);
+        }
+        catch (...) {
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            throw;
+        }
+
+        json result = {
+            {"records", counts->records},
+            {"records_written", counts->written},
+            {"records_skipped", counts->records - counts->written},
+            {"bytes", std::filesystem::file_size(output)},
+            {"parallel", parallel}
+        };
+        return AllocateString(result.dump());
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnTranscoderHandle dbento_dbn_transcoder_open(
+    const char* file_path,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        ValidateNonEmptyString("file_path", file_path);
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, ("File does not exist: " + path.string()).c_str());
+            return nullptr;
+        }
+        TextEncodeOptions options = TextEncodeOptions::FromJson(options_json);
+        auto wrapper = std::make_unique<DbnTranscoderWrapper>(path, options);
+        return reinterpret_cast<DbnTranscoderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnTranscoder, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_transcoder_read(
+    DbnTranscoderHandle handle,
+    char* buffer,
+    size_t buffer_size,
+    size_t* bytes_written,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!buffer || buffer_size == 0 || !bytes_written) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid buffer");
+            return -2;
+        }
+        *bytes_written = 0;
+
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnTranscoderWrapper>(
+            handle, databento_native::HandleType::DbnTranscoder, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        size_t written = 0;
+        while (written < buffer_size) {
+            if (wrapper->pending_pos == wrapper->pending.size()) {
+                wrapper->pending.clear();
+                wrapper->pending_pos = 0;
+                if (wrapper->at_end ||
+                    !wrapper->source.Fill(&wrapper->pending, std::max(buffer_size - written, kTextBlockSize))) {
+                    wrapper->at_end = true;
+                    break;
+                }
+            }
+            size_t n = std::min(buffer_size - written, wrapper->pending.size() - wrapper->pending_pos);
+            std::memcpy(buffer + written, wrapper->pending.data() + wrapper->pending_pos, n);
+            wrapper->pending_pos += n;
+            written += n;
+        }
+        *bytes_written = written;
+        return written == 0 ? 1 : 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_transcoder_close(DbnTranscoderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnTranscoderWrapper>(
+            handle, databento_native::HandleType::DbnTranscoder, nullptr);
+        if (wrapper) {
+            delete wrapper;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
@@ -0,0 +1,402 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "mapped_file.hpp"
+#include "zstd_frame_io.hpp"
+#include <databento/constants.hpp>
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/iwritable.hpp>
+#include <databento/log.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <zstd.h>
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace db = databento;
+using json = nlohmann::json;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::ResolveThreadCount;
+using databento_native::ValidateInputFiles;
+
+// ============================================================================
+// Upgrader Internals
+// ============================================================================
+
+namespace {
+
+constexpr int kDefaultZstdLevel = 3;
+
+enum class UpgradeCompression { Keep, Zstd, None };
+enum class UpgradeIndex { Auto, Always, Never };
+
+struct UpgradeOptions {
+    UpgradeCompression compression = UpgradeCompression::Keep;
+    int zstd_level = kDefaultZstdLevel;
+    size_t frame_size = databento_native::kDefaultZstdFrameSize;
+    UpgradeIndex index = UpgradeIndex::Auto;
+    bool force = false;
+
+    /**
+     * {"compression": "keep" | "zstd" | "none", "compression_level": 1-22,
+     *  "frame_size": bytes, "index": "auto" | "always" | "never", "force": bool}
+     */
+    static UpgradeOptions FromJson(const char* options_json) {
+        UpgradeOptions options;
+        if (!options_json || options_json[0] == '\0') {
+            return options;
+        }
+        json j = json::parse(options_json);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Upgrade options must be a JSON object");
+        }
+        if (j.contains("compression") && !j["compression"].is_null()) {
+            std::string compression = j["compression"].get<std::string>();
+            if (compression == "keep") {
+                options.compression = UpgradeCompression::Keep;
+            } else if (compression == "zstd") {
+                options.compression = UpgradeCompression::Zstd;
+            } else if (compression == "none") {
+                options.compression = UpgradeCompression::None;
+            } else {
+                throw std::invalid_argument("Unknown compression: " + compression);
+            }
+        }
+        if (j.contains("compression_level") && !j["compression_level"].is_null()) {
+            options.zstd_level = j["compression_level"].get<int>();
+            if (options.zstd_level < 1 || options.zstd_level > ZSTD_maxCLevel()) {
+                throw std::invalid_argument("Compression level must be between 1 and " +
+                                            std::to_string(ZSTD_maxCLevel()));
+            }
+        }
+        if (j.contains("frame_size") && !j["frame_size"].is_null()) {
+            options.frame_size = j["frame_size"].get<size_t>();
+            if (options.frame_size == 0) {
+                throw std::invalid_argument("Frame size must be positive");
+            }
+        }
+        if (j.contains("index") && !j["index"].is_null()) {
+            std::string index = j["index"].get<std::string>();
+            if (index == "auto") {
+                options.index = UpgradeIndex::Auto;
+            } else if (index == "always") {
+                options.index = UpgradeIndex::Always;
+            } else if (index == "never") {
+                options.index = UpgradeIndex::Never;
+            } else {
+                throw std::invalid_argument("Unknown index policy: " + index);
+            }
+        }
+        options.force = j.value("force", options.force);
+        return options;
+    }
+};
+
+/**
+ * IWritable over an ofstream that throws as soon as a write fails
+ */
+class CheckedFileWritable : public db::IWritable {
+public:
+    explicit CheckedFileWritable(const std::filesystem::path& path)
+        : path_(path), out_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+    }
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        out_.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(length));
+        if (!out_.good()) {
+            throw std::runtime_error("Failed to write " + path_.string());
+        }
+    }
+
+    void Close() {
+        out_.close();
+        if (out_.fail()) {
+            throw std::runtime_error("Failed to write " + path_.string());
+        }
+    }
+
+private:
+    std::filesystem::path path_;
+    std::ofstream out_;
+};
+
+struct UpgradeFileResult {
+    std::filesystem::path input;
+    std::filesystem::path output;
+    std::string status = "upgraded";  // "upgraded", "skipped" or "failed"
+    int from_version = 0;
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    bool indexed = false;
+    std::string error;
+};
+
+bool HasZstdExtension(const std::filesystem::path& path) {
+    return path.extension() == ".zst";
+}
+
+/**
+ * Output path for an input: the input itself, or the same name in output_dir,
+ * with ".zst" added or removed when the compression changes
+ */
+std::filesystem::path UpgradeOutputPath(const std::filesystem::path& input, const std::filesystem::path& output_dir,
+                                        bool compressed) {
+    std::filesystem::path name = input.filename();
+    if (compressed && !HasZstdExtension(name)) {
+        name += ".zst";
+    } else if (!compressed && HasZstdExtension(name)) {
+        name.replace_extension();
+    }
+    return output_dir.empty() ? input.parent_path() / name : output_dir / name;
+}
+
+uint8_t ReadDbnVersion(const std::shared_ptr<const databento_native::MappedFile>& file) {
+    auto header = databento_native::ReadDbnHeader(databento_native::OpenDbnStreamAt(file, 0, 0, 0).get());
+    return static_cast<uint8_t>(header[3]);
+}
+
+/**
+ * Version and record count of a DBN file, read straight from its bytes
+ */
+std::pair<uint8_t, uint64_t> ScanDbnFile(const std::filesystem::path& path) {
+    auto file = std::make_shared<databento_native::MappedFile>(path);
+    file->Advise(databento_native::MappedAccess::Sequential);
+    auto input = databento_native::OpenDbnStreamAt(file, 0, 0, 0);
+    auto header = databento_native::ReadDbnHeader(input.get());
+    databento_native::RawRecordScanner scanner{input.get(), header.size()};
+    uint64_t count = 0;
+    uint64_t offset;
+    while (scanner.Next(&offset)) {
+        ++count;
+    }
+    return {static_cast<uint8_t>(header[3]), count};
+}
+
+/**
+ * Upgrade one file to the current DBN version
+ *
+ * The output is written under a temporary name next to its destination, verified
+ * by reading it back (record count and version), and renamed into place. An input
+ * that is replaced under another name is removed along with its index.
+ * @param thread_count Threads for decompressing the input and compressing the output
+ */
+void UpgradeFile(UpgradeFileResult* result, const std::filesystem::path& output_dir,
+                 const UpgradeOptions& options, size_t thread_count) {
+    const std::filesystem::path& input = result->input;
+    bool input_compressed;
+    {
+        auto file = std::make_shared<databento_native::MappedFile>(input);
+        input_compressed = databento_native::StartsWithZstdMagic(file->Data(), file->Size());
+        result->from_version = ReadDbnVersion(file);
+    }
+    bool output_compressed = options.compression == UpgradeCompression::Keep
+        ? input_compressed
+        : options.compression == UpgradeCompression::Zstd;
+    if (result->from_version >= db::kDbnVersion && !options.force) {
+        result->status = "skipped";
+        return;
+    }
+    result->output = UpgradeOutputPath(input, output_dir, output_compressed);
+    bool build_index = options.index == UpgradeIndex::Always ||
+        (options.index == UpgradeIndex::Auto &&
+         std::filesystem::exists(databento_native::DbnFileIndex::SidecarPath(input)));
+
+    std::filesystem::path temp_path = result->output;
+    temp_path += ".upgrade.tmp";
+    try {
+        {
+            std::unique_ptr<db::IReadable> source = databento_native::OpenParallelZstd(input, thread_count);
+            if (!source) {
+                source = std::make_unique<db::InFileStream>(input);
+            }
+            db::DbnDecoder decoder{db::ILogReceiver::Default(), std::move(source),
+                                   db::VersionUpgradePolicy::UpgradeToV3};
+            db::Metadata metadata = decoder.DecodeMetadata();
+            metadata.version = db::kDbnVersion;
+            metadata.symbol_cstr_len = db::kSymbolCstrLen;
+
+            CheckedFileWritable file{temp_path};
+            std::unique_ptr<databento_native::ParallelFramedZstdWritable> parallel_zstd;
+            std::unique_ptr<databento_native::FramedZstdWritable> zstd;
+            db::IWritable* out = &file;
+            if (output_compressed && thread_count > 1) {
+                parallel_zstd = std::make_unique<databento_native::ParallelFramedZstdWritable>(
+                    &file, options.zstd_level, options.frame_size, thread_count);
+                out = parallel_zstd.get();
+            } else if (output_compressed) {
+                zstd = std::make_unique<databento_native::FramedZstdWritable>(
+                    &file, options.zstd_level, options.frame_size);
+                out = zstd.get();
+            }
+
+            db::DbnEncoder::EncodeMetadata(metadata, out);
+            while (const db::Record* record = decoder.DecodeRecord()) {
+                out->WriteAll(reinterpret_cast<const std::byte*>(&record->Header()), record->Size());
+                ++result->records;
+            }
+            if (parallel_zstd) {
+                parallel_zstd->Finish();
+            } else if (zstd) {
+                zstd->Finish();
+            }
+            file.Close();
+        }
+
+        // Verify the output before it replaces anything
+        std::optional<databento_native::DbnFileIndex> index;
+        uint8_t written_version;
+        uint64_t written_records;
+        if (build_index) {
+            index = databento_native::DbnFileIndex::Build(temp_path);
+            written_version = ReadDbnVersion(std::make_shared<databento_native::MappedFile>(temp_path));
+            written_records = index->RecordCount();
+        } else {
+            std::tie(written_version, written_records) = ScanDbnFile(temp_path);
+        }
+        if (written_version != db::kDbnVersion) {
+            throw std::runtime_error("Output has DBN version " + std::to_string(written_version));
+        }
+        if (written_records != result->records) {
+            throw std::runtime_error("Output has " + std::to_string(written_records) + " records, read " +
+                                     std::to_string(result->records));
+        }
+
+        std::filesystem::remove(databento_native::DbnFileIndex::SidecarPath(result->output));
+        std::filesystem::rename(temp_path, result->output);
+        if (index) {
+            // Renaming keeps the size and mtime the index was built against
+            index->Save(result->output);
+            result->indexed = true;
+        }
+        if (output_dir.empty() && result->output != input) {
+            std::filesystem::remove(input);
+            std::filesystem::remove(databento_native::DbnFileIndex::SidecarPath(input));
+        }
+        result->bytes = std::filesystem::file_size(result->output);
+    }
+    catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(temp_path, ec);
+        throw;
+    }
+}
+
+/**
+ * Upgrade files on a pool of workers, one file per worker at a time
+ *
+ * Threads left over when there are fewer files than threads go to decompressing
+ * and compressing the frames of each file.
+ */
+json RunUpgrade(const std::vector<std::filesystem::path>& paths, const std::filesystem::path& output_dir,
+                const UpgradeOptions& options, size_t threads) {
+    std::vector<UpgradeFileResult> results(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        results[i].input = paths[i];
+    }
+    size_t file_workers = std::min(threads, paths.size());
+    size_t threads_per_file = std::max<size_t>(1, threads / file_workers);
+
+    // Failures are reported per file rather than ending the run
+    databento_native::RunOnWorkers(results.size(), file_workers, [&](size_t i, size_t) {
+        try {
+            UpgradeFile(&results[i], output_dir, options, threads_per_file);
+        }
+        catch (const std::exception& e) {
+            results[i].status = "failed";
+            results[i].error = e.what();
+        }
+    });
+
+    json files = json::array();
+    uint64_t upgraded = 0;
+    uint64_t skipped = 0;
+    uint64_t failed = 0;
+    uint64_t records = 0;
+    for (const auto& result : results) {
+        upgraded += result.status == "upgraded";
+        skipped += result.status == "skipped";
+        failed += result.status == "failed";
+        records += result.records;
+        files.push_back({
+            {"input", result.input.string()},
+            {"output", result.output.empty() ? json(nullptr) : json(result.output.string())},
+            {"status", result.status},
+            {"from_version", result.from_version},
+            {"records", result.records},
+            {"bytes", result.bytes},
+            {"indexed", result.indexed},
+            {"error", result.error.empty() ? json(nullptr) : json(result.error)}
+        });
+    }
+    return {{"files", files}, {"upgraded", upgraded}, {"skipped", skipped}, {"failed", failed},
+            {"records", records}};
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Upgrade API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_upgrade(
+    const char** file_paths,
+    size_t file_count,
+    const char* output_dir,
+    const char* options_json,
+    int threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        size_t worker_count = ResolveThreadCount(threads);
+        std::filesystem::path out_dir;
+        if (output_dir && output_dir[0] != '\0') {
+            out_dir = output_dir;
+            if (!std::filesystem::is_directory(out_dir)) {
+                SafeStrCopy(error_buffer, error_buffer_size,
+                    ("Directory does not exist: " + out_dir.string()).c_str());
+                return nullptr;
+            }
+        }
+
+        UpgradeOptions options = UpgradeOptions::FromJson(options_json);
+        std::set<std::filesystem::path> outputs;
+        for (const auto& path : paths) {
+            // Both possible output names must be free, since compression may be kept per file
+            for (bool compressed : {false, true}) {
+                std::filesystem::path output = std::filesystem::weakly_canonical(
+                    UpgradeOutputPath(path, out_dir, compressed));
+                if (!outputs.insert(output).second) {
+                    SafeStrCopy(error_buffer, error_buffer_size,
+                        ("Two inputs would be written to " + output.string()).c_str());
+                    return nullptr;
+                }
+            }
+        }
+
+        std::string json_str = RunUpgrade(paths, out_dir, options, worker_count).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
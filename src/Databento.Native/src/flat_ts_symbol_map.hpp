@@ -0,0 +1,379 @@
+#pragma once
+
+#include "symbol_table.hpp"
+#include <databento/symbol_map.hpp>
+#include <date/date.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+constexpr uint64_t kNanosPerDay = 86'400'000'000'000ULL;
+
+/**
+ * Read-only time-series instrument_id -> symbol map laid out for fast lookup
+ *
+ * databento::TsSymbolMap keys a std::map on (year_month_day, instrument_id), so
+ * every lookup converts a timestamp to a calendar date and walks a tree. This map
+ * holds the same mappings as runs of days: a sorted instrument ID array, a flat
+ * interval array sliced per instrument and sorted by day, and a pool of
+ * NUL-terminated symbols. Each instrument gets a compact ordinal (a direct table
+ * when IDs are dense, an open-addressing hash otherwise), so a lookup is a
+ * division, one probe and a scan of the instrument's few intervals. Symbols are
+ * indices into the pool, so bulk callers can label records without copying strings.
+ *
+ * The arrays are either owned or borrowed from a snapshot mapped into memory (see
+ * symbol_map_snapshot.hpp); only the ordinal index is built on load. The reverse
+ * symbol -> instrument index is built on the first reverse lookup.
+ */
+class FlatTsSymbolMap {
+public:
+    struct Interval {
+        int32_t first_day;  // Inclusive, days since the epoch
+        int32_t last_day;   // Inclusive
+        uint32_t symbol;    // Index into the symbol pool
+    };
+
+    /**
+     * Arrays describing a map, as stored in a snapshot
+     */
+    struct Sections {
+        uint64_t size = 0;                       // Number of (day, instrument) mappings
+        const uint32_t* ids = nullptr;           // Sorted instrument IDs
+        const uint32_t* offsets = nullptr;       // Intervals of ids[i] are [offsets[i], offsets[i + 1])
+        const Interval* intervals = nullptr;
+        const uint32_t* symbol_offsets = nullptr;  // Symbol i starts at pool + symbol_offsets[i]
+        const char* pool = nullptr;              // NUL-terminated symbols back to back
+        uint32_t instrument_count = 0;
+        uint32_t interval_count = 0;
+        uint32_t symbol_count = 0;
+        uint32_t pool_size = 0;
+    };
+
+    explicit FlatTsSymbolMap(const databento::TsSymbolMap& source) {
+        // Collect (day, symbol) per instrument; equal strings share a pool index
+        SymbolTable symbols;
+        std::unordered_map<uint32_t, std::vector<std::pair<int32_t, uint32_t>>> days;
+        std::unordered_map<const std::string*, uint32_t> symbol_ids;
+        for (const auto& [key, symbol] : source.Map()) {
+            auto id = symbol_ids.find(symbol.get());
+            if (id == symbol_ids.end()) {
+                id = symbol_ids.emplace(symbol.get(), symbols.Intern(*symbol)).first;
+            }
+            int32_t day = date::sys_days{key.first}.time_since_epoch().count();
+            days[key.second].emplace_back(day, id->second);
+            ++sections_.size;
+        }
+
+        owned_ids_.reserve(days.size());
+        for (const auto& entry : days) {
+            owned_ids_.push_back(entry.first);
+        }
+        std::sort(owned_ids_.begin(), owned_ids_.end());
+
+        // Merge consecutive days with the same symbol into intervals
+        owned_offsets_.reserve(owned_ids_.size() + 1);
+        owned_offsets_.push_back(0);
+        for (uint32_t instrument_id : owned_ids_) {
+            auto& instrument_days = days[instrument_id];
+            std::sort(instrument_days.begin(), instrument_days.end());
+            for (const auto& [day, symbol] : instrument_days) {
+                if (static_cast<uint32_t>(owned_intervals_.size()) > owned_offsets_.back()) {
+                    Interval& last = owned_intervals_.back();
+                    if (last.symbol == symbol && last.last_day + 1 == day) {
+                        last.last_day = day;
+                        continue;
+                    }
+                }
+                owned_intervals_.push_back({day, day, symbol});
+            }
+            owned_offsets_.push_back(static_cast<uint32_t>(owned_intervals_.size()));
+        }
+
+        owned_symbol_offsets_.reserve(symbols.Size() + 1);
+        for (uint32_t i = 0; i < symbols.Size(); ++i) {
+            owned_symbol_offsets_.push_back(static_cast<uint32_t>(owned_pool_.size()));
+            owned_pool_.append(symbols.At(i));
+            owned_pool_.push_back('\0');
+        }
+        owned_symbol_offsets_.push_back(static_cast<uint32_t>(owned_pool_.size()));
+
+        sections_.ids = owned_ids_.data();
+        sections_.offsets = owned_offsets_.data();
+        sections_.intervals = owned_intervals_.data();
+        sections_.symbol_offsets = owned_symbol_offsets_.data();
+        sections_.pool = owned_pool_.data();
+        sections_.instrument_count = static_cast<uint32_t>(owned_ids_.size());
+        sections_.interval_count = static_cast<uint32_t>(owned_intervals_.size());
+        sections_.symbol_count = static_cast<uint32_t>(symbols.Size());
+        sections_.pool_size = static_cast<uint32_t>(owned_pool_.size());
+        BuildOrdinals();
+    }
+
+    /**
+     * Map over arrays owned by someone else, e.g. a mapped snapshot
+     * @param sections Arrays, which must stay valid while `keep_alive` is held
+     * @param keep_alive Owner of the arrays, released with the map
+     * @throws std::invalid_argument if the arrays are inconsistent
+     */
+    FlatTsSymbolMap(const Sections& sections, std::shared_ptr<const void> keep_alive)
+        : sections_(sections), keep_alive_(std::move(keep_alive)) {
+        Validate();
+        BuildOrdinals();
+    }
+
+    FlatTsSymbolMap(const FlatTsSymbolMap&) = delete;
+    FlatTsSymbolMap& operator=(const FlatTsSymbolMap&) = delete;
+
+    /**
+     * Symbol index for an instrument on a UTC day (days since the epoch)
+     * @return Index into the symbol pool, or -1 if not mapped
+     */
+    int32_t Find(int32_t day, uint32_t instrument_id) const {
+        uint32_t ordinal;
+        if (!FindOrdinal(instrument_id, &ordinal)) {
+            return -1;
+        }
+        const Interval* it = sections_.intervals + sections_.offsets[ordinal];
+        const Interval* end = sections_.intervals + sections_.offsets[ordinal + 1];
+        for (; it != end && it->first_day <= day; ++it) {
+            if (day <= it->last_day) {
+                return static_cast<int32_t>(it->symbol);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Symbol index for an instrument at a timestamp in nanoseconds since the epoch
+     */
+    int32_t FindTs(uint64_t ts, uint32_t instrument_id) const {
+        return Find(static_cast<int32_t>(ts / kNanosPerDay), instrument_id);
+    }
+
+    int32_t Find(date::year_month_day date, uint32_t instrument_id) const {
+        return Find(static_cast<int32_t>(date::sys_days{date}.time_since_epoch().count()), instrument_id);
+    }
+
+    /**
+     * Instrument mapped to `symbol` on a UTC day (days since the epoch)
+     * If several instruments map to the symbol that day, the one whose interval
+     * starts first is returned.
+     * @return false if no instrument maps to the symbol that day
+     */
+    bool FindInstrument(std::string_view symbol, int32_t day, uint32_t* instrument_id) const {
+        std::call_once(reverse_once_, [this] { BuildReverse(); });
+        auto it = reverse_symbols_.find(symbol);
+        if (it == reverse_symbols_.end()) {
+            return false;
+        }
+        const ReverseInterval* r = reverse_.data() + reverse_offsets_[it->second];
+        const ReverseInterval* end = reverse_.data() + reverse_offsets_[it->second + 1];
+        for (; r != end && r->first_day <= day; ++r) {
+            if (day <= r->last_day) {
+                *instrument_id = r->instrument_id;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool FindInstrumentTs(std::string_view symbol, uint64_t ts, uint32_t* instrument_id) const {
+        return FindInstrument(symbol, static_cast<int32_t>(ts / kNanosPerDay), instrument_id);
+    }
+
+    bool FindInstrument(std::string_view symbol, date::year_month_day date, uint32_t* instrument_id) const {
+        return FindInstrument(symbol, static_cast<int32_t>(date::sys_days{date}.time_since_epoch().count()),
+                              instrument_id);
+    }
+
+    // NUL-terminated symbol at a pool index
+    const char* Symbol(uint32_t index) const {
+        if (index >= sections_.symbol_count) {
+            throw std::out_of_range("Symbol index out of range");
+        }
+        return sections_.pool + sections_.symbol_offsets[index];
+    }
+
+    size_t SymbolCount() const { return sections_.symbol_count; }
+
+    /**
+     * Symbols [first, SymbolCount()) as they sit in the pool, each NUL-terminated
+     */
+    std::string_view PackedSymbols(size_t first) const {
+        first = std::min<size_t>(first, sections_.symbol_count);
+        size_t begin = sections_.symbol_offsets[first];
+        return {sections_.pool + begin, sections_.pool_size - begin};
+    }
+
+    const Sections& GetSections() const { return sections_; }
+
+    // Number of (day, instrument) mappings, as databento::TsSymbolMap::Size counts them
+    size_t Size() const { return static_cast<size_t>(sections_.size); }
+    bool IsEmpty() const { return sections_.size == 0; }
+
+private:
+    static constexpr uint32_t kNoOrdinal = UINT32_MAX;
+
+    // Reject borrowed arrays a lookup could read out of bounds with
+    void Validate() const {
+        const Sections& s = sections_;
+        if ((s.instrument_count > 0 && (!s.ids || !s.offsets)) || (s.interval_count > 0 && !s.intervals)) {
+            throw std::invalid_argument("Symbol map is missing its instrument arrays");
+        }
+        if (s.offsets && (s.offsets[0] != 0 || s.offsets[s.instrument_count] != s.interval_count)) {
+            throw std::invalid_argument("Symbol map interval offsets are inconsistent");
+        }
+        for (uint32_t i = 0; i < s.instrument_count; ++i) {
+            if (s.offsets[i] > s.offsets[i + 1] || (i > 0 && s.ids[i - 1] >= s.ids[i])) {
+                throw std::invalid_argument("Symbol map instruments are not sorted");
+            }
+        }
+        for (uint32_t i = 0; i < s.interval_count; ++i) {
+            if (s.intervals[i].symbol >= s.symbol_count) {
+                throw std::invalid_argument("Symbol map interval names an unknown symbol");
+            }
+        }
+        if (!s.symbol_offsets || s.symbol_offsets[0] != 0 || s.symbol_offsets[s.symbol_count] != s.pool_size) {
+            throw std::invalid_argument("Symbol map string pool is inconsistent");
+        }
+        for (uint32_t i = 0; i < s.symbol_count; ++i) {
+            uint32_t end = s.symbol_offsets[i + 1];
+            if (end <= s.symbol_offsets[i] || s.pool[end - 1] != '\0') {
+                throw std::invalid_argument("Symbol map string pool is inconsistent");
+            }
+        }
+    }
+
+    struct ReverseInterval {
+        int32_t first_day;
+        int32_t last_day;
+        uint32_t instrument_id;
+    };
+
+    // Regroup the intervals by symbol, each symbol's sorted by first day
+    void BuildReverse() const {
+        const Sections& s = sections_;
+        reverse_symbols_.reserve(s.symbol_count);
+        for (uint32_t i = 0; i < s.symbol_count; ++i) {
+            const char* symbol = s.pool + s.symbol_offsets[i];
+            reverse_symbols_.emplace(std::string_view{symbol, s.symbol_offsets[i + 1] - s.symbol_offsets[i] - 1}, i);
+        }
+        reverse_offsets_.assign(s.symbol_count + 1, 0);
+        for (uint32_t i = 0; i < s.interval_count; ++i) {
+            ++reverse_offsets_[s.intervals[i].symbol + 1];
+        }
+        for (uint32_t i = 0; i < s.symbol_count; ++i) {
+            reverse_offsets_[i + 1] += reverse_offsets_[i];
+        }
+        reverse_.resize(s.interval_count);
+        std::vector<uint32_t> next(reverse_offsets_.begin(), reverse_offsets_.end() - 1);
+        for (uint32_t ordinal = 0; ordinal < s.instrument_count; ++ordinal) {
+            for (uint32_t i = s.offsets[ordinal]; i < s.offsets[ordinal + 1]; ++i) {
+                const Interval& interval = s.intervals[i];
+                reverse_[next[interval.symbol]++] = {interval.first_day, interval.last_day, s.ids[ordinal]};
+            }
+        }
+        for (uint32_t i = 0; i < s.symbol_count; ++i) {
+            std::sort(reverse_.begin() + reverse_offsets_[i], reverse_.begin() + reverse_offsets_[i + 1],
+                      [](const ReverseInterval& a, const ReverseInterval& b) { return a.first_day < b.first_day; });
+        }
+    }
+
+    // Direct table over [min_id_, min_id_ + dense_.size()) when IDs are dense
+    void BuildOrdinals() {
+        const uint32_t* ids = sections_.ids;
+        size_t count = sections_.instrument_count;
+        if (count == 0) {
+            return;
+        }
+        uint64_t range = static_cast<uint64_t>(ids[count - 1]) - ids[0] + 1;
+        if (range <= std::max<uint64_t>(4 * count, 1 << 16)) {
+            min_id_ = ids[0];
+            dense_.assign(static_cast<size_t>(range), kNoOrdinal);
+            for (size_t i = 0; i < count; ++i) {
+                dense_[ids[i] - min_id_] = static_cast<uint32_t>(i);
+            }
+            return;
+        }
+        size_t capacity = 16;
+        hash_shift_ = 60;
+        while (capacity < count * 2) {
+            capacity <<= 1;
+            --hash_shift_;
+        }
+        hash_mask_ = capacity - 1;
+        hash_keys_.assign(capacity, 0);
+        hash_ordinals_.assign(capacity, kNoOrdinal);
+        for (size_t i = 0; i < count; ++i) {
+            size_t slot = Hash(ids[i]);
+            while (hash_ordinals_[slot] != kNoOrdinal) {
+                slot = (slot + 1) & hash_mask_;
+            }
+            hash_keys_[slot] = ids[i];
+            hash_ordinals_[slot] = static_cast<uint32_t>(i);
+        }
+    }
+
+    bool FindOrdinal(uint32_t instrument_id, uint32_t* ordinal) const {
+        if (!dense_.empty()) {
+            uint32_t offset = instrument_id - min_id_;
+            if (instrument_id < min_id_ || offset >= dense_.size()) {
+                return false;
+            }
+            *ordinal = dense_[offset];
+            return *ordinal != kNoOrdinal;
+        }
+        if (hash_ordinals_.empty()) {
+            return false;
+        }
+        for (size_t slot = Hash(instrument_id);; slot = (slot + 1) & hash_mask_) {
+            if (hash_ordinals_[slot] == kNoOrdinal) {
+                return false;
+            }
+            if (hash_keys_[slot] == instrument_id) {
+                *ordinal = hash_ordinals_[slot];
+                return true;
+            }
+        }
+    }
+
+    // Fibonacci hashing: the top bits of the product index the table
+    size_t Hash(uint32_t instrument_id) const {
+        return static_cast<size_t>((instrument_id * 0x9E3779B97F4A7C15ULL) >> hash_shift_);
+    }
+
+    Sections sections_;
+    std::shared_ptr<const void> keep_alive_;
+
+    // Storage for a map built in memory; empty for a borrowed one
+    std::vector<uint32_t> owned_ids_;
+    std::vector<uint32_t> owned_offsets_;
+    std::vector<Interval> owned_intervals_;
+    std::vector<uint32_t> owned_symbol_offsets_;
+    std::string owned_pool_;
+
+    uint32_t min_id_ = 0;
+    std::vector<uint32_t> dense_;
+    std::vector<uint32_t> hash_keys_;
+    std::vector<uint32_t> hash_ordinals_;
+    size_t hash_mask_ = 0;
+    int hash_shift_ = 60;
+
+    // Reverse index, built once on demand; views into the pool
+    mutable std::once_flag reverse_once_;
+    mutable std::unordered_map<std::string_view, uint32_t> reverse_symbols_;
+    mutable std::vector<uint32_t> reverse_offsets_;
+    mutable std::vector<ReverseInterval> reverse_;
+};
+
+}  // namespace databento_native
@@ -1,15 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <unordered_set>
-#include <string>
+#include <stdexcept>
 
 namespace databento_native {
 
-// Magic number to identify valid handles (DATABENTO in hex: 0xDA7ABE70)
-constexpr uint32_t HANDLE_MAGIC = 0xDA7ABE70;
-
 // Handle types for type safety
 enum class HandleType : uint32_t {
     LiveClient = 1,
@@ -21,68 +21,12 @@ enum class HandleType : uint32_t {
     Metadata = 7,
     SymbologyResolution = 8,
     UnitPrices = 9,
-    BatchJob = 10
-};
-
-/**
- * Handle header prepended to each wrapper object
- * Provides type safety and validation
- */
-struct HandleHeader {
-    uint32_t magic;          // Magic number for validation
-    HandleType type;         // Type of wrapper
-    void* wrapper_ptr;       // Pointer to actual wrapper object
-
-    HandleHeader(HandleType t, void* ptr)
-        : magic(HANDLE_MAGIC)
-        , type(t)
-        , wrapper_ptr(ptr)
-    {}
-};
-
-/**
- * Thread-safe handle registry
- * Tracks all valid handles to prevent use-after-free
- */
-class HandleRegistry {
-public:
-    static HandleRegistry& Instance() {
-        static HandleRegistry instance;
-        return instance;
-    }
-
-    // Register a new handle
-    void Register(HandleHeader* handle) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        handles_.insert(handle);
-    }
-
-    // Unregister a handle (when destroying)
-    void Unregister(HandleHeader* handle) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        handles_.erase(handle);
-    }
-
-    // Check if handle is registered
-    bool IsRegistered(HandleHeader* handle) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return handles_.find(handle) != handles_.end();
-    }
-
-    // Get count of registered handles (for diagnostics)
-    size_t Count() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return handles_.size();
-    }
-
-private:
-    HandleRegistry() = default;
-    ~HandleRegistry() = default;
-    HandleRegistry(const HandleRegistry&) = delete;
-    HandleRegistry& operator=(const HandleRegistry&) = delete;
-
-    std::mutex mutex_;
-    std::unordered_set<HandleHeader*> handles_;
+    BatchJob = 10,
+    Replay = 11,
+    DbnMmapReader = 12,
+    DbnMergeReader = 13,
+    DbnColumnarReader = 14,
+    DbnTranscoder = 15
 };
 
 /**
@@ -107,7 +51,7 @@ inline const char* GetValidationErrorMessage(ValidationError error) {
         case ValidationError::NullHandle:
             return "Handle is NULL";
         case ValidationError::InvalidMagic:
-            return "Invalid handle magic number (corrupted or invalid handle)";
+            return "Invalid handle value (corrupted or invalid handle)";
         case ValidationError::NotRegistered:
             return "Handle not registered (possibly freed or never created)";
         case ValidationError::WrongType:
@@ -119,9 +63,171 @@ inline const char* GetValidationErrorMessage(ValidationError error) {
     }
 }
 
+/**
+ * Generational slot map of live handles
+ *
+ * A handle is not a pointer but a value packing a slot index, the handle type and
+ * the slot's generation:
+ *
+ *   64-bit: generation (26 bits) | type (6 bits) | index (32 bits)
+ *   32-bit: generation (8 bits)  | type (6 bits) | index (18 bits)
+ *
+ * A live slot stores its handle value, so validation is a bounds check and an
+ * atomic load-and-compare with no lock: it is wait-free and never dereferences
+ * memory that may have been freed. Registering and unregistering take a mutex,
+ * which API calls on existing handles never touch.
+ *
+ * Reclamation is deferred. Slots live in fixed chunks that are never freed, so a
+ * stale handle always reads valid memory; a released slot waits in a FIFO until
+ * kReuseDelay other slots have been released before it is reused, and reuse bumps
+ * its generation, so the stale handle no longer matches. A slot whose generation
+ * counter is exhausted is retired rather than reused.
+ */
+class HandleRegistry {
+public:
+    static constexpr unsigned kHandleBits = sizeof(uintptr_t) * 8;
+    static constexpr unsigned kIndexBits = kHandleBits == 64 ? 32 : 18;
+    static constexpr unsigned kTypeBits = 6;
+    static constexpr unsigned kGenerationBits = kHandleBits - kIndexBits - kTypeBits;
+    static constexpr uintptr_t kIndexMask = (uintptr_t{1} << kIndexBits) - 1;
+    static constexpr uintptr_t kTypeMask = (uintptr_t{1} << kTypeBits) - 1;
+    static constexpr uint32_t kMaxGeneration = static_cast<uint32_t>((uint64_t{1} << kGenerationBits) - 1);
+
+    static constexpr size_t kChunkSize = 4096;
+    static constexpr size_t kMaxSlots = kHandleBits == 64 ? size_t{1} << 22 : size_t{1} << kIndexBits;
+    static constexpr size_t kMaxChunks = kMaxSlots / kChunkSize;
+    static constexpr size_t kReuseDelay = 1024;
+
+    static HandleRegistry& Instance() {
+        // Never destroyed, so handles released during static destruction stay safe
+        static HandleRegistry* instance = new HandleRegistry();
+        return *instance;
+    }
+
+    /**
+     * Register a wrapper and return its handle
+     * @return Handle value
+     * @throws std::runtime_error if every slot is in use
+     */
+    void* Register(HandleType type, void* wrapper) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t index;
+        if (free_.size() > kReuseDelay) {
+            index = free_.front();
+            free_.pop_front();
+        } else if (next_index_ < kMaxSlots) {
+            index = next_index_++;
+            if (index % kChunkSize == 0) {
+                chunks_[index / kChunkSize].store(new Slot[kChunkSize], std::memory_order_release);
+            }
+        } else if (!free_.empty()) {
+            index = free_.front();
+            free_.pop_front();
+        } else {
+            throw std::runtime_error("Handle registry is full");
+        }
+
+        Slot& slot = SlotAt(index);
+        uintptr_t value = (static_cast<uintptr_t>(slot.generation) << (kIndexBits + kTypeBits)) |
+                          ((static_cast<uintptr_t>(type) & kTypeMask) << kIndexBits) |
+                          static_cast<uintptr_t>(index);
+        slot.wrapper.store(wrapper, std::memory_order_relaxed);
+        // Publishing the value makes the wrapper pointer visible to validators
+        slot.handle.store(value, std::memory_order_release);
+        live_.fetch_add(1, std::memory_order_relaxed);
+        return reinterpret_cast<void*>(value);
+    }
+
+    /**
+     * Unregister a handle; unknown or already released handles are ignored
+     */
+    void Unregister(void* handle) {
+        auto value = reinterpret_cast<uintptr_t>(handle);
+        size_t index = static_cast<size_t>(value & kIndexMask);
+        if (!handle || index >= next_index_.load(std::memory_order_acquire)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        Slot& slot = SlotAt(index);
+        uintptr_t expected = value;
+        if (!slot.handle.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+            return;
+        }
+        live_.fetch_sub(1, std::memory_order_relaxed);
+        // The wrapper pointer is left in place; a validator racing with this call
+        // re-reads the handle value after loading it and sees the slot was released
+        if (slot.generation < kMaxGeneration) {
+            ++slot.generation;
+            free_.push_back(index);
+        }
+    }
+
+    /**
+     * Wrapper registered under `handle`
+     * Wait-free: a few atomic loads, no lock and no retry loop.
+     */
+    void* Lookup(void* handle, HandleType expected_type, ValidationError* error_out) const {
+        auto value = reinterpret_cast<uintptr_t>(handle);
+        size_t index = static_cast<size_t>(value & kIndexMask);
+        const Slot* chunk = index < kMaxSlots ? chunks_[index / kChunkSize].load(std::memory_order_acquire) : nullptr;
+        if (!chunk) {
+            if (error_out) *error_out = ValidationError::InvalidMagic;
+            return nullptr;
+        }
+        const Slot& slot = chunk[index % kChunkSize];
+        if (slot.handle.load(std::memory_order_acquire) != value) {
+            if (error_out) *error_out = ValidationError::NotRegistered;
+            return nullptr;
+        }
+        void* wrapper = slot.wrapper.load(std::memory_order_acquire);
+        // Released (and possibly reused) between the two loads
+        if (slot.handle.load(std::memory_order_acquire) != value) {
+            if (error_out) *error_out = ValidationError::NotRegistered;
+            return nullptr;
+        }
+        if (static_cast<uint32_t>((value >> kIndexBits) & kTypeMask) != static_cast<uint32_t>(expected_type)) {
+            if (error_out) *error_out = ValidationError::WrongType;
+            return nullptr;
+        }
+        if (!wrapper) {
+            if (error_out) *error_out = ValidationError::NullWrapperPtr;
+            return nullptr;
+        }
+        if (error_out) *error_out = ValidationError::Success;
+        return wrapper;
+    }
+
+    // Get count of registered handles (for diagnostics)
+    size_t Count() const {
+        return live_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<uintptr_t> handle{0};     // Live handle value, 0 when free
+        std::atomic<void*> wrapper{nullptr};
+        uint32_t generation = 0;              // Guarded by mutex_
+    };
+
+    HandleRegistry() = default;
+    ~HandleRegistry() = default;
+    HandleRegistry(const HandleRegistry&) = delete;
+    HandleRegistry& operator=(const HandleRegistry&) = delete;
+
+    Slot& SlotAt(size_t index) {
+        return chunks_[index / kChunkSize].load(std::memory_order_relaxed)[index % kChunkSize];
+    }
+
+    std::atomic<Slot*> chunks_[kMaxChunks] = {};
+    std::atomic<size_t> next_index_{0};
+    std::atomic<size_t> live_{0};
+    std::mutex mutex_;
+    std::deque<size_t> free_;
+};
+
 /**
  * Validate and cast a handle to its wrapper type
- * Thread-safe validation with comprehensive checks
+ * Thread-safe and wait-free
  *
  * @param handle Opaque handle pointer
  * @param expected_type Expected wrapper type
@@ -135,78 +241,50 @@ WrapperType* ValidateAndCast(void* handle, HandleType expected_type, ValidationE
         if (error_out) *error_out = ValidationError::NullHandle;
         return nullptr;
     }
-
-    // Cast to handle header
-    auto* header = static_cast<HandleHeader*>(handle);
-
-    // Check magic number
-    if (header->magic != HANDLE_MAGIC) {
-        if (error_out) *error_out = ValidationError::InvalidMagic;
-        return nullptr;
-    }
-
-    // Check if handle is registered
-    if (!HandleRegistry::Instance().IsRegistered(header)) {
-        if (error_out) *error_out = ValidationError::NotRegistered;
-        return nullptr;
-    }
-
-    // Check handle type
-    if (header->type != expected_type) {
-        if (error_out) *error_out = ValidationError::WrongType;
-        return nullptr;
-    }
-
-    // Check wrapper pointer
-    if (!header->wrapper_ptr) {
-        if (error_out) *error_out = ValidationError::NullWrapperPtr;
-        return nullptr;
-    }
-
-    if (error_out) *error_out = ValidationError::Success;
-    return static_cast<WrapperType*>(header->wrapper_ptr);
+    return static_cast<WrapperType*>(HandleRegistry::Instance().Lookup(handle, expected_type, error_out));
 }
 
 /**
  * Create a validated handle
- * Allocates handle header and registers it
+ * Registers the wrapper in a free slot of the handle registry
  *
  * @param type Handle type
  * @param wrapper_ptr Pointer to wrapper object
  * @return Opaque handle pointer
+ * @throws std::runtime_error if the registry is full
  */
 inline void* CreateValidatedHandle(HandleType type, void* wrapper_ptr) {
     if (!wrapper_ptr) {
         return nullptr;
     }
+    return HandleRegistry::Instance().Register(type, wrapper_ptr);
+}
 
-    auto* header = new HandleHeader(type, wrapper_ptr);
-    HandleRegistry::Instance().Register(header);
-    return static_cast<void*>(header);
+/**
+ * Create a validated handle that takes ownership of the wrapper
+ * The wrapper is freed if registration throws and released to the handle otherwise.
+ *
+ * @param type Handle type
+ * @param wrapper Wrapper object
+ * @return Opaque handle pointer
+ * @throws std::runtime_error if the registry is full
+ */
+template<typename WrapperType>
+void* CreateValidatedHandle(HandleType type, std::unique_ptr<WrapperType> wrapper) {
+    void* handle = CreateValidatedHandle(type, static_cast<void*>(wrapper.get()));
+    wrapper.release();
+    return handle;
 }
 
 /**
  * Destroy a validated handle
- * Unregisters and frees the handle header
+ * Releases its registry slot; destroying a handle twice is harmless
  * NOTE: Does NOT free the wrapper object - caller must do that
  *
  * @param handle Opaque handle pointer
  */
 inline void DestroyValidatedHandle(void* handle) {
-    if (!handle) {
-        return;
-    }
-
-    auto* header = static_cast<HandleHeader*>(handle);
-
-    // Unregister first
-    HandleRegistry::Instance().Unregister(header);
-
-    // Invalidate magic to catch double-free
-    header->magic = 0xDEADDEAD;
-
-    // Free handle header
-    delete header;
+    HandleRegistry::Instance().Unregister(handle);
 }
 
 } // namespace databento_native
@@ -1,6 +1,7 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
+#include "historical_client_wrapper.hpp"
 #include <databento/historical.hpp>
 #include <databento/record.hpp>
 #include <databento/enums.hpp>
@@ -18,6 +19,7 @@
 namespace db = databento;
 using json = nlohmann::json;
 using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
 using databento_native::ParseSchema;
 using databento_native::NsToUnixNanos;
 using databento_native::ValidateNonEmptyString;
@@ -27,15 +29,11 @@ using databento_native::ValidateTimeRange;
 // ============================================================================
 // Internal Wrapper Class
 // ============================================================================
-struct HistoricalClientWrapper {
-    std::unique_ptr<db::Historical> client;
-    std::string api_key;
 
-    explicit HistoricalClientWrapper(const std::string& key)
-        : api_key(key) {
-        client = std::make_unique<db::Historical>(nullptr, key, db::HistoricalGateway::Bo1);
-    }
-};
+// Clients are created on demand, so the default pool only grows under concurrent use
+constexpr size_t kDefaultPoolSize = 4;
+constexpr std::chrono::milliseconds kDefaultIdleTimeout{60000};
+constexpr size_t kMaxPoolSize = 256;
 
 struct MetadataWrapper {
     db::Metadata metadata;
@@ -63,9 +61,46 @@ DATABENTO_API DbentoHistoricalClientHandle dbento_historical_create(
             return nullptr;
         }
 
-        auto* wrapper = new HistoricalClientWrapper(api_key);
+        auto wrapper = std::make_unique<HistoricalClientWrapper>(api_key, kDefaultPoolSize, kDefaultIdleTimeout);
         return reinterpret_cast<DbentoHistoricalClientHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::HistoricalClient, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::HistoricalClient, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbentoHistoricalClientHandle dbento_historical_create_pooled(
+    const char* api_key,
+    size_t pool_size,
+    int64_t idle_timeout_ms,
+    size_t prewarm_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!api_key) {
+            SafeStrCopy(error_buffer, error_buffer_size, "API key cannot be null");
+            return nullptr;
+        }
+        if (pool_size == 0 || pool_size > kMaxPoolSize) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Pool size must be between 1 and 256");
+            return nullptr;
+        }
+        if (idle_timeout_ms < 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Idle timeout cannot be negative");
+            return nullptr;
+        }
+
+        auto wrapper = std::make_unique<HistoricalClientWrapper>(
+            api_key, pool_size, std::chrono::milliseconds{idle_timeout_ms});
+        if (prewarm_count > 0) {
+            wrapper->pool->Prewarm(prewarm_count);
+        }
+
+        return reinterpret_cast<DbentoHistoricalClientHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::HistoricalClient, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -90,7 +125,7 @@ DATABENTO_API int dbento_historical_get_range(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return -1;
@@ -121,7 +156,7 @@ DATABENTO_API int dbento_historical_get_range(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Call timeseries API
-        wrapper->client->TimeseriesGetRange(
+        wrapper->pool->Acquire()->TimeseriesGetRange(
             dataset,
             datetime_range,
             symbol_vec,
@@ -162,7 +197,7 @@ DATABENTO_API int dbento_historical_get_range_to_file(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return -1;
@@ -192,7 +227,7 @@ DATABENTO_API int dbento_historical_get_range_to_file(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Call TimeseriesGetRangeToFile
-        wrapper->client->TimeseriesGetRangeToFile(
+        wrapper->pool->Acquire()->TimeseriesGetRangeToFile(
             dataset,
             datetime_range,
             symbol_vec,
@@ -221,7 +256,7 @@ DATABENTO_API DbentoMetadataHandle dbento_historical_get_metadata(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -332,7 +367,7 @@ DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolv
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -378,7 +413,7 @@ DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolv
         db::DateRange date_range{start_date, end_date};
 
         // Call SymbologyResolve
-        auto resolution = wrapper->client->SymbologyResolve(
+        auto resolution = wrapper->pool->Acquire()->SymbologyResolve(
             dataset,
             symbol_vec,
             stype_in_enum,
@@ -386,9 +421,9 @@ DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolv
             date_range
         );
 
-        auto* res_wrapper = new SymbologyResolutionWrapper(std::move(resolution));
+        auto res_wrapper = std::make_unique<SymbologyResolutionWrapper>(std::move(resolution));
         return reinterpret_cast<DbentoSymbologyResolutionHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::SymbologyResolution, res_wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::SymbologyResolution, std::move(res_wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -651,7 +686,7 @@ DATABENTO_API DbentoUnitPricesHandle dbento_historical_list_unit_prices(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -662,10 +697,10 @@ DATABENTO_API DbentoUnitPricesHandle dbento_historical_list_unit_prices(
             return nullptr;
         }
 
-        auto prices = wrapper->client->MetadataListUnitPrices(dataset);
-        auto* prices_wrapper = new UnitPricesWrapper(std::move(prices));
+        auto prices = wrapper->pool->Acquire()->MetadataListUnitPrices(dataset);
+        auto prices_wrapper = std::make_unique<UnitPricesWrapper>(std::move(prices));
         return reinterpret_cast<DbentoUnitPricesHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::UnitPrices, prices_wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::UnitPrices, std::move(prices_wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -767,25 +802,6 @@ DATABENTO_API void dbento_unit_prices_destroy(DbentoUnitPricesHandle handle)
     }
 }
 
-// ============================================================================
-// Helper for allocating strings that can be freed with dbento_free_string
-// ============================================================================
-
-static char* AllocateString(const std::string& str) {
-    // Validate size to prevent overflow
-    if (str.size() > SIZE_MAX - 1) {
-        return nullptr;  // String too large
-    }
-
-    char* result = new char[str.size() + 1];
-
-    // Use memcpy instead of strcpy for safety
-    std::memcpy(result, str.c_str(), str.size());
-    result[str.size()] = '\0';
-
-    return result;
-}
-
 // ============================================================================
 // Metadata Listing API
 // ============================================================================
@@ -800,7 +816,7 @@ DATABENTO_API const char* dbento_metadata_list_datasets(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -810,7 +826,7 @@ DATABENTO_API const char* dbento_metadata_list_datasets(
         // Note: The databento-cpp MetadataListDatasets() method returns all datasets
         // The venue parameter is currently not supported by the underlying C++ API
         (void)venue;  // Suppress unused parameter warning
-        std::vector<std::string> datasets = wrapper->client->MetadataListDatasets();
+        std::vector<std::string> datasets = wrapper->pool->Acquire()->MetadataListDatasets();
 
         // Convert to JSON array
         json j = json::array();
@@ -836,14 +852,14 @@ DATABENTO_API const char* dbento_metadata_list_publishers(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
         }
 
         // Call databento-cpp method
-        auto publishers = wrapper->client->MetadataListPublishers();
+        auto publishers = wrapper->pool->Acquire()->MetadataListPublishers();
 
         // Convert to JSON array - match C# PublisherDetail properties (PascalCase)
         json j = json::array();
@@ -875,7 +891,7 @@ DATABENTO_API const char* dbento_metadata_list_schemas(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -887,7 +903,7 @@ DATABENTO_API const char* dbento_metadata_list_schemas(
         }
 
         // Call databento-cpp method
-        auto schemas = wrapper->client->MetadataListSchemas(dataset);
+        auto schemas = wrapper->pool->Acquire()->MetadataListSchemas(dataset);
 
         // Convert to JSON array of schema enum values (as strings)
         json j = json::array();
@@ -915,7 +931,7 @@ DATABENTO_API const char* dbento_metadata_list_fields(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -953,7 +969,7 @@ DATABENTO_API const char* dbento_metadata_list_fields(
         }
 
         // Call databento-cpp method
-        auto fields = wrapper->client->MetadataListFields(enc, parsed_schema);
+        auto fields = wrapper->pool->Acquire()->MetadataListFields(enc, parsed_schema);
 
         // Convert to JSON array - match C# FieldDetail properties
         json j = json::array();
@@ -984,7 +1000,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -993,7 +1009,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition(
         ValidateNonEmptyString("dataset", dataset);
 
         std::vector<db::DatasetConditionDetail> conditions =
-            wrapper->client->MetadataGetDatasetCondition(dataset);
+            wrapper->pool->Acquire()->MetadataGetDatasetCondition(dataset);
 
         // Convert to JSON - match C# DatasetConditionInfo properties
         json j = json::object();
@@ -1036,7 +1052,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition_with_date_range(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -1049,9 +1065,9 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition_with_date_range(
         // Call databento-cpp method with date range
         std::vector<db::DatasetConditionDetail> conditions;
         if (end_date && *end_date != '\0') {
-            conditions = wrapper->client->MetadataGetDatasetCondition(dataset, db::DateRange{start_date, end_date});
+            conditions = wrapper->pool->Acquire()->MetadataGetDatasetCondition(dataset, db::DateRange{start_date, end_date});
         } else {
-            conditions = wrapper->client->MetadataGetDatasetCondition(dataset, db::DateRange{start_date});
+            conditions = wrapper->pool->Acquire()->MetadataGetDatasetCondition(dataset, db::DateRange{start_date});
         }
 
         // Convert to JSON array - match C# DatasetConditionDetail properties
@@ -1094,7 +1110,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_range(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -1102,7 +1118,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_range(
 
         ValidateNonEmptyString("dataset", dataset);
 
-        db::DatasetRange range = wrapper->client->MetadataGetDatasetRange(dataset);
+        db::DatasetRange range = wrapper->pool->Acquire()->MetadataGetDatasetRange(dataset);
 
         // Convert to JSON - match C# DatasetRange properties
         // databento-cpp already provides ISO 8601 format, use as-is
@@ -1150,7 +1166,7 @@ DATABENTO_API uint64_t dbento_metadata_get_record_count(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return UINT64_MAX;
@@ -1179,7 +1195,7 @@ DATABENTO_API uint64_t dbento_metadata_get_record_count(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Get record count
-        uint64_t count = wrapper->client->MetadataGetRecordCount(
+        uint64_t count = wrapper->pool->Acquire()->MetadataGetRecordCount(
             dataset, datetime_range, symbol_vec, schema_enum);
 
         return count;
@@ -1205,7 +1221,7 @@ DATABENTO_API uint64_t dbento_metadata_get_billable_size(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return UINT64_MAX;
@@ -1234,7 +1250,7 @@ DATABENTO_API uint64_t dbento_metadata_get_billable_size(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Get billable size
-        uint64_t size = wrapper->client->MetadataGetBillableSize(
+        uint64_t size = wrapper->pool->Acquire()->MetadataGetBillableSize(
             dataset, datetime_range, symbol_vec, schema_enum);
 
         return size;
@@ -1260,7 +1276,7 @@ DATABENTO_API const char* dbento_metadata_get_cost(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -1289,7 +1305,7 @@ DATABENTO_API const char* dbento_metadata_get_cost(
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
         // Get cost
-        double cost = wrapper->client->MetadataGetCost(
+        double cost = wrapper->pool->Acquire()->MetadataGetCost(
             dataset, datetime_range, symbol_vec, schema_enum);
 
         // Return cost as string
@@ -1317,7 +1333,7 @@ DATABENTO_API const char* dbento_metadata_get_billing_info(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
             handle, databento_native::HandleType::HistoricalClient, &validation_error);
-        if (!wrapper || !wrapper->client) {
+        if (!wrapper || !wrapper->pool) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
@@ -1345,12 +1361,13 @@ DATABENTO_API const char* dbento_metadata_get_billing_info(
         auto end_unix = NsToUnixNanos(end_time_ns);
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
-        // Get all billing info in one go
-        uint64_t record_count = wrapper->client->MetadataGetRecordCount(
+        // Get all billing info in one go (one lease reuses the same connection)
+        auto client = wrapper->pool->Acquire();
+        uint64_t record_count = client->MetadataGetRecordCount(
             dataset, datetime_range, symbol_vec, schema_enum);
-        uint64_t billable_size = wrapper->client->MetadataGetBillableSize(
+        uint64_t billable_size = client->MetadataGetBillableSize(
             dataset, datetime_range, symbol_vec, schema_enum);
-        double cost = wrapper->client->MetadataGetCost(
+        double cost = client->MetadataGetCost(
             dataset, datetime_range, symbol_vec, schema_enum);
 
         // Convert to JSON
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <databento/historical.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Pool of databento::Historical clients shared by one historical handle
+ *
+ * A single db::Historical owns one HTTP client and is not safe for concurrent
+ * calls, so each call leases a client for its duration. Idle clients keep their
+ * connection open for reuse; clients idle longer than the timeout are dropped
+ * the next time the pool is touched.
+ */
+class HistoricalClientPool {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Exclusive use of one pooled client; returns it to the pool on destruction
+     */
+    class Lease {
+    public:
+        Lease(HistoricalClientPool* pool, std::unique_ptr<databento::Historical> client)
+            : pool_(pool), client_(std::move(client)) {}
+
+        ~Lease() {
+            if (client_) {
+                pool_->Release(std::move(client_));
+            }
+        }
+
+        Lease(Lease&& other) noexcept = default;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+
+        databento::Historical* operator->() const { return client_.get(); }
+        databento::Historical& operator*() const { return *client_; }
+
+    private:
+        HistoricalClientPool* pool_;
+        std::unique_ptr<databento::Historical> client_;
+    };
+
+    /**
+     * @param api_key Databento API key
+     * @param max_size Maximum number of clients (concurrent calls beyond this wait)
+     * @param idle_timeout Idle time after which a client is closed (zero = never)
+     */
+    HistoricalClientPool(std::string api_key, size_t max_size, std::chrono::milliseconds idle_timeout)
+        : api_key_(std::move(api_key))
+        , max_size_(max_size)
+        , idle_timeout_(idle_timeout)
+    {
+        if (max_size_ == 0) {
+            throw std::invalid_argument("Pool size must be at least 1");
+        }
+        // Construct one client eagerly so an invalid key fails at creation time
+        idle_.push_back({CreateClient(), Clock::now()});
+        total_ = 1;
+    }
+
+    HistoricalClientPool(const HistoricalClientPool&) = delete;
+    HistoricalClientPool& operator=(const HistoricalClientPool&) = delete;
+
+    /**
+     * Lease a client, creating one if none are idle and the pool is not full
+     * Blocks while all max_size clients are in use
+     */
+    Lease Acquire() {
+        std::vector<std::unique_ptr<databento::Historical>> expired;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            CollectExpired(&expired);
+            if (!idle_.empty()) {
+                // Most recently used first: its connection is the most likely to still be open
+                auto client = std::move(idle_.back().client);
+                idle_.pop_back();
+                return Lease(this, std::move(client));
+            }
+            if (total_ < max_size_) {
+                ++total_;
+                lock.unlock();
+                try {
+                    return Lease(this, CreateClient());
+                }
+                catch (...) {
+                    lock.lock();
+                    --total_;
+                    cv_.notify_one();
+                    throw;
+                }
+            }
+            cv_.wait(lock);
+        }
+    }
+
+    /**
+     * Open connections up front so the first queries skip the TLS handshake
+     * @param count Number of clients to warm (clamped to the pool size)
+     */
+    void Prewarm(size_t count) {
+        count = std::min(count, max_size_);
+        std::vector<Lease> leases;
+        leases.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            leases.push_back(Acquire());
+        }
+        for (auto& lease : leases) {
+            // Cheapest authenticated request; establishes and validates the connection
+            lease->MetadataListDatasets();
+        }
+    }
+
+    size_t MaxSize() const { return max_size_; }
+
+private:
+    struct IdleClient {
+        std::unique_ptr<databento::Historical> client;
+        Clock::time_point idle_since;
+    };
+
+    std::unique_ptr<databento::Historical> CreateClient() const {
+        return std::make_unique<databento::Historical>(nullptr, api_key_, databento::HistoricalGateway::Bo1);
+    }
+
+    void Release(std::unique_ptr<databento::Historical> client) {
+        std::vector<std::unique_ptr<databento::Historical>> expired;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            idle_.push_back({std::move(client), Clock::now()});
+            CollectExpired(&expired);
+        }
+        cv_.notify_one();
+        // Expired clients are destroyed here, outside the lock
+    }
+
+    // Moves idle clients past the timeout into `out`; caller holds mutex_
+    void CollectExpired(std::vector<std::unique_ptr<databento::Historical>>* out) {
+        if (idle_timeout_.count() <= 0) {
+            return;
+        }
+        auto cutoff = Clock::now() - idle_timeout_;
+        size_t kept = 0;
+        for (auto& entry : idle_) {
+            if (entry.idle_since < cutoff) {
+                out->push_back(std::move(entry.client));
+                --total_;
+            } else {
+                idle_[kept++] = std::move(entry);
+            }
+        }
+        idle_.resize(kept);
+    }
+
+    std::string api_key_;
+    size_t max_size_;
+    std::chrono::milliseconds idle_timeout_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<IdleClient> idle_;  // Ordered by idle_since, oldest first
+    size_t total_ = 0;
+};
+
+}  // namespace databento_native
+
+// ============================================================================
+// Historical Client Wrapper (shared by historical and batch APIs)
+// ============================================================================
+
+struct HistoricalClientWrapper {
+    std::unique_ptr<databento_native::HistoricalClientPool> pool;
+    std::string api_key;
+
+    explicit HistoricalClientWrapper(const std::string& key,
+                                     size_t pool_size = 1,
+                                     std::chrono::milliseconds idle_timeout = std::chrono::milliseconds{0})
+        : api_key(key) {
+        pool = std::make_unique<databento_native::HistoricalClientPool>(key, pool_size, idle_timeout);
+    }
+};
@@ -1,6 +1,7 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
+#include "text_encoder.hpp"
 #include <databento/live_threaded.hpp>
 #include <databento/live.hpp>
 #include <databento/record.hpp>
@@ -38,6 +39,7 @@ struct LiveClientWrapper {
     bool send_ts_out = false;
     db::VersionUpgradePolicy upgrade_policy = db::VersionUpgradePolicy::UpgradeToV3;
     int heartbeat_interval_secs = 30;
+    std::unique_ptr<databento_native::TextFileSink> text_sink;  // Guarded by callback_mutex
 
     explicit LiveClientWrapper(const std::string& key)
         : api_key(key) {}
@@ -87,6 +89,19 @@ struct LiveClientWrapper {
             return db::KeepGoing::Stop;
         }
 
+        if (text_sink) {
+            try {
+                text_sink->Write(record);
+            }
+            catch (const std::exception& ex) {
+                // Stop writing text but keep the stream going
+                text_sink.reset();
+                if (error_callback) {
+                    error_callback(ex.what(), -997, user_data);
+                }
+            }
+        }
+
         try {
             if (record_callback) {
                 // Get the actual RecordHeader pointer (not the Record wrapper)
@@ -148,9 +163,9 @@ DATABENTO_API DbentoLiveClientHandle dbento_live_create(
             return nullptr;
         }
 
-        auto* wrapper = new LiveClientWrapper(api_key);
+        auto wrapper = std::make_unique<LiveClientWrapper>(api_key);
         return reinterpret_cast<DbentoLiveClientHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::LiveClient, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::LiveClient, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -271,6 +286,11 @@ DATABENTO_API void dbento_live_stop(DbentoLiveClientHandle handle)
             // Atomic store for thread-safe stop
             wrapper->is_running.store(false, std::memory_order_release);
             // The callback will return KeepGoing::Stop on next iteration
+
+            std::lock_guard<std::mutex> lock(wrapper->callback_mutex);
+            if (wrapper->text_sink) {
+                wrapper->text_sink->Flush();
+            }
         }
     }
     catch (...) {
@@ -336,7 +356,7 @@ DATABENTO_API DbentoLiveClientHandle dbento_live_create_ex(
             ? db::VersionUpgradePolicy::AsIs
             : db::VersionUpgradePolicy::UpgradeToV3;
 
-        auto* wrapper = new LiveClientWrapper(
+        auto wrapper = std::make_unique<LiveClientWrapper>(
             api_key,
             ds,
             send_ts_out != 0,
@@ -350,7 +370,7 @@ DATABENTO_API DbentoLiveClientHandle dbento_live_create_ex(
         }
 
         return reinterpret_cast<DbentoLiveClientHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::LiveClient, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::LiveClient, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -576,3 +596,42 @@ DATABENTO_API int dbento_live_get_connection_state(DbentoLiveClientHandle handle
         return 0;  // Disconnected on error
     }
 }
+
+DATABENTO_API int dbento_live_set_text_output(
+    DbentoLiveClientHandle handle,
+    const char* output_path,
+    const char* options_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<LiveClientWrapper>(
+            handle, databento_native::HandleType::LiveClient, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        std::unique_ptr<databento_native::TextFileSink> sink;
+        if (output_path && output_path[0] != '\0') {
+            if (wrapper->upgrade_policy != db::VersionUpgradePolicy::UpgradeToV3) {
+                SafeStrCopy(error_buffer, error_buffer_size,
+                    "Text output requires records upgraded to the current DBN version");
+                return -1;
+            }
+            sink = std::make_unique<databento_native::TextFileSink>(
+                output_path, databento_native::TextEncodeOptions::FromJson(options_json), wrapper->send_ts_out);
+        }
+
+        // Swap under the callback lock; the previous sink flushes as it is destroyed
+        std::lock_guard<std::mutex> lock(wrapper->callback_mutex);
+        wrapper->text_sink.swap(sink);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+namespace databento_native {
+
+/**
+ * Access pattern hint for a mapped file
+ */
+enum class MappedAccess : int {
+    Normal = 0,
+    Sequential = 1,
+    Random = 2,
+    WillNeed = 3
+};
+
+/**
+ * Read-only memory mapping of an entire file
+ * The mapping stays valid until the object is destroyed
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file_ = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Failed to open file for mapping: " + path.string());
+        }
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file_, &size)) {
+            Close();
+            throw std::runtime_error("Failed to get file size: " + path.string());
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+        if (size_ > 0) {
+            mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_) {
+                Close();
+                throw std::runtime_error("Failed to create file mapping: " + path.string());
+            }
+            data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (!data_) {
+                Close();
+                throw std::runtime_error("Failed to map file: " + path.string());
+            }
+        }
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            throw std::runtime_error("Failed to open file for mapping: " + path.string() + ": " + std::strerror(errno));
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            int err = errno;
+            Close();
+            throw std::runtime_error("Failed to stat file: " + path.string() + ": " + std::strerror(err));
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (addr == MAP_FAILED) {
+                int err = errno;
+                Close();
+                throw std::runtime_error("Failed to map file: " + path.string() + ": " + std::strerror(err));
+            }
+            data_ = static_cast<const uint8_t*>(addr);
+        }
+#endif
+    }
+
+    ~MappedFile() {
+        Close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+    /**
+     * Hint the kernel about the upcoming access pattern for a byte range
+     * No-op where the platform has no equivalent
+     */
+    void Advise(MappedAccess access, size_t offset = 0, size_t length = SIZE_MAX) const {
+        if (!data_ || offset >= size_) {
+            return;
+        }
+        length = std::min(length, size_ - offset);
+#ifdef _WIN32
+        if (access == MappedAccess::WillNeed) {
+            WIN32_MEMORY_RANGE_ENTRY range{const_cast<uint8_t*>(data_ + offset), length};
+            ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+        }
+#else
+        // madvise requires a page-aligned start address
+        static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t aligned = offset - (offset % page_size);
+        int advice = MADV_NORMAL;
+        switch (access) {
+            case MappedAccess::Sequential: advice = MADV_SEQUENTIAL; break;
+            case MappedAccess::Random: advice = MADV_RANDOM; break;
+            case MappedAccess::WillNeed: advice = MADV_WILLNEED; break;
+            default: break;
+        }
+        ::madvise(const_cast<uint8_t*>(data_ + aligned), length + (offset - aligned), advice);
+#endif
+    }
+
+private:
+    void Close() {
+#ifdef _WIN32
+        if (data_) {
+            ::UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            ::CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = -1;
+#endif
+        data_ = nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+}  // namespace databento_native
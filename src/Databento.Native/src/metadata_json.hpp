@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <databento/dbn.hpp>
+#include <databento/enums.hpp>
+#include <databento/datetime.hpp>
+#include <nlohmann/json.hpp>
+#include <date/date.h>
+
+namespace databento_native {
+
+/**
+ * Convert DBN metadata to the JSON shape consumed by the managed DbnMetadata model
+ * Shared by every wrapper that hands metadata across the ABI
+ * @param metadata Decoded DBN metadata
+ * @return JSON object describing the metadata
+ */
+inline nlohmann::json MetadataToJson(const databento::Metadata& metadata) {
+    nlohmann::json j;
+    j["version"] = metadata.version;
+    j["dataset"] = metadata.dataset;
+
+    if (metadata.schema.has_value()) {
+        j["schema"] = static_cast<int>(metadata.schema.value());
+    } else {
+        j["schema"] = nullptr;
+    }
+
+    // Convert UnixNanos to int64 nanoseconds
+    j["start"] = static_cast<int64_t>(metadata.start.time_since_epoch().count());
+    j["end"] = static_cast<int64_t>(metadata.end.time_since_epoch().count());
+    j["limit"] = metadata.limit;
+
+    if (metadata.stype_in.has_value()) {
+        j["stype_in"] = static_cast<int>(metadata.stype_in.value());
+    } else {
+        j["stype_in"] = nullptr;
+    }
+
+    j["stype_out"] = static_cast<int>(metadata.stype_out);
+    j["ts_out"] = metadata.ts_out;
+    j["symbol_cstr_len"] = metadata.symbol_cstr_len;
+    j["symbols"] = metadata.symbols;
+    j["partial"] = metadata.partial;
+    j["not_found"] = metadata.not_found;
+
+    // Convert mappings
+    nlohmann::json mappings_array = nlohmann::json::array();
+    for (const auto& mapping : metadata.mappings) {
+        nlohmann::json mapping_obj;
+        mapping_obj["raw_symbol"] = mapping.raw_symbol;
+
+        nlohmann::json intervals_array = nlohmann::json::array();
+        for (const auto& interval : mapping.intervals) {
+            nlohmann::json interval_obj;
+            // Convert date::year_month_day to string
+            std::ostringstream oss_start, oss_end;
+            oss_start << interval.start_date;
+            oss_end << interval.end_date;
+            interval_obj["start_date"] = oss_start.str();
+            interval_obj["end_date"] = oss_end.str();
+            interval_obj["symbol"] = interval.symbol;
+            intervals_array.push_back(interval_obj);
+        }
+
+        mapping_obj["intervals"] = intervals_array;
+        mappings_array.push_back(mapping_obj);
+    }
+
+    j["mappings"] = mappings_array;
+    return j;
+}
+
+}  // namespace databento_native
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "symbol_table.hpp"
+#include <databento/constants.hpp>
+#include <databento/enums.hpp>
+#include <databento/record.hpp>
+#include <databento/symbol_map.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace databento_native {
+
+// DBN version 1 SymbolMappingMsg, which predates the current layout
+constexpr size_t kSymbolMappingV1Size = 80;
+constexpr size_t kSymbolMappingV1OutSymbolOffset = 38;
+constexpr size_t kSymbolMappingV1SymbolLength = 22;
+constexpr size_t kSymbolMappingV1EndTsOffset = 72;
+
+/**
+ * Point-in-time instrument_id -> symbol map over interned symbols
+ *
+ * Entries hold a symbol ID from an InternedSymbolTable rather than a string, so
+ * instruments sharing a symbol share its storage and callers can cache the string
+ * per ID. Each entry remembers when its mapping expires (the end of a
+ * SymbolMappingMsg interval, or an InstrumentDefMsg expiration); EvictExpired drops
+ * such entries and frees symbols no longer referenced, which bounds memory in long
+ * sessions over rolling chains. A reverse index from symbol ID to instruments is
+ * kept in step with every update. Not thread-safe.
+ */
+class InternedPitSymbolMap {
+public:
+    struct Entry {
+        uint32_t symbol_id;
+        uint64_t expires;  // Nanoseconds since the epoch; kUndefTimestamp = never
+    };
+
+    InternedPitSymbolMap() = default;
+
+    // Copy the mappings of a databento PitSymbolMap, which don't expire
+    explicit InternedPitSymbolMap(const databento::PitSymbolMap& source) {
+        map_.reserve(source.Map().size());
+        for (const auto& [instrument_id, symbol] : source.Map()) {
+            Insert(instrument_id, symbol, databento::kUndefTimestamp);
+        }
+    }
+
+    InternedPitSymbolMap(const InternedPitSymbolMap&) = delete;
+    InternedPitSymbolMap& operator=(const InternedPitSymbolMap&) = delete;
+
+    void Reserve(size_t count) { map_.reserve(count); }
+
+    void Insert(uint32_t instrument_id, std::string_view symbol, uint64_t expires) {
+        uint32_t symbol_id = symbols_.Acquire(symbol);
+        auto [it, inserted] = map_.try_emplace(instrument_id, Entry{symbol_id, expires});
+        if (!inserted) {
+            Unlink(it->second.symbol_id, instrument_id);
+            symbols_.Release(it->second.symbol_id);
+            it->second = Entry{symbol_id, expires};
+        }
+        reverse_[symbol_id].push_back(instrument_id);
+        next_expiry_ = std::min(next_expiry_, expires);
+    }
+
+    /**
+     * Update the map from a SymbolMappingMsg or InstrumentDefMsg; other records are ignored
+     * Symbol mappings of DBN version 1 and later are understood; instrument
+     * definitions must be in the current version.
+     * @return Whether the record updated the map
+     */
+    bool OnRecord(const uint8_t* bytes, size_t length) {
+        if (length < sizeof(databento::RecordHeader)) {
+            return false;
+        }
+        const auto& header = *reinterpret_cast<const databento::RecordHeader*>(bytes);
+        if (header.rtype == databento::RType::SymbolMapping) {
+            if (length >= sizeof(databento::SymbolMappingMsg)) {
+                const auto& msg = *reinterpret_cast<const databento::SymbolMappingMsg*>(bytes);
+                Insert(header.instrument_id,
+                       CStrView(msg.stype_out_symbol.data(), msg.stype_out_symbol.size()),
+                       static_cast<uint64_t>(msg.end_ts.time_since_epoch().count()));
+                return true;
+            }
+            if (length >= kSymbolMappingV1Size) {
+                uint64_t end_ts;
+                std::memcpy(&end_ts, bytes + kSymbolMappingV1EndTsOffset, sizeof(end_ts));
+                Insert(header.instrument_id,
+                       CStrView(reinterpret_cast<const char*>(bytes + kSymbolMappingV1OutSymbolOffset),
+                                kSymbolMappingV1SymbolLength),
+                       end_ts);
+                return true;
+            }
+            return false;
+        }
+        if (header.rtype == databento::RType::InstrumentDef && length == sizeof(databento::InstrumentDefMsg)) {
+            const auto& msg = *reinterpret_cast<const databento::InstrumentDefMsg*>(bytes);
+            Insert(header.instrument_id, CStrView(msg.raw_symbol.data(), msg.raw_symbol.size()),
+                   static_cast<uint64_t>(msg.expiration.time_since_epoch().count()));
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Update the map from records laid out back to back, each as long as its header says
+     * Records other than symbol mappings and instrument definitions are skipped on their
+     * rtype alone. If the buffer is malformed, the records before the bad one have
+     * already been applied.
+     * @return Number of records that updated the map
+     * @throws std::invalid_argument if a record length is invalid or overruns the buffer
+     */
+    size_t OnRecords(const uint8_t* bytes, size_t length) {
+        size_t updated = 0;
+        size_t pos = 0;
+        while (pos < length) {
+            if (length - pos < sizeof(databento::RecordHeader)) {
+                throw std::invalid_argument("Buffer ends inside the record at offset " + std::to_string(pos));
+            }
+            const auto& header = *reinterpret_cast<const databento::RecordHeader*>(bytes + pos);
+            size_t record_length = static_cast<size_t>(header.length) * databento::RecordHeader::kLengthMultiplier;
+            if (record_length < sizeof(databento::RecordHeader) || record_length > length - pos) {
+                throw std::invalid_argument("Record at offset " + std::to_string(pos) + " has invalid length " +
+                                            std::to_string(record_length));
+            }
+            if (header.rtype == databento::RType::SymbolMapping || header.rtype == databento::RType::InstrumentDef) {
+                updated += OnRecord(bytes + pos, record_length);
+            }
+            pos += record_length;
+        }
+        return updated;
+    }
+
+    /**
+     * Drop every mapping that has expired by `now`, freeing unreferenced symbols
+     * @return Number of instruments evicted
+     */
+    size_t EvictExpired(uint64_t now) {
+        if (now < next_expiry_) {
+            return 0;
+        }
+        size_t evicted = 0;
+        uint64_t next_expiry = databento::kUndefTimestamp;
+        for (auto it = map_.begin(); it != map_.end();) {
+            if (it->second.expires <= now) {
+                Unlink(it->second.symbol_id, it->first);
+                symbols_.Release(it->second.symbol_id);
+                it = map_.erase(it);
+                ++evicted;
+            } else {
+                next_expiry = std::min(next_expiry, it->second.expires);
+                ++it;
+            }
+        }
+        next_expiry_ = next_expiry;
+        return evicted;
+    }
+
+    const Entry* Find(uint32_t instrument_id) const {
+        auto it = map_.find(instrument_id);
+        return it == map_.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * Instrument currently mapped to `symbol`
+     * If several instruments map to it, the most recently mapped one is returned.
+     * @return false if no instrument maps to the symbol
+     */
+    bool FindInstrument(std::string_view symbol, uint32_t* instrument_id) const {
+        uint32_t symbol_id;
+        if (!symbols_.FindId(symbol, &symbol_id)) {
+            return false;
+        }
+        auto it = reverse_.find(symbol_id);
+        if (it == reverse_.end() || it->second.empty()) {
+            return false;
+        }
+        *instrument_id = it->second.back();
+        return true;
+    }
+
+    // Symbol for an ID, or nullptr once it has been freed
+    const std::string* Symbol(uint32_t symbol_id) const { return symbols_.Find(symbol_id); }
+
+    const std::unordered_map<uint32_t, Entry>& Map() const { return map_; }
+    const InternedSymbolTable& Symbols() const { return symbols_; }
+    size_t Size() const { return map_.size(); }
+    bool IsEmpty() const { return map_.empty(); }
+
+private:
+    void Unlink(uint32_t symbol_id, uint32_t instrument_id) {
+        auto it = reverse_.find(symbol_id);
+        if (it == reverse_.end()) {
+            return;
+        }
+        auto& instruments = it->second;
+        instruments.erase(std::remove(instruments.begin(), instruments.end(), instrument_id), instruments.end());
+        if (instruments.empty()) {
+            reverse_.erase(it);
+        }
+    }
+
+    // Fixed-width, NUL-padded record field as a string
+    static std::string_view CStrView(const char* data, size_t max_length) {
+        const void* nul = std::memchr(data, '\0', max_length);
+        return {data, nul ? static_cast<size_t>(static_cast<const char*>(nul) - data) : max_length};
+    }
+
+    std::unordered_map<uint32_t, Entry> map_;
+    InternedSymbolTable symbols_;
+    // Symbol ID -> instruments mapped to it, most recently mapped last
+    std::unordered_map<uint32_t, std::vector<uint32_t>> reverse_;
+    uint64_t next_expiry_ = databento::kUndefTimestamp;  // Earliest expiry in map_
+};
+
+}  // namespace databento_native
@@ -0,0 +1,525 @@
+#pragma once
+
+#include <databento/ireadable.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #define DATABENTO_NATIVE_HAS_IO_URING 1
+        #include <linux/io_uring.h>
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <sys/syscall.h>
+        #include <sys/uio.h>
+        #include <unistd.h>
+        #include <cerrno>
+    #endif
+#endif
+
+namespace databento_native {
+
+constexpr size_t kDefaultPrefetchBufferSize = 4 * 1024 * 1024;
+constexpr size_t kDefaultPrefetchQueueDepth = 4;
+constexpr size_t kMaxPrefetchQueueDepth = 256;
+
+/**
+ * How a reader gets bytes from disk
+ */
+enum class IoBackend : int {
+    Sync = 0,             // Reads on the consumer's thread
+    ReadAheadThread = 1,  // A background thread fills buffers ahead of the consumer
+    IoUring = 2           // Reads are queued to the kernel through io_uring (Linux)
+};
+
+/**
+ * Buffering for a prefetching reader (zeros select the defaults)
+ */
+struct PrefetchOptions {
+    size_t buffer_size = 0;
+    size_t queue_depth = 0;
+};
+
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+
+/**
+ * Minimal io_uring instance driven through raw system calls
+ *
+ * Only what sequential prefetching needs: queue readv requests, submit them,
+ * and reap completions. Not thread-safe; owned by a single consumer.
+ */
+class IoUring {
+public:
+    explicit IoUring(unsigned entries) {
+        io_uring_params params{};
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = Map(sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ : Map(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(Map(sqes_size_, IORING_OFF_SQES));
+
+        auto* sq = static_cast<uint8_t*>(sq_ring_);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq = static_cast<uint8_t*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    ~IoUring() {
+        if (sqes_) {
+            ::munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ && cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_) {
+            ::munmap(sq_ring_, sq_ring_size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /**
+     * Queue a read; it is handed to the kernel by the next Submit or Wait
+     * The iovec must stay valid until the request completes.
+     */
+    void QueueRead(int file_fd, const iovec* iov, uint64_t offset, uint64_t user_data) {
+        unsigned tail = *sq_tail_;  // Only this thread writes the tail
+        unsigned index = tail & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        // READV predates READ (5.1 vs 5.6), so it works on every io_uring kernel
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = file_fd;
+        sqe->addr = reinterpret_cast<uint64_t>(iov);
+        sqe->len = 1;
+        sqe->off = offset;
+        sqe->user_data = user_data;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ++to_submit_;
+    }
+
+    void Submit() {
+        if (to_submit_ > 0) {
+            Enter(0, 0);
+        }
+    }
+
+    /**
+     * Submit queued reads and block until one completes
+     * @param result Set to the completion's result (bytes read or -errno)
+     * @return user_data of the completed request
+     */
+    uint64_t Wait(int* result) {
+        while (true) {
+            unsigned head = *cq_head_;
+            if (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+                const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+                uint64_t user_data = cqe.user_data;
+                *result = cqe.res;
+                __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+                return user_data;
+            }
+            Enter(1, IORING_ENTER_GETEVENTS);
+        }
+    }
+
+private:
+    void* Map(size_t size, off_t offset) {
+        void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        if (ptr == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "io_uring mmap");
+        }
+        return ptr;
+    }
+
+    void Enter(unsigned min_complete, unsigned flags) {
+        while (true) {
+            long submitted = ::syscall(__NR_io_uring_enter, fd_, to_submit_, min_complete, flags, nullptr, 0);
+            if (submitted >= 0) {
+                to_submit_ -= static_cast<unsigned>(submitted);
+                return;
+            }
+            if (errno != EINTR && errno != EAGAIN) {
+                throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+            }
+        }
+    }
+
+    int fd_ = -1;
+    void* sq_ring_ = nullptr;
+    void* cq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned* sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    unsigned to_submit_ = 0;
+};
+
+#endif  // DATABENTO_NATIVE_HAS_IO_URING
+
+/**
+ * IReadable over a file that keeps several large reads in flight
+ *
+ * The file is read front to back into `queue_depth` buffers of `buffer_size`
+ * bytes. While the consumer works through one buffer, reads for the following
+ * ones are already queued, so decoding overlaps I/O and a cold page cache no
+ * longer stalls the consumer on every read. On Linux the reads go through
+ * io_uring when the kernel allows it; otherwise a read-ahead thread fills the
+ * buffers.
+ */
+class PrefetchFileReadable : public databento::IReadable {
+public:
+    PrefetchFileReadable(const std::filesystem::path& path, size_t buffer_size, size_t queue_depth,
+                         IoBackend preferred = IoBackend::IoUring)
+        : buffer_size_(buffer_size == 0 ? kDefaultPrefetchBufferSize : buffer_size)
+        , slots_(std::clamp<size_t>(queue_depth == 0 ? kDefaultPrefetchQueueDepth : queue_depth,
+                                    1, kMaxPrefetchQueueDepth))
+    {
+        for (auto& slot : slots_) {
+            slot.data.reset(new std::byte[buffer_size_]);
+        }
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+        if (preferred == IoBackend::IoUring && StartIoUring(path)) {
+            return;
+        }
+#endif
+        StartThread(path);
+    }
+
+    ~PrefetchFileReadable() override {
+        if (thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            thread_.join();
+        }
+        if (file_) {
+            std::fclose(file_);
+        }
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+        // Buffers must outlive reads the kernel still owns
+        if (ring_) {
+            try {
+                while (in_flight_ > 0) {
+                    int result;
+                    ring_->Wait(&result);
+                    --in_flight_;
+                }
+            }
+            catch (...) {
+                // Reads may still land after the ring is gone; leak their buffers
+                // rather than free memory the kernel can write to
+                for (auto& slot : slots_) {
+                    (void)slot.data.release();
+                }
+            }
+            ring_.reset();
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    PrefetchFileReadable(const PrefetchFileReadable&) = delete;
+    PrefetchFileReadable& operator=(const PrefetchFileReadable&) = delete;
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t read = 0;
+        while (read < length) {
+            size_t n = ReadSome(buffer + read, length - read);
+            if (n == 0) {
+                throw std::runtime_error("Unexpected end of file");
+            }
+            read += n;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        while (current_ == nullptr || position_ == current_->length) {
+            if (current_) {
+                Release();
+            }
+            current_ = Acquire();
+            position_ = 0;
+            if (!current_) {
+                return 0;
+            }
+        }
+        size_t n = std::min(max_length, current_->length - position_);
+        std::memcpy(buffer, current_->data.get() + position_, n);
+        position_ += n;
+        return n;
+    }
+
+    IoBackend Backend() const { return backend_; }
+
+private:
+    struct Slot {
+        std::unique_ptr<std::byte[]> data;
+        size_t length = 0;    // Valid bytes
+        uint64_t offset = 0;  // File offset of data[0]
+        size_t expected = 0;  // Bytes requested (io_uring)
+        bool ready = false;
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+        iovec iov{};
+#endif
+    };
+
+    /**
+     * Next filled buffer in file order, or nullptr at end of file
+     */
+    Slot* Acquire() {
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+        if (ring_) {
+            return AcquireUring();
+        }
+#endif
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return produced_ > consumed_ || eof_ || error_; });
+        if (produced_ > consumed_) {
+            return &slots_[consumed_ % slots_.size()];
+        }
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return nullptr;
+    }
+
+    // Hands the current buffer back for the next read
+    void Release() {
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+        if (ring_) {
+            ReleaseUring();
+            current_ = nullptr;
+            return;
+        }
+#endif
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++consumed_;
+        }
+        cv_.notify_all();
+        current_ = nullptr;
+    }
+
+    // ------------------------------------------------------------------------
+    // Read-ahead thread backend (portable)
+    // ------------------------------------------------------------------------
+
+    void StartThread(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file_ = ::_wfopen(path.c_str(), L"rb");
+#else
+        file_ = std::fopen(path.c_str(), "rb");
+#endif
+        if (!file_) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+        // Reads are already large; stdio buffering would only add a copy
+        std::setvbuf(file_, nullptr, _IONBF, 0);
+        backend_ = IoBackend::ReadAheadThread;
+        thread_ = std::thread([this] { ReadAhead(); });
+    }
+
+    void ReadAhead() {
+        try {
+            while (true) {
+                Slot* slot;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this] { return stop_ || produced_ - consumed_ < slots_.size(); });
+                    if (stop_) {
+                        return;
+                    }
+                    slot = &slots_[produced_ % slots_.size()];
+                }
+                // The slot is free and only this thread touches it until it is published
+                size_t n = std::fread(slot->data.get(), 1, buffer_size_, file_);
+                if (n < buffer_size_ && std::ferror(file_)) {
+                    throw std::runtime_error("Failed to read file");
+                }
+                slot->length = n;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (n > 0) {
+                        ++produced_;
+                    }
+                    eof_ = n < buffer_size_;
+                }
+                cv_.notify_all();
+                if (n < buffer_size_) {
+                    return;
+                }
+            }
+        }
+        catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                error_ = std::current_exception();
+            }
+            cv_.notify_all();
+        }
+    }
+
+#ifdef DATABENTO_NATIVE_HAS_IO_URING
+    // ------------------------------------------------------------------------
+    // io_uring backend (Linux)
+    // ------------------------------------------------------------------------
+
+    // False when io_uring is unavailable (old kernel, seccomp, container policy)
+    bool StartIoUring(const std::filesystem::path& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat file: " + path.string());
+        }
+        try {
+            ring_ = std::make_unique<IoUring>(static_cast<unsigned>(slots_.size()));
+        }
+        catch (const std::system_error&) {
+            ::close(fd);
+            return false;
+        }
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        fd_ = fd;
+        file_size_ = static_cast<uint64_t>(st.st_size);
+        backend_ = IoBackend::IoUring;
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            QueueSlot(i);
+        }
+        ring_->Submit();
+        return true;
+    }
+
+    // Queues the read that fills slot `index` with the next unread part of the file
+    void QueueSlot(size_t index) {
+        Slot& slot = slots_[index];
+        slot.ready = false;
+        slot.length = 0;
+        if (next_offset_ >= file_size_) {
+            slot.expected = 0;
+            return;
+        }
+        slot.offset = next_offset_;
+        slot.expected = static_cast<size_t>(std::min<uint64_t>(buffer_size_, file_size_ - next_offset_));
+        next_offset_ += slot.expected;
+        QueueRemainder(index);
+    }
+
+    void QueueRemainder(size_t index) {
+        Slot& slot = slots_[index];
+        slot.iov.iov_base = slot.data.get() + slot.length;
+        slot.iov.iov_len = slot.expected - slot.length;
+        ring_->QueueRead(fd_, &slot.iov, slot.offset + slot.length, index);
+        ++in_flight_;
+    }
+
+    Slot* AcquireUring() {
+        size_t head = consumed_ % slots_.size();
+        Slot& slot = slots_[head];
+        if (slot.expected == 0) {
+            return nullptr;  // Nothing left to read
+        }
+        while (!slot.ready) {
+            int result;
+            auto index = static_cast<size_t>(ring_->Wait(&result));
+            --in_flight_;
+            if (result < 0) {
+                throw std::system_error(-result, std::generic_category(), "Failed to read file");
+            }
+            Slot& done = slots_[index];
+            done.length += static_cast<size_t>(result);
+            if (result == 0 || done.length == done.expected) {
+                // A zero-length read means the file shrank; hand out what arrived
+                done.ready = true;
+            } else {
+                QueueRemainder(index);  // Short read: ask for the rest
+            }
+        }
+        if (slot.length == 0) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    void ReleaseUring() {
+        size_t head = consumed_ % slots_.size();
+        ++consumed_;
+        QueueSlot(head);
+        ring_->Submit();
+    }
+
+    std::unique_ptr<IoUring> ring_;
+    int fd_ = -1;
+    uint64_t file_size_ = 0;
+    uint64_t next_offset_ = 0;
+    size_t in_flight_ = 0;
+#endif
+
+    size_t buffer_size_;
+    std::vector<Slot> slots_;
+    IoBackend backend_ = IoBackend::Sync;
+    Slot* current_ = nullptr;
+    size_t position_ = 0;
+
+    // Read-ahead thread state; produced_/consumed_ count buffers, so slot = count % depth
+    std::FILE* file_ = nullptr;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t produced_ = 0;
+    size_t consumed_ = 0;
+    bool eof_ = false;
+    bool stop_ = false;
+    std::exception_ptr error_;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,500 @@
+#pragma once
+
+#include <databento/datetime.hpp>
+#include <databento/record.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * How a record field's value is interpreted
+ */
+enum class FieldKind : uint8_t {
+    UInt = 0,
+    Int = 1,
+    Price = 2,      // Fixed-point with 9 decimals; kUndefPrice is empty/null
+    Timestamp = 3,  // Nanoseconds since the epoch; kUndefTimestamp is empty/null
+    Char = 4,       // Single character (c_char fields and char-backed enums)
+    CString = 5     // Null-padded fixed-size string
+};
+
+/**
+ * How the values of one column chunk are laid out before compression
+ */
+enum class ColumnEncoding : uint8_t {
+    Plain = 0,         // Fixed-width little-endian values
+    DeltaOfDelta = 1,  // Zigzag varints of the change between consecutive deltas (timestamps)
+    Delta = 2,         // Zigzag varints of the difference from the previous value (prices, IDs)
+    Varint = 3,        // Zigzag varints of the values (sizes, small signed offsets)
+    Dictionary = 4     // Sorted distinct values followed by bit-packed codes (enums, flags)
+};
+
+/**
+ * What filters and aggregations read a field as
+ */
+enum class FieldRole : uint8_t {
+    None = 0,
+    Price = 1,     // Traded or quoted price; close for bars
+    Size = 2,      // Quantity at the price; volume for bars
+    Side = 3,
+    Action = 4,
+    BidPrice = 5   // Top-of-book bid price; the ask price follows it
+};
+
+/**
+ * One field of a DBN record
+ */
+struct RecordField {
+    std::string name;
+    uint16_t offset = 0;
+    uint16_t width = 0;      // Integer width in bytes, or the capacity of a CString
+    FieldKind kind = FieldKind::UInt;
+    bool is_signed = false;  // Integer representation is signed (sign-extended when widened)
+    ColumnEncoding encoding = ColumnEncoding::Plain;
+    FieldRole role = FieldRole::None;
+    bool in_header = false;  // Part of the record header (nested under "hd" in JSON)
+};
+
+/**
+ * Fields of one record type, in output order
+ *
+ * This is the one description of DBN v3 record layouts; text encoding,
+ * columnar export, record filters and aggregation all derive from it.
+ */
+struct RecordLayout {
+    uint8_t rtype = 0;
+    std::string schema;      // Databento schema name, e.g. "mbo", "mbp-10"; empty for control records
+    size_t record_size = 0;  // Bytes of the DBN v3 record, excluding ts_out
+    bool columnar = false;   // Exported by columnar export
+    std::vector<RecordField> fields;
+};
+
+namespace detail {
+
+template <typename T>
+struct IsCharArray : std::false_type {};
+
+template <size_t N>
+struct IsCharArray<std::array<char, N>> : std::true_type {};
+
+template <typename T>
+struct IsDuration : std::false_type {};
+
+template <typename Rep, typename Period>
+struct IsDuration<std::chrono::duration<Rep, Period>> : std::true_type {
+    using rep = Rep;
+};
+
+template <typename T>
+constexpr FieldKind DefaultFieldKind() {
+    if constexpr (std::is_same_v<T, databento::UnixNanos>) {
+        return FieldKind::Timestamp;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return FieldKind::Char;
+    } else if constexpr (std::is_enum_v<T>) {
+        using U = std::underlying_type_t<T>;
+        if constexpr (std::is_same_v<U, char>) {
+            return FieldKind::Char;
+        } else {
+            return std::is_signed_v<U> ? FieldKind::Int : FieldKind::UInt;
+        }
+    } else if constexpr (IsCharArray<T>::value) {
+        return FieldKind::CString;
+    } else if constexpr (IsDuration<T>::value) {
+        return std::is_signed_v<typename IsDuration<T>::rep> ? FieldKind::Int : FieldKind::UInt;
+    } else if constexpr (std::is_integral_v<T>) {
+        return std::is_signed_v<T> ? FieldKind::Int : FieldKind::UInt;
+    } else {
+        // Bit sets such as FlagSet are written as their raw integer
+        return FieldKind::UInt;
+    }
+}
+
+template <typename T>
+constexpr bool IsSignedField() {
+    if constexpr (IsDuration<T>::value) {
+        return std::is_signed_v<typename IsDuration<T>::rep>;
+    } else {
+        return std::is_signed_v<T>;
+    }
+}
+
+/**
+ * Describe a field of type Field at `offset`
+ * Timestamps default to delta-of-delta and prices to delta column encoding.
+ */
+template <typename Field>
+RecordField MakeField(std::string name, size_t offset, std::optional<FieldKind> kind = std::nullopt,
+                      std::optional<ColumnEncoding> encoding = std::nullopt) {
+    static_assert(IsCharArray<Field>::value || sizeof(Field) == 1 || sizeof(Field) == 2 ||
+                  sizeof(Field) == 4 || sizeof(Field) == 8, "Fields must be 1, 2, 4 or 8 bytes wide");
+    FieldKind resolved = kind.value_or(DefaultFieldKind<Field>());
+    ColumnEncoding resolved_encoding = encoding.value_or(
+        resolved == FieldKind::Timestamp ? ColumnEncoding::DeltaOfDelta
+        : resolved == FieldKind::Price   ? ColumnEncoding::Delta
+                                         : ColumnEncoding::Plain);
+    return {std::move(name), static_cast<uint16_t>(offset), static_cast<uint16_t>(sizeof(Field)), resolved,
+            IsSignedField<Field>(), resolved_encoding, FieldRole::None, false};
+}
+
+inline std::vector<RecordLayout> BuildRecordLayouts() {
+    namespace db = databento;
+    constexpr auto kPx = FieldKind::Price;
+    constexpr auto kTs = FieldKind::Timestamp;
+    constexpr auto kDod = ColumnEncoding::DeltaOfDelta;
+    constexpr auto kDelta = ColumnEncoding::Delta;
+    constexpr auto kVarint = ColumnEncoding::Varint;
+    constexpr auto kDict = ColumnEncoding::Dictionary;
+#define DBN_FIELD(msg, field) MakeField<decltype(msg::field)>(#field, offsetof(msg, field))
+#define DBN_FIELD_AS(msg, field, kind) MakeField<decltype(msg::field)>(#field, offsetof(msg, field), kind)
+#define DBN_COLUMN(msg, field, encoding) \
+    MakeField<decltype(msg::field)>(#field, offsetof(msg, field), std::nullopt, encoding)
+
+    // ts_recv (when the record has one) leads, followed by the common header
+    auto header = [&](std::vector<RecordField>& fields) {
+        for (RecordField field : {MakeField<uint64_t>("ts_event", offsetof(db::RecordHeader, ts_event), kTs, kDod),
+                                  MakeField<uint8_t>("rtype", 1),
+                                  MakeField<uint16_t>("publisher_id", offsetof(db::RecordHeader, publisher_id),
+                                                      std::nullopt, kDict),
+                                  MakeField<uint32_t>("instrument_id", offsetof(db::RecordHeader, instrument_id),
+                                                      std::nullopt, kDelta)}) {
+            field.in_header = true;
+            fields.push_back(std::move(field));
+        }
+    };
+    auto levels = [&](std::vector<RecordField>& fields, size_t first, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            char suffix[4];
+            std::snprintf(suffix, sizeof(suffix), "_%02zu", i);
+            size_t base = first + i * sizeof(db::BidAskPair);
+            fields.push_back(MakeField<int64_t>(std::string("bid_px") + suffix, base + offsetof(db::BidAskPair, bid_px), kPx));
+            if (i == 0) {
+                fields.back().role = FieldRole::BidPrice;
+            }
+            fields.push_back(MakeField<int64_t>(std::string("ask_px") + suffix, base + offsetof(db::BidAskPair, ask_px), kPx));
+            fields.push_back(MakeField<uint32_t>(std::string("bid_sz") + suffix, base + offsetof(db::BidAskPair, bid_sz), std::nullopt, kVarint));
+            fields.push_back(MakeField<uint32_t>(std::string("ask_sz") + suffix, base + offsetof(db::BidAskPair, ask_sz), std::nullopt, kVarint));
+            fields.push_back(MakeField<uint32_t>(std::string("bid_ct") + suffix, base + offsetof(db::BidAskPair, bid_ct), std::nullopt, kVarint));
+            fields.push_back(MakeField<uint32_t>(std::string("ask_ct") + suffix, base + offsetof(db::BidAskPair, ask_ct), std::nullopt, kVarint));
+        }
+    };
+    auto consolidated_level = [&](std::vector<RecordField>& fields, size_t base) {
+        using Pair = db::ConsolidatedBidAskPair;
+        fields.push_back(MakeField<int64_t>("bid_px_00", base + offsetof(Pair, bid_px), kPx));
+        fields.back().role = FieldRole::BidPrice;
+        fields.push_back(MakeField<int64_t>("ask_px_00", base + offsetof(Pair, ask_px), kPx));
+        fields.push_back(MakeField<uint32_t>("bid_sz_00", base + offsetof(Pair, bid_sz), std::nullopt, kVarint));
+        fields.push_back(MakeField<uint32_t>("ask_sz_00", base + offsetof(Pair, ask_sz), std::nullopt, kVarint));
+        fields.push_back(MakeField<uint16_t>("bid_pb_00", base + offsetof(Pair, bid_pb), std::nullopt, kDict));
+        fields.push_back(MakeField<uint16_t>("ask_pb_00", base + offsetof(Pair, ask_pb), std::nullopt, kDict));
+    };
+    // Book-update fields shared by trades, MBP-1 and MBP-10
+    auto book_update = [&](std::vector<RecordField>& fields) {
+        fields.push_back(DBN_FIELD(db::TradeMsg, ts_recv));
+        header(fields);
+        fields.push_back(DBN_COLUMN(db::TradeMsg, action, kDict));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, side, kDict));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, depth, kDict));
+        fields.push_back(DBN_FIELD_AS(db::TradeMsg, price, kPx));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, size, kVarint));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, flags, kDict));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, ts_in_delta, kVarint));
+        fields.push_back(DBN_COLUMN(db::TradeMsg, sequence, kDelta));
+    };
+    // Mark the fields filters and aggregations read; nullptr where the record has none
+    auto roles = [](RecordLayout& l, const char* price, const char* size, const char* side, const char* action) {
+        for (auto [name, role] : {std::pair{price, FieldRole::Price}, std::pair{size, FieldRole::Size},
+                                  std::pair{side, FieldRole::Side}, std::pair{action, FieldRole::Action}}) {
+            if (!name) {
+                continue;
+            }
+            bool found = false;
+            for (auto& field : l.fields) {
+                if (field.name == name) {
+                    field.role = role;
+                    found = true;
+                }
+            }
+            if (!found) {
+                throw std::logic_error(std::string("Record layout has no field ") + name);
+            }
+        }
+    };
+
+    std::vector<RecordLayout> layouts;
+    {
+        RecordLayout l{db::RType::Mbo, "mbo", sizeof(db::MboMsg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::MboMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, action, kDict));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, side, kDict));
+        l.fields.push_back(DBN_FIELD_AS(db::MboMsg, price, kPx));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, size, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, channel_id, kDict));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, order_id, kDelta));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, flags, kDict));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, ts_in_delta, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::MboMsg, sequence, kDelta));
+        roles(l, "price", "size", "side", "action");
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Mbp0, "trades", sizeof(db::TradeMsg), true, {}};
+        book_update(l.fields);
+        roles(l, "price", "size", "side", "action");
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Mbp1, "mbp-1", sizeof(db::Mbp1Msg), true, {}};
+        book_update(l.fields);
+        levels(l.fields, offsetof(db::Mbp1Msg, levels), 1);
+        roles(l, "price", "size", "side", "action");
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Mbp10, "mbp-10", sizeof(db::Mbp10Msg), true, {}};
+        book_update(l.fields);
+        levels(l.fields, offsetof(db::Mbp10Msg, levels), 10);
+        roles(l, "price", "size", "side", "action");
+        layouts.push_back(std::move(l));
+    }
+    for (auto [rtype, name] : {std::pair<uint8_t, const char*>{db::RType::Bbo1S, "bbo-1s"}, {db::RType::Bbo1M, "bbo-1m"}}) {
+        RecordLayout l{rtype, name, sizeof(db::BboMsg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::BboMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_COLUMN(db::BboMsg, side, kDict));
+        l.fields.push_back(DBN_FIELD_AS(db::BboMsg, price, kPx));
+        l.fields.push_back(DBN_COLUMN(db::BboMsg, size, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::BboMsg, flags, kDict));
+        l.fields.push_back(DBN_COLUMN(db::BboMsg, sequence, kDelta));
+        levels(l.fields, offsetof(db::BboMsg, levels), 1);
+        roles(l, "price", "size", "side", nullptr);
+        layouts.push_back(std::move(l));
+    }
+    for (auto [rtype, name] : {std::pair<uint8_t, const char*>{db::RType::Cmbp1, "cmbp-1"}, {db::RType::Tcbbo, "tcbbo"}}) {
+        RecordLayout l{rtype, name, sizeof(db::Cmbp1Msg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::Cmbp1Msg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_COLUMN(db::Cmbp1Msg, action, kDict));
+        l.fields.push_back(DBN_COLUMN(db::Cmbp1Msg, side, kDict));
+        l.fields.push_back(DBN_FIELD_AS(db::Cmbp1Msg, price, kPx));
+        l.fields.push_back(DBN_COLUMN(db::Cmbp1Msg, size, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::Cmbp1Msg, flags, kDict));
+        l.fields.push_back(DBN_COLUMN(db::Cmbp1Msg, ts_in_delta, kVarint));
+        consolidated_level(l.fields, offsetof(db::Cmbp1Msg, levels));
+        roles(l, "price", "size", "side", "action");
+        layouts.push_back(std::move(l));
+    }
+    for (auto [rtype, name] : {std::pair<uint8_t, const char*>{db::RType::Cbbo1S, "cbbo-1s"}, {db::RType::Cbbo1M, "cbbo-1m"}}) {
+        RecordLayout l{rtype, name, sizeof(db::CbboMsg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::CbboMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_COLUMN(db::CbboMsg, side, kDict));
+        l.fields.push_back(DBN_FIELD_AS(db::CbboMsg, price, kPx));
+        l.fields.push_back(DBN_COLUMN(db::CbboMsg, size, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::CbboMsg, flags, kDict));
+        consolidated_level(l.fields, offsetof(db::CbboMsg, levels));
+        roles(l, "price", "size", "side", nullptr);
+        layouts.push_back(std::move(l));
+    }
+    for (auto [rtype, name] : {std::pair<uint8_t, const char*>{db::RType::Ohlcv1S, "ohlcv-1s"},
+                               {db::RType::Ohlcv1M, "ohlcv-1m"}, {db::RType::Ohlcv1H, "ohlcv-1h"},
+                               {db::RType::Ohlcv1D, "ohlcv-1d"}, {db::RType::OhlcvEod, "ohlcv-eod"}}) {
+        RecordLayout l{rtype, name, sizeof(db::OhlcvMsg), true, {}};
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD_AS(db::OhlcvMsg, open, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::OhlcvMsg, high, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::OhlcvMsg, low, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::OhlcvMsg, close, kPx));
+        l.fields.push_back(DBN_COLUMN(db::OhlcvMsg, volume, kVarint));
+        roles(l, "close", "volume", nullptr, nullptr);
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Status, "status", sizeof(db::StatusMsg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::StatusMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, action, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, reason, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, trading_event, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, is_trading, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, is_quoting, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatusMsg, is_short_sell_restricted, kDict));
+        layouts.push_back(std::move(l));
+    }
+    {
+        using Def = db::InstrumentDefMsg;
+        RecordLayout l{db::RType::InstrumentDef, "definition", sizeof(Def), false, {}};
+        l.fields.push_back(DBN_FIELD(Def, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD(Def, raw_symbol));
+        l.fields.push_back(DBN_FIELD(Def, security_update_action));
+        l.fields.push_back(DBN_FIELD(Def, instrument_class));
+        l.fields.push_back(DBN_FIELD_AS(Def, min_price_increment, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, display_factor, kPx));
+        l.fields.push_back(DBN_FIELD(Def, expiration));
+        l.fields.push_back(DBN_FIELD(Def, activation));
+        l.fields.push_back(DBN_FIELD_AS(Def, high_limit_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, low_limit_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, max_price_variation, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, unit_of_measure_qty, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, min_price_increment_amount, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, price_ratio, kPx));
+        l.fields.push_back(DBN_FIELD(Def, inst_attrib_value));
+        l.fields.push_back(DBN_FIELD(Def, underlying_id));
+        l.fields.push_back(DBN_FIELD(Def, raw_instrument_id));
+        l.fields.push_back(DBN_FIELD(Def, market_depth_implied));
+        l.fields.push_back(DBN_FIELD(Def, market_depth));
+        l.fields.push_back(DBN_FIELD(Def, market_segment_id));
+        l.fields.push_back(DBN_FIELD(Def, max_trade_vol));
+        l.fields.push_back(DBN_FIELD(Def, min_lot_size));
+        l.fields.push_back(DBN_FIELD(Def, min_lot_size_block));
+        l.fields.push_back(DBN_FIELD(Def, min_lot_size_round_lot));
+        l.fields.push_back(DBN_FIELD(Def, min_trade_vol));
+        l.fields.push_back(DBN_FIELD(Def, contract_multiplier));
+        l.fields.push_back(DBN_FIELD(Def, decay_quantity));
+        l.fields.push_back(DBN_FIELD(Def, original_contract_size));
+        l.fields.push_back(DBN_FIELD(Def, appl_id));
+        l.fields.push_back(DBN_FIELD(Def, maturity_year));
+        l.fields.push_back(DBN_FIELD(Def, decay_start_date));
+        l.fields.push_back(DBN_FIELD(Def, channel_id));
+        l.fields.push_back(DBN_FIELD(Def, currency));
+        l.fields.push_back(DBN_FIELD(Def, settl_currency));
+        l.fields.push_back(DBN_FIELD(Def, secsubtype));
+        l.fields.push_back(DBN_FIELD(Def, group));
+        l.fields.push_back(DBN_FIELD(Def, exchange));
+        l.fields.push_back(DBN_FIELD(Def, asset));
+        l.fields.push_back(DBN_FIELD(Def, cfi));
+        l.fields.push_back(DBN_FIELD(Def, security_type));
+        l.fields.push_back(DBN_FIELD(Def, unit_of_measure));
+        l.fields.push_back(DBN_FIELD(Def, underlying));
+        l.fields.push_back(DBN_FIELD(Def, strike_price_currency));
+        l.fields.push_back(DBN_FIELD_AS(Def, strike_price, kPx));
+        l.fields.push_back(DBN_FIELD(Def, match_algorithm));
+        l.fields.push_back(DBN_FIELD(Def, main_fraction));
+        l.fields.push_back(DBN_FIELD(Def, price_display_format));
+        l.fields.push_back(DBN_FIELD(Def, sub_fraction));
+        l.fields.push_back(DBN_FIELD(Def, underlying_product));
+        l.fields.push_back(DBN_FIELD(Def, maturity_month));
+        l.fields.push_back(DBN_FIELD(Def, maturity_day));
+        l.fields.push_back(DBN_FIELD(Def, maturity_week));
+        l.fields.push_back(DBN_FIELD(Def, user_defined_instrument));
+        l.fields.push_back(DBN_FIELD(Def, contract_multiplier_unit));
+        l.fields.push_back(DBN_FIELD(Def, flow_schedule_type));
+        l.fields.push_back(DBN_FIELD(Def, tick_rule));
+        l.fields.push_back(DBN_FIELD(Def, leg_count));
+        l.fields.push_back(DBN_FIELD(Def, leg_index));
+        l.fields.push_back(DBN_FIELD(Def, leg_instrument_id));
+        l.fields.push_back(DBN_FIELD(Def, leg_raw_symbol));
+        l.fields.push_back(DBN_FIELD(Def, leg_side));
+        l.fields.push_back(DBN_FIELD(Def, leg_underlying_id));
+        l.fields.push_back(DBN_FIELD(Def, leg_instrument_class));
+        l.fields.push_back(DBN_FIELD(Def, leg_ratio_qty_numerator));
+        l.fields.push_back(DBN_FIELD(Def, leg_ratio_qty_denominator));
+        l.fields.push_back(DBN_FIELD(Def, leg_ratio_price_numerator));
+        l.fields.push_back(DBN_FIELD(Def, leg_ratio_price_denominator));
+        l.fields.push_back(DBN_FIELD_AS(Def, leg_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(Def, leg_delta, kPx));
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Imbalance, "imbalance", sizeof(db::ImbalanceMsg), false, {}};
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, ref_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, auction_time, kTs));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, cont_book_clr_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, auct_interest_clr_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, ssr_filling_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, ind_match_price, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, upper_collar, kPx));
+        l.fields.push_back(DBN_FIELD_AS(db::ImbalanceMsg, lower_collar, kPx));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, paired_qty));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, total_imbalance_qty));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, market_imbalance_qty));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, unpaired_qty));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, auction_type));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, side));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, auction_status));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, freeze_status));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, num_extensions));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, unpaired_side));
+        l.fields.push_back(DBN_FIELD(db::ImbalanceMsg, significant_imbalance));
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Statistics, "statistics", sizeof(db::StatMsg), true, {}};
+        l.fields.push_back(DBN_FIELD(db::StatMsg, ts_recv));
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD(db::StatMsg, ts_ref));
+        l.fields.push_back(DBN_FIELD_AS(db::StatMsg, price, kPx));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, quantity, kDelta));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, sequence, kDelta));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, ts_in_delta, kVarint));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, stat_type, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, channel_id, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, update_action, kDict));
+        l.fields.push_back(DBN_COLUMN(db::StatMsg, stat_flags, kDict));
+        roles(l, "price", "quantity", nullptr, nullptr);
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::Error, "", sizeof(db::ErrorMsg), false, {}};
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD(db::ErrorMsg, err));
+        l.fields.push_back(DBN_FIELD(db::ErrorMsg, code));
+        l.fields.push_back(DBN_FIELD(db::ErrorMsg, is_last));
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::System, "", sizeof(db::SystemMsg), false, {}};
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD(db::SystemMsg, msg));
+        l.fields.push_back(DBN_FIELD(db::SystemMsg, code));
+        layouts.push_back(std::move(l));
+    }
+    {
+        RecordLayout l{db::RType::SymbolMapping, "", sizeof(db::SymbolMappingMsg), false, {}};
+        header(l.fields);
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, stype_in));
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, stype_in_symbol));
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, stype_out));
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, stype_out_symbol));
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, start_ts));
+        l.fields.push_back(DBN_FIELD(db::SymbolMappingMsg, end_ts));
+        layouts.push_back(std::move(l));
+    }
+#undef DBN_COLUMN
+#undef DBN_FIELD_AS
+#undef DBN_FIELD
+    return layouts;
+}
+
+}  // namespace detail
+
+/**
+ * Layout of an rtype, or nullptr for record types without one
+ */
+inline const RecordLayout* RecordLayoutFor(uint8_t rtype) {
+    static const std::vector<RecordLayout> layouts = detail::BuildRecordLayouts();
+    static const std::array<const RecordLayout*, 256> by_rtype = []() {
+        std::array<const RecordLayout*, 256> table{};
+        for (const auto& layout : layouts) {
+            table[layout.rtype] = &layout;
+        }
+        return table;
+    }();
+    return by_rtype[rtype];
+}
+
+}  // namespace databento_native
@@ -0,0 +1,301 @@
+#pragma once
+
+#include "record_fields.hpp"
+#include <databento/enums.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Byte offsets of the fields a RecordFilter can test, for one record type
+ * Negative offsets mark fields the record type doesn't have
+ */
+struct RecordFieldLayout {
+    uint16_t record_size = 0;  // Bytes a record must span before its fields are read
+    int16_t price = -1;
+    int16_t size = -1;
+    uint8_t size_width = 0;  // 4 or 8 bytes
+    bool size_signed = false;  // Statistics quantities are signed
+    int16_t side = -1;
+    int16_t action = -1;
+    int16_t bid_price = -1;  // Top-of-book bid; the ask price follows it
+};
+
+/**
+ * Layout of the price/size/side/action fields for each rtype, taken from the
+ * field roles in RecordLayoutFor
+ * OHLCV bars expose close and volume; statistics expose price and quantity
+ */
+inline const std::array<RecordFieldLayout, 256>& RecordFieldLayouts() {
+    static const std::array<RecordFieldLayout, 256> layouts = []() {
+        std::array<RecordFieldLayout, 256> table{};
+        for (unsigned rtype = 0; rtype < 256; ++rtype) {
+            const RecordLayout* layout = RecordLayoutFor(static_cast<uint8_t>(rtype));
+            if (!layout) {
+                continue;
+            }
+            RecordFieldLayout& entry = table[rtype];
+            entry.record_size = static_cast<uint16_t>(layout->record_size);
+            for (const RecordField& field : layout->fields) {
+                auto offset = static_cast<int16_t>(field.offset);
+                switch (field.role) {
+                    case FieldRole::Price:
+                        entry.price = offset;
+                        break;
+                    case FieldRole::Size:
+                        entry.size = offset;
+                        entry.size_width = static_cast<uint8_t>(field.width);
+                        entry.size_signed = field.is_signed;
+                        break;
+                    case FieldRole::Side:
+                        entry.side = offset;
+                        break;
+                    case FieldRole::Action:
+                        entry.action = offset;
+                        break;
+                    case FieldRole::BidPrice:
+                        entry.bid_price = offset;
+                        break;
+                    case FieldRole::None:
+                        break;
+                }
+            }
+        }
+        return table;
+    }();
+    return layouts;
+}
+
+/**
+ * Record predicate evaluated over raw record bytes
+ *
+ * Every configured condition must hold. A record whose type lacks a field that
+ * a condition tests (e.g. a side filter on OHLCV bars) does not match.
+ * Counts of scanned and passing records are kept for selectivity reporting.
+ */
+class RecordFilter {
+public:
+    /**
+     * Parse a filter specification:
+     * {"start": ns, "end": ns, "instrument_ids": [..], "rtypes": [..],
+     *  "min_price": fixed, "max_price": fixed, "min_size": n, "side": "B", "action": "T"}
+     * Prices are fixed-point (1e-9); start is inclusive and end exclusive; all keys are optional.
+     */
+    static RecordFilter FromJson(const std::string& json_str) {
+        nlohmann::json j = nlohmann::json::parse(json_str);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Filter must be a JSON object");
+        }
+
+        RecordFilter filter;
+        if (j.contains("start") && !j["start"].is_null()) {
+            filter.ts_start_ = j["start"].get<uint64_t>();
+        }
+        if (j.contains("end") && !j["end"].is_null()) {
+            filter.ts_end_ = j["end"].get<uint64_t>();
+        }
+        if (j.contains("instrument_ids") && !j["instrument_ids"].is_null()) {
+            filter.instrument_ids_ = j["instrument_ids"].get<std::vector<uint32_t>>();
+            std::sort(filter.instrument_ids_.begin(), filter.instrument_ids_.end());
+            filter.has_instruments_ = true;
+        }
+        if (j.contains("rtypes") && !j["rtypes"].is_null()) {
+            filter.rtypes_.fill(false);
+            for (const auto& rtype : j["rtypes"]) {
+                // get<uint8_t>() would silently wrap out-of-range values onto another rtype
+                int64_t value = rtype.is_number_integer() ? rtype.get<int64_t>() : -1;
+                if (value < 0 || value > 255) {
+                    throw std::invalid_argument("Filter rtypes must be integers from 0 to 255");
+                }
+                filter.rtypes_[static_cast<size_t>(value)] = true;
+            }
+        }
+        if (j.contains("min_price") && !j["min_price"].is_null()) {
+            filter.min_price_ = j["min_price"].get<int64_t>();
+            filter.needs_price_ = true;
+        }
+        if (j.contains("max_price") && !j["max_price"].is_null()) {
+            filter.max_price_ = j["max_price"].get<int64_t>();
+            filter.needs_price_ = true;
+        }
+        if (j.contains("min_size") && !j["min_size"].is_null()) {
+            filter.min_size_ = j["min_size"].get<uint64_t>();
+            filter.needs_size_ = true;
+        }
+        filter.side_ = ParseChar(j, "side");
+        filter.action_ = ParseChar(j, "action");
+        if (filter.ts_start_ > filter.ts_end_ || filter.min_price_ > filter.max_price_) {
+            throw std::invalid_argument("Filter range is empty");
+        }
+        return filter;
+    }
+
+    /**
+     * Evaluate the filter against one record
+     * Records shorter than their type's layout don't match.
+     * @param length Length of the record in bytes
+     */
+    bool Matches(const uint8_t* record, size_t length) {
+        ++scanned_;
+        if (MatchesRecord(record, length, RecordFieldLayouts()[record[1]])) {
+            ++passed_;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Fast path for a contiguous run of same-type, same-length records
+     *
+     * The conditions are evaluated without branches so the compiler can
+     * vectorize the loop; the instrument set is checked only for survivors.
+     * Counts are not updated, since callers may consume only part of the run;
+     * report what was consumed with AddCounts.
+     * @param run First record of the run
+     * @param count Number of records
+     * @param stride Length of each record in bytes; runs of records shorter than their layout don't match
+     * @param keep Output: 1 for each matching record, 0 otherwise
+     * @return Number of matching records
+     */
+    size_t MatchRun(const uint8_t* run, size_t count, size_t stride, uint8_t* keep) const {
+        const RecordFieldLayout& layout = RecordFieldLayouts()[run[1]];
+        if (stride < layout.record_size || !rtypes_[run[1]] || !HasRequiredFields(layout)) {
+            std::fill(keep, keep + count, uint8_t{0});
+            return 0;
+        }
+
+        const bool test_price = needs_price_;
+        const bool test_size = needs_size_;
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t* record = run + i * stride;
+            uint64_t ts = Load<uint64_t>(record, kTsEventOffset);
+            bool ok = (ts >= ts_start_) & (ts < ts_end_);
+            if (test_price) {
+                int64_t price = Load<int64_t>(record, layout.price);
+                ok &= (price >= min_price_) & (price <= max_price_);
+            }
+            if (test_size) {
+                ok &= SizeAtLeast(record, layout);
+            }
+            if (side_) {
+                ok &= static_cast<char>(record[layout.side]) == side_;
+            }
+            if (action_) {
+                ok &= static_cast<char>(record[layout.action]) == action_;
+            }
+            keep[i] = static_cast<uint8_t>(ok);
+        }
+
+        size_t passed = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (keep[i] && has_instruments_) {
+                keep[i] = static_cast<uint8_t>(HasInstrument(Load<uint32_t>(run + i * stride, kInstrumentIdOffset)));
+            }
+            passed += keep[i];
+        }
+        return passed;
+    }
+
+    void AddCounts(uint64_t scanned, uint64_t passed) {
+        scanned_ += scanned;
+        passed_ += passed;
+    }
+
+    uint64_t Scanned() const { return scanned_; }
+    uint64_t Passed() const { return passed_; }
+
+private:
+    static constexpr size_t kInstrumentIdOffset = 4;
+    static constexpr size_t kTsEventOffset = 8;
+
+    RecordFilter() { rtypes_.fill(true); }
+
+    static char ParseChar(const nlohmann::json& j, const char* key) {
+        if (!j.contains(key) || j[key].is_null()) {
+            return 0;
+        }
+        std::string value = j[key].get<std::string>();
+        if (value.size() != 1) {
+            throw std::invalid_argument(std::string("Filter ") + key + " must be a single character");
+        }
+        return value[0];
+    }
+
+    template <typename T>
+    static T Load(const uint8_t* record, size_t offset) {
+        T value;
+        std::memcpy(&value, record + offset, sizeof(T));
+        return value;
+    }
+
+    bool HasRequiredFields(const RecordFieldLayout& layout) const {
+        return (!needs_price_ || layout.price >= 0) && (!needs_size_ || layout.size >= 0) &&
+               (!side_ || layout.side >= 0) && (!action_ || layout.action >= 0);
+    }
+
+    // Negative sizes (signed statistics quantities) never reach min_size
+    bool SizeAtLeast(const uint8_t* record, const RecordFieldLayout& layout) const {
+        if (layout.size_width == 8) {
+            uint64_t size = Load<uint64_t>(record, layout.size);
+            return !(layout.size_signed && static_cast<int64_t>(size) < 0) && size >= min_size_;
+        }
+        uint32_t size = Load<uint32_t>(record, layout.size);
+        return !(layout.size_signed && static_cast<int32_t>(size) < 0) && size >= min_size_;
+    }
+
+    bool HasInstrument(uint32_t instrument_id) const {
+        return std::binary_search(instrument_ids_.begin(), instrument_ids_.end(), instrument_id);
+    }
+
+    bool MatchesRecord(const uint8_t* record, size_t length, const RecordFieldLayout& layout) const {
+        if (length < layout.record_size || !rtypes_[record[1]] || !HasRequiredFields(layout)) {
+            return false;
+        }
+        uint64_t ts = Load<uint64_t>(record, kTsEventOffset);
+        if (ts < ts_start_ || ts >= ts_end_) {
+            return false;
+        }
+        if (needs_price_) {
+            int64_t price = Load<int64_t>(record, layout.price);
+            if (price < min_price_ || price > max_price_) {
+                return false;
+            }
+        }
+        if (needs_size_ && !SizeAtLeast(record, layout)) {
+            return false;
+        }
+        if ((side_ && static_cast<char>(record[layout.side]) != side_) ||
+            (action_ && static_cast<char>(record[layout.action]) != action_)) {
+            return false;
+        }
+        return !has_instruments_ || HasInstrument(Load<uint32_t>(record, kInstrumentIdOffset));
+    }
+
+    uint64_t ts_start_ = 0;
+    uint64_t ts_end_ = UINT64_MAX;
+    bool has_instruments_ = false;
+    std::vector<uint32_t> instrument_ids_;  // Sorted
+    std::array<bool, 256> rtypes_;
+    bool needs_price_ = false;
+    int64_t min_price_ = INT64_MIN;
+    int64_t max_price_ = INT64_MAX;
+    bool needs_size_ = false;
+    uint64_t min_size_ = 0;
+    char side_ = 0;
+    char action_ = 0;
+
+    uint64_t scanned_ = 0;
+    uint64_t passed_ = 0;
+};
+
+}  // namespace databento_native
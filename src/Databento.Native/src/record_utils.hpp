@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <databento/record.hpp>
+#include <databento/enums.hpp>
+
+namespace databento_native {
+
+/**
+ * Get ts_event of a raw record in nanoseconds since the Unix epoch
+ * @param header Record header
+ * @return ts_event in nanoseconds
+ */
+inline uint64_t RecordTsEvent(const databento::RecordHeader& header) {
+    return static_cast<uint64_t>(header.ts_event.time_since_epoch().count());
+}
+
+/**
+ * Get the index timestamp (ts_recv where the schema has one, ts_event otherwise)
+ * DBN files are sorted by this timestamp
+ * @param record Record to inspect
+ * @return Index timestamp in nanoseconds
+ */
+inline uint64_t RecordIndexTs(const databento::Record& record) {
+    namespace db = databento;
+    db::UnixNanos ts;
+    switch (record.RType()) {
+        case db::RType::Mbo:
+            ts = record.Get<db::MboMsg>().IndexTs();
+            break;
+        case db::RType::Mbp0:
+            ts = record.Get<db::TradeMsg>().IndexTs();
+            break;
+        case db::RType::Mbp1:
+            ts = record.Get<db::Mbp1Msg>().IndexTs();
+            break;
+        case db::RType::Mbp10:
+            ts = record.Get<db::Mbp10Msg>().IndexTs();
+            break;
+        case db::RType::Bbo1S:
+        case db::RType::Bbo1M:
+            ts = record.Get<db::BboMsg>().IndexTs();
+            break;
+        case db::RType::Cmbp1:
+        case db::RType::Tcbbo:
+            ts = record.Get<db::Cmbp1Msg>().IndexTs();
+            break;
+        case db::RType::Cbbo1S:
+        case db::RType::Cbbo1M:
+            ts = record.Get<db::CbboMsg>().IndexTs();
+            break;
+        case db::RType::Status:
+            ts = record.Get<db::StatusMsg>().IndexTs();
+            break;
+        case db::RType::InstrumentDef:
+            ts = record.Get<db::InstrumentDefMsg>().IndexTs();
+            break;
+        case db::RType::Imbalance:
+            ts = record.Get<db::ImbalanceMsg>().IndexTs();
+            break;
+        case db::RType::Statistics:
+            ts = record.Get<db::StatMsg>().IndexTs();
+            break;
+        default:
+            // OHLCV, symbol mapping, error and system records have no ts_recv
+            ts = record.Header().ts_event;
+            break;
+    }
+    return static_cast<uint64_t>(ts.time_since_epoch().count());
+}
+
+/**
+ * Schema whose records have the given rtype
+ * MBP-1 records map to mbp-1; use the file's metadata to tell them apart from tbbo.
+ * @param rtype Record type
+ * @return Schema, or nullopt for control records (symbol mappings, errors, system messages)
+ */
+inline std::optional<databento::Schema> SchemaForRType(uint8_t rtype) {
+    namespace db = databento;
+    switch (rtype) {
+        case db::RType::Mbo: return db::Schema::Mbo;
+        case db::RType::Mbp0: return db::Schema::Trades;
+        case db::RType::Mbp1: return db::Schema::Mbp1;
+        case db::RType::Mbp10: return db::Schema::Mbp10;
+        case db::RType::Ohlcv1S: return db::Schema::Ohlcv1S;
+        case db::RType::Ohlcv1M: return db::Schema::Ohlcv1M;
+        case db::RType::Ohlcv1H: return db::Schema::Ohlcv1H;
+        case db::RType::Ohlcv1D: return db::Schema::Ohlcv1D;
+        case db::RType::OhlcvEod: return db::Schema::OhlcvEod;
+        case db::RType::Status: return db::Schema::Status;
+        case db::RType::InstrumentDef: return db::Schema::Definition;
+        case db::RType::Imbalance: return db::Schema::Imbalance;
+        case db::RType::Statistics: return db::Schema::Statistics;
+        case db::RType::Cmbp1: return db::Schema::Cmbp1;
+        case db::RType::Cbbo1S: return db::Schema::Cbbo1S;
+        case db::RType::Cbbo1M: return db::Schema::Cbbo1M;
+        case db::RType::Tcbbo: return db::Schema::Tcbbo;
+        case db::RType::Bbo1S: return db::Schema::Bbo1S;
+        case db::RType::Bbo1M: return db::Schema::Bbo1M;
+        default: return std::nullopt;
+    }
+}
+
+}  // namespace databento_native
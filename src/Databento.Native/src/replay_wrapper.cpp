@@ -0,0 +1,979 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "metadata_json.hpp"
+#include "record_utils.hpp"
+#include <databento/dbn_file_store.hpp>
+#include <databento/record.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace db = databento;
+using databento_native::SafeStrCopy;
+using databento_native::AllocateString;
+using databento_native::MetadataToJson;
+using databento_native::ValidateInputFiles;
+
+// ============================================================================
+// Replay Engine Internals
+// ============================================================================
+
+namespace {
+
+// Bytes of decoded records handed from a prefetch thread to the consumer at once
+constexpr size_t kChunkBytes = 1 << 20;
+// Decoded chunks buffered ahead of the consumer per file
+constexpr size_t kPrefetchDepth = 8;
+
+enum class PacingMode : int {
+    AsFastAsPossible = 0,
+    RealTimeTsEvent = 1,
+    RealTimeTsRecv = 2
+};
+
+enum class ReplayState : int {
+    Idle = 0,
+    Running = 1,
+    Paused = 2,
+    Finished = 3,
+    Error = 4,
+    Stopped = 5
+};
+
+// How records leave the replay; fixed by the first start or pull call
+enum class DeliveryMode {
+    None,
+    Callbacks,
+    Pull
+};
+
+enum class WaitResult {
+    Ready,
+    Timeout,
+    SeekPending,
+    Stopped
+};
+
+uint64_t PacingTs(const db::Record& record, PacingMode mode) {
+    if (mode == PacingMode::RealTimeTsRecv) {
+        return databento_native::RecordIndexTs(record);
+    }
+    return databento_native::RecordTsEvent(record.Header());
+}
+
+/**
+ * Contiguous run of decoded records
+ * Records are 8-byte multiples, so every record in the chunk stays aligned
+ */
+struct RecordChunk {
+    std::vector<uint8_t> bytes;
+    size_t record_count = 0;
+};
+
+/**
+ * Decodes a single DBN file on a background thread into a bounded queue of chunks
+ * The consumer pops chunks in file order; destruction cancels and joins the thread
+ */
+class PrefetchSource {
+public:
+    PrefetchSource(std::filesystem::path path, PacingMode mode, uint64_t skip_before_ns)
+        : path_(std::move(path))
+        , mode_(mode)
+        , skip_before_ns_(skip_before_ns)
+    {
+        thread_ = std::thread([this]() { Run(); });
+    }
+
+    ~PrefetchSource() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cancelled_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    PrefetchSource(const PrefetchSource&) = delete;
+    PrefetchSource& operator=(const PrefetchSource&) = delete;
+
+    // Blocks until the next chunk is decoded; returns nullptr at end of file
+    std::unique_ptr<RecordChunk> Pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !queue_.empty() || done_; });
+        if (!queue_.empty()) {
+            auto chunk = std::move(queue_.front());
+            queue_.pop_front();
+            cv_.notify_all();
+            return chunk;
+        }
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return nullptr;
+    }
+
+private:
+    void Run() {
+        try {
+            db::DbnFileStore store{path_};
+            auto chunk = std::make_unique<RecordChunk>();
+            chunk->bytes.reserve(kChunkBytes);
+
+            while (const db::Record* record = store.NextRecord()) {
+                if (skip_before_ns_ != 0 && PacingTs(*record, mode_) < skip_before_ns_) {
+                    continue;
+                }
+
+                const auto* bytes = reinterpret_cast<const uint8_t*>(&record->Header());
+                chunk->bytes.insert(chunk->bytes.end(), bytes, bytes + record->Size());
+                ++chunk->record_count;
+
+                if (chunk->bytes.size() >= kChunkBytes) {
+                    if (!Push(std::move(chunk))) {
+                        return;  // Cancelled
+                    }
+                    chunk = std::make_unique<RecordChunk>();
+                    chunk->bytes.reserve(kChunkBytes);
+                }
+            }
+
+            if (chunk->record_count > 0 && !Push(std::move(chunk))) {
+                return;
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    bool Push(std::unique_ptr<RecordChunk> chunk) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return cancelled_ || queue_.size() < kPrefetchDepth; });
+        if (cancelled_) {
+            return false;
+        }
+        queue_.push_back(std::move(chunk));
+        cv_.notify_all();
+        return true;
+    }
+
+    std::filesystem::path path_;
+    PacingMode mode_;
+    uint64_t skip_before_ns_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::unique_ptr<RecordChunk>> queue_;
+    std::exception_ptr error_;
+    bool done_ = false;
+    bool cancelled_ = false;
+    std::thread thread_;
+};
+
+}  // namespace
+
+// ============================================================================
+// Replay Wrapper Structure
+// ============================================================================
+
+struct ReplayWrapper {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::filesystem::path> files;
+    std::vector<db::Metadata> metadata;
+    PacingMode mode;
+
+    // Control state (shared between controlling threads and the consumer)
+    std::mutex state_mutex;
+    std::condition_variable state_cv;
+    double speed = 1.0;
+    bool paused = false;
+    size_t step_budget = 0;
+    bool stop_requested = false;
+    std::optional<uint64_t> pending_seek_ns;
+    bool clock_anchored = false;
+    Clock::time_point anchor_wall;
+    uint64_t anchor_ts = 0;
+    DeliveryMode delivery = DeliveryMode::None;
+    std::atomic<int> state{static_cast<int>(ReplayState::Idle)};
+
+    // Consumer state (only touched by the single consuming thread)
+    std::mutex consumer_mutex;
+    std::unique_ptr<PrefetchSource> current_source;
+    std::unique_ptr<PrefetchSource> next_source;
+    size_t current_index = 0;
+    size_t next_index = 0;
+    std::unique_ptr<RecordChunk> chunk;
+    size_t chunk_pos = 0;
+    uint64_t skip_before_ns = 0;
+    bool source_announced = false;
+
+    // Callback delivery (set under state_mutex before the delivery thread starts)
+    RecordCallback record_callback = nullptr;
+    RecordBatchCallback batch_callback = nullptr;
+    MetadataCallback metadata_callback = nullptr;
+    ErrorCallback error_callback = nullptr;
+    void* user_data = nullptr;
+    size_t max_batch_records = 0;
+    std::thread delivery_thread;
+    bool destroy_on_exit = false;  // Destroyed from inside a callback; only touched by the delivery thread
+
+    ReplayWrapper(std::vector<std::filesystem::path> paths, PacingMode pacing, double initial_speed)
+        : files(std::move(paths))
+        , mode(pacing)
+        , speed(initial_speed)
+    {
+        // Decode every header up front: fails fast on bad input and lets seeks skip whole files
+        metadata.reserve(files.size());
+        for (const auto& path : files) {
+            db::DbnFileStore store{path};
+            metadata.push_back(store.GetMetadata());
+        }
+    }
+
+    ~ReplayWrapper() {
+        RequestStop();
+        if (delivery_thread.joinable()) {
+            delivery_thread.join();
+        }
+    }
+
+    void RequestStop() {
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            stop_requested = true;
+            int current = state.load(std::memory_order_acquire);
+            if (current == static_cast<int>(ReplayState::Idle) || current == static_cast<int>(ReplayState::Running) ||
+                current == static_cast<int>(ReplayState::Paused)) {
+                state.store(static_cast<int>(ReplayState::Stopped), std::memory_order_release);
+            }
+        }
+        state_cv.notify_all();
+    }
+
+    bool StopRequested() {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return stop_requested;
+    }
+
+    // Caller holds state_mutex
+    ReplayState ActiveState() const {
+        return paused ? ReplayState::Paused : ReplayState::Running;
+    }
+
+    // Caller holds state_mutex and has set the callbacks
+    void SpawnDeliveryThread() {
+        delivery_thread = std::thread([this]() {
+            {
+                std::lock_guard<std::mutex> consumer_lock(consumer_mutex);
+                RunCallbackLoop();
+            }
+            // Every lock is released, so a replay destroyed by its own callback can go now
+            if (destroy_on_exit) {
+                delete this;
+            }
+        });
+    }
+
+    // ------------------------------------------------------------------------
+    // Record access
+    // ------------------------------------------------------------------------
+
+    // Returns the next record without consuming it, or nullptr when all files are exhausted
+    db::Record* PeekNext() {
+        while (true) {
+            if (chunk && chunk_pos < chunk->bytes.size()) {
+                return &peeked_.emplace(reinterpret_cast<db::RecordHeader*>(chunk->bytes.data() + chunk_pos));
+            }
+            chunk.reset();
+
+            if (!current_source) {
+                if (current_index >= files.size()) {
+                    return nullptr;
+                }
+                ActivateSource();
+            }
+
+            chunk = current_source->Pop();
+            chunk_pos = 0;
+            if (!chunk) {
+                current_source.reset();
+                ++current_index;
+            }
+        }
+    }
+
+    void Consume() {
+        chunk_pos += peeked_->Size();
+    }
+
+    void ActivateSource() {
+        if (next_source && next_index == current_index) {
+            current_source = std::move(next_source);
+        } else {
+            next_source.reset();
+            current_source = std::make_unique<PrefetchSource>(files[current_index], mode, skip_before_ns);
+        }
+
+        // Keep one file of lookahead decoding so file boundaries don't stall the consumer
+        size_t upcoming = NextFileIndex(current_index + 1);
+        if (upcoming < files.size()) {
+            next_index = upcoming;
+            next_source = std::make_unique<PrefetchSource>(files[upcoming], mode, skip_before_ns);
+        }
+
+        if (metadata_callback) {
+            std::string json_str = MetadataToJson(metadata[current_index]).dump();
+            metadata_callback(json_str.c_str(), json_str.size(), user_data);
+        }
+    }
+
+    // First file at or after `from` that can contain records at or after the seek target
+    size_t NextFileIndex(size_t from) const {
+        size_t i = from;
+        while (i < files.size() && skip_before_ns != 0) {
+            auto end_ns = static_cast<uint64_t>(metadata[i].end.time_since_epoch().count());
+            if (end_ns == 0 || end_ns > skip_before_ns) {
+                break;
+            }
+            ++i;
+        }
+        return i;
+    }
+
+    void ApplySeek(uint64_t target_ns) {
+        next_source.reset();
+        current_source.reset();
+        chunk.reset();
+        chunk_pos = 0;
+        skip_before_ns = target_ns;
+        current_index = NextFileIndex(0);
+
+        std::lock_guard<std::mutex> lock(state_mutex);
+        clock_anchored = false;
+        if (state.load(std::memory_order_acquire) == static_cast<int>(ReplayState::Finished)) {
+            state.store(static_cast<int>(ActiveState()), std::memory_order_release);
+        }
+    }
+
+    // At the end of the last file: applies a seek requested meanwhile, otherwise marks the
+    // replay finished. Returns whether delivery continues from a seek target.
+    bool RewindOrFinish() {
+        std::optional<uint64_t> target;
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            if (stop_requested) {
+                return false;
+            }
+            if (!pending_seek_ns) {
+                state.store(static_cast<int>(ReplayState::Finished), std::memory_order_release);
+                return false;
+            }
+            target = pending_seek_ns;
+            pending_seek_ns.reset();
+        }
+        ApplySeek(*target);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // Pacing
+    // ------------------------------------------------------------------------
+
+    // Waits until `record` is due, honoring pause/step/stop/seek requests
+    WaitResult WaitUntilDue(const db::Record& record, std::optional<Clock::time_point> deadline) {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        while (true) {
+            if (stop_requested) {
+                return WaitResult::Stopped;
+            }
+            if (pending_seek_ns) {
+                return WaitResult::SeekPending;
+            }
+
+            if (paused) {
+                if (step_budget > 0) {
+                    --step_budget;
+                    return WaitResult::Ready;
+                }
+                if (!deadline) {
+                    state_cv.wait(lock);
+                } else if (state_cv.wait_until(lock, *deadline) == std::cv_status::timeout) {
+                    return WaitResult::Timeout;
+                }
+                continue;
+            }
+
+            if (mode == PacingMode::AsFastAsPossible) {
+                return WaitResult::Ready;
+            }
+
+            uint64_t ts = PacingTs(record, mode);
+            if (!clock_anchored) {
+                clock_anchored = true;
+                anchor_wall = Clock::now();
+                anchor_ts = ts;
+                return WaitResult::Ready;
+            }
+            if (ts <= anchor_ts) {
+                return WaitResult::Ready;
+            }
+
+            auto offset = std::chrono::nanoseconds(
+                static_cast<int64_t>(static_cast<double>(ts - anchor_ts) / speed));
+            auto due = anchor_wall + std::chrono::duration_cast<Clock::duration>(offset);
+            auto now = Clock::now();
+            if (now >= due) {
+                return WaitResult::Ready;
+            }
+            if (deadline && *deadline <= now) {
+                return WaitResult::Timeout;
+            }
+
+            state_cv.wait_until(lock, deadline ? std::min(due, *deadline) : due);
+        }
+    }
+
+    std::optional<uint64_t> TakePendingSeek() {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        auto target = pending_seek_ns;
+        pending_seek_ns.reset();
+        return target;
+    }
+
+    // ------------------------------------------------------------------------
+    // Delivery
+    // ------------------------------------------------------------------------
+
+    void RunCallbackLoop() {
+        try {
+            while (true) {
+                // Checked before PeekNext, which may invoke the metadata callback
+                if (StopRequested()) {
+                    return;
+                }
+                db::Record* record = PeekNext();
+                if (!record) {
+                    if (RewindOrFinish()) {
+                        continue;
+                    }
+                    return;
+                }
+
+                WaitResult result = WaitUntilDue(*record, std::nullopt);
+                if (result == WaitResult::Stopped) {
+                    return;
+                }
+                if (result == WaitResult::SeekPending) {
+                    if (auto target = TakePendingSeek()) {
+                        ApplySeek(*target);
+                    }
+                    continue;
+                }
+
+                if (batch_callback) {
+                    DeliverBatch();
+                } else {
+                    const auto* bytes = reinterpret_cast<const uint8_t*>(&record->Header());
+                    size_t length = record->Size();
+                    uint8_t type = static_cast<uint8_t>(record->RType());
+                    Consume();
+                    record_callback(bytes, length, type, user_data);
+                }
+            }
+        }
+        catch (const std::exception& ex) {
+            state.store(static_cast<int>(ReplayState::Error), std::memory_order_release);
+            if (error_callback) {
+                error_callback(ex.what(), -1, user_data);
+            }
+        }
+        catch (...) {
+            state.store(static_cast<int>(ReplayState::Error), std::memory_order_release);
+            if (error_callback) {
+                error_callback("Unknown exception in replay", -998, user_data);
+            }
+        }
+    }
+
+    // Delivers the head record plus every following record in the same chunk that is already due
+    void DeliverBatch() {
+        const uint8_t* start = chunk->bytes.data() + chunk_pos;
+        size_t length = 0;
+        size_t count = 0;
+        const RecordChunk* batch_chunk = chunk.get();
+
+        do {
+            length += peeked_->Size();
+            ++count;
+            Consume();
+            if (count >= max_batch_records || chunk_pos >= batch_chunk->bytes.size()) {
+                break;
+            }
+            db::Record* record = PeekNext();
+            if (WaitUntilDue(*record, Clock::now()) != WaitResult::Ready) {
+                break;
+            }
+        } while (true);
+
+        batch_callback(start, length, count, user_data);
+    }
+
+    // Pull interface: packs due records into the caller's buffer
+    int NextRecords(uint8_t* buffer, size_t buffer_size, size_t* offsets, size_t max_records,
+                    size_t* record_count, int timeout_ms, char* error_buffer, size_t error_buffer_size) {
+        std::optional<Clock::time_point> deadline;
+        if (timeout_ms >= 0) {
+            deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+        }
+
+        size_t used = 0;
+        size_t count = 0;
+        while (count < max_records) {
+            db::Record* record = PeekNext();
+            if (!record) {
+                if (RewindOrFinish()) {
+                    continue;
+                }
+                break;
+            }
+
+            size_t size = record->Size();
+            if (used + size > buffer_size) {
+                if (count == 0) {
+                    SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+                    return -2;
+                }
+                break;
+            }
+
+            WaitResult result = WaitUntilDue(*record, count == 0 ? deadline : Clock::now());
+            if (result == WaitResult::SeekPending) {
+                if (count > 0) {
+                    break;  // Hand back what we have; the seek applies on the next call
+                }
+                if (auto target = TakePendingSeek()) {
+                    ApplySeek(*target);
+                }
+                continue;
+            }
+            if (result != WaitResult::Ready) {
+                break;  // Timeout or stop
+            }
+
+            std::memcpy(buffer + used, &record->Header(), size);
+            offsets[count++] = used;
+            used += size;
+            Consume();
+        }
+
+        *record_count = count;
+        int current = state.load(std::memory_order_acquire);
+        if (count == 0 && (current == static_cast<int>(ReplayState::Finished) ||
+                           current == static_cast<int>(ReplayState::Stopped))) {
+            return 1;
+        }
+        return 0;
+    }
+
+private:
+    std::optional<db::Record> peeked_;
+};
+
+static ReplayWrapper* GetReplayWrapper(DbentoReplayHandle handle, char* error_buffer, size_t error_buffer_size) {
+    databento_native::ValidationError validation_error;
+    auto* wrapper = databento_native::ValidateAndCast<ReplayWrapper>(
+        handle, databento_native::HandleType::Replay, &validation_error);
+    if (!wrapper) {
+        SafeStrCopy(error_buffer, error_buffer_size,
+            databento_native::GetValidationErrorMessage(validation_error));
+    }
+    return wrapper;
+}
+
+// Installs the callbacks and starts the delivery thread, unless delivery has already begun
+static int StartDelivery(ReplayWrapper* wrapper, MetadataCallback on_metadata, RecordCallback on_record,
+                         RecordBatchCallback on_batch, size_t max_batch_records, ErrorCallback on_error,
+                         void* user_data, char* error_buffer, size_t error_buffer_size) {
+    std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+    if (wrapper->delivery != DeliveryMode::None) {
+        SafeStrCopy(error_buffer, error_buffer_size, "Replay already started");
+        return -3;
+    }
+    if (wrapper->stop_requested) {
+        SafeStrCopy(error_buffer, error_buffer_size, "Replay has been stopped");
+        return -3;
+    }
+
+    // IMPORTANT: C# layer must keep these delegates alive until the replay is destroyed
+    wrapper->metadata_callback = on_metadata;
+    wrapper->record_callback = on_record;
+    wrapper->batch_callback = on_batch;
+    wrapper->max_batch_records = max_batch_records;
+    wrapper->error_callback = on_error;
+    wrapper->user_data = user_data;
+
+    wrapper->state.store(static_cast<int>(wrapper->ActiveState()), std::memory_order_release);
+    wrapper->SpawnDeliveryThread();
+    wrapper->delivery = DeliveryMode::Callbacks;
+    return 0;
+}
+
+// ============================================================================
+// Replay API Implementation
+// ============================================================================
+
+DATABENTO_API DbentoReplayHandle dbento_replay_create(
+    const char** file_paths,
+    size_t file_count,
+    int pacing_mode,
+    double speed,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (pacing_mode < static_cast<int>(PacingMode::AsFastAsPossible) ||
+            pacing_mode > static_cast<int>(PacingMode::RealTimeTsRecv)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid pacing mode");
+            return nullptr;
+        }
+        if (!std::isfinite(speed) || speed <= 0.0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Speed must be a positive number");
+            return nullptr;
+        }
+
+        std::vector<std::filesystem::path> paths = ValidateInputFiles(file_paths, file_count);
+        auto wrapper = std::make_unique<ReplayWrapper>(std::move(paths), static_cast<PacingMode>(pacing_mode), speed);
+        return reinterpret_cast<DbentoReplayHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::Replay, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API const char* dbento_replay_get_metadata(
+    DbentoReplayHandle handle,
+    size_t file_index,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return nullptr;
+        }
+        if (file_index >= wrapper->metadata.size()) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File index out of range");
+            return nullptr;
+        }
+
+        std::string json_str = MetadataToJson(wrapper->metadata[file_index]).dump();
+        return AllocateString(json_str);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_replay_start(
+    DbentoReplayHandle handle,
+    MetadataCallback on_metadata,
+    RecordCallback on_record,
+    ErrorCallback on_error,
+    void* user_data,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+
+        if (!on_record) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Record callback cannot be null");
+            return -2;
+        }
+
+        return StartDelivery(wrapper, on_metadata, on_record, nullptr, 0, on_error, user_data,
+            error_buffer, error_buffer_size);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_start_batched(
+    DbentoReplayHandle handle,
+    MetadataCallback on_metadata,
+    RecordBatchCallback on_batch,
+    size_t max_batch_records,
+    ErrorCallback on_error,
+    void* user_data,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+
+        if (!on_batch || max_batch_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Batch callback and batch size are required");
+            return -2;
+        }
+
+        return StartDelivery(wrapper, on_metadata, nullptr, on_batch, max_batch_records, on_error, user_data,
+            error_buffer, error_buffer_size);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_next_records(
+    DbentoReplayHandle handle,
+    uint8_t* record_buffer,
+    size_t record_buffer_size,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    int timeout_ms,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, error_buffer, error_buffer_size);
+        if (!wrapper) {
+            return -1;
+        }
+
+        if (!record_buffer || !record_offsets || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        *record_count = 0;
+
+        {
+            std::lock_guard<std::mutex> state_lock(wrapper->state_mutex);
+            if (wrapper->delivery == DeliveryMode::Callbacks) {
+                SafeStrCopy(error_buffer, error_buffer_size, "Replay is delivering through callbacks");
+                return -3;
+            }
+            if (wrapper->delivery == DeliveryMode::None) {
+                wrapper->delivery = DeliveryMode::Pull;
+                if (!wrapper->stop_requested) {
+                    wrapper->state.store(static_cast<int>(wrapper->ActiveState()), std::memory_order_release);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->consumer_mutex);
+
+        return wrapper->NextRecords(record_buffer, record_buffer_size, record_offsets, max_records,
+            record_count, timeout_ms, error_buffer, error_buffer_size);
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_pause(DbentoReplayHandle handle)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+        wrapper->paused = true;
+        wrapper->step_budget = 0;
+        int expected = static_cast<int>(ReplayState::Running);
+        wrapper->state.compare_exchange_strong(expected, static_cast<int>(ReplayState::Paused));
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_resume(DbentoReplayHandle handle)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+            wrapper->paused = false;
+            wrapper->clock_anchored = false;  // Re-anchor pacing at the next record
+            int expected = static_cast<int>(ReplayState::Paused);
+            wrapper->state.compare_exchange_strong(expected, static_cast<int>(ReplayState::Running));
+        }
+        wrapper->state_cv.notify_all();
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_step(DbentoReplayHandle handle, size_t record_count)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+            if (!wrapper->paused) {
+                return -2;  // Stepping only applies while paused
+            }
+            wrapper->step_budget += record_count;
+            wrapper->clock_anchored = false;
+        }
+        wrapper->state_cv.notify_all();
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_seek(DbentoReplayHandle handle, int64_t timestamp_ns)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        if (timestamp_ns < 0) {
+            return -2;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+            if (wrapper->stop_requested) {
+                return -3;
+            }
+            wrapper->pending_seek_ns = static_cast<uint64_t>(timestamp_ns);
+
+            // The delivery loop exits at the end of the last file; run a new one from the target.
+            // The old thread delivers nothing after marking the replay finished, so joining is prompt.
+            if (wrapper->delivery == DeliveryMode::Callbacks &&
+                wrapper->state.load(std::memory_order_acquire) == static_cast<int>(ReplayState::Finished)) {
+                if (wrapper->delivery_thread.joinable()) {
+                    wrapper->delivery_thread.join();
+                }
+                wrapper->state.store(static_cast<int>(wrapper->ActiveState()), std::memory_order_release);
+                wrapper->SpawnDeliveryThread();
+            }
+        }
+        wrapper->state_cv.notify_all();
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_set_speed(DbentoReplayHandle handle, double speed)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        if (!std::isfinite(speed) || speed <= 0.0) {
+            return -2;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wrapper->state_mutex);
+            wrapper->speed = speed;
+            wrapper->clock_anchored = false;
+        }
+        wrapper->state_cv.notify_all();
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_replay_get_state(DbentoReplayHandle handle)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (!wrapper) {
+            return -1;
+        }
+        return wrapper->state.load(std::memory_order_acquire);
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_replay_stop(DbentoReplayHandle handle)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (wrapper) {
+            wrapper->RequestStop();
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
+
+DATABENTO_API void dbento_replay_destroy(DbentoReplayHandle handle)
+{
+    try {
+        auto* wrapper = GetReplayWrapper(handle, nullptr, 0);
+        if (wrapper) {
+            databento_native::DestroyValidatedHandle(handle);
+            if (wrapper->delivery_thread.get_id() == std::this_thread::get_id()) {
+                // Called from a callback: the delivery loop still holds its locks and uses the
+                // wrapper, so it stops once the callback returns and frees the wrapper on exit
+                wrapper->destroy_on_exit = true;
+                wrapper->delivery_thread.detach();
+                wrapper->RequestStop();
+            } else {
+                // Destructor stops delivery and joins the delivery and prefetch threads
+                delete wrapper;
+            }
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
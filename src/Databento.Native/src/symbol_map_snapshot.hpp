@@ -0,0 +1,275 @@
+#pragma once
+
+#include "flat_ts_symbol_map.hpp"
+#include "mapped_file.hpp"
+#include "pit_symbol_map.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Binary snapshots of symbol maps for fast startup
+ *
+ * A snapshot is a 64-byte header followed by fixed-width little-endian arrays, each
+ * starting on a 4-byte boundary (8 for 64-bit arrays):
+ *
+ *   time series:    ids[n] offsets[n + 1] intervals[k] symbol_offsets[s + 1] pool[p]
+ *   point-in-time:  expires[n] ids[n] symbols[n] symbol_offsets[s + 1] pool[p]
+ *
+ * ids are sorted instrument IDs and pool holds each distinct symbol once,
+ * NUL-terminated. A time-series snapshot is mapped read-only and used in place, so
+ * any number of processes share its pages and loading costs one validation pass plus
+ * the small ordinal index. A point-in-time map keeps changing after load, so its
+ * snapshot is copied into a new map and unmapped. Snapshots are written to a
+ * temporary file and renamed over the target, so readers never see a partial file.
+ */
+constexpr char kSnapshotMagic[8] = {'D', 'B', 'N', 'S', 'Y', 'M', 'M', 'P'};
+constexpr uint32_t kSnapshotVersion = 1;
+constexpr uint32_t kSnapshotByteOrder = 0x01020304;
+
+enum class SnapshotKind : uint32_t {
+    TimeSeries = 1,
+    PointInTime = 2
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;      // kSnapshotByteOrder as written by the producer
+    uint32_t kind;            // SnapshotKind
+    uint32_t instrument_count;
+    uint64_t size;            // Time series: (day, instrument) mappings; point-in-time: instruments
+    uint32_t interval_count;  // Time series only
+    uint32_t symbol_count;
+    uint32_t pool_size;
+    uint8_t reserved[20];
+};
+static_assert(sizeof(SnapshotHeader) == 64, "Snapshot header must be 64 bytes");
+static_assert(sizeof(FlatTsSymbolMap::Interval) == 12, "Snapshot intervals must be 12 bytes");
+
+namespace detail {
+
+inline void WriteSection(std::ofstream& out, const void* data, size_t size) {
+    if (size > 0) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+}
+
+inline SnapshotHeader NewSnapshotHeader(SnapshotKind kind) {
+    SnapshotHeader header{};
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.byte_order = kSnapshotByteOrder;
+    header.kind = static_cast<uint32_t>(kind);
+    return header;
+}
+
+// Write `body` to a sibling temporary file, then rename it over `path`
+template <typename F>
+void WriteSnapshotFile(const std::filesystem::path& path, F&& body) {
+    std::filesystem::path temp_path = path;
+    temp_path += ".tmp";
+    {
+        std::ofstream out{temp_path, std::ios::binary | std::ios::trunc};
+        if (!out) {
+            throw std::runtime_error("Failed to create snapshot file: " + temp_path.string());
+        }
+        body(out);
+        out.flush();
+        if (!out) {
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            throw std::runtime_error("Failed to write snapshot file: " + temp_path.string());
+        }
+    }
+    std::filesystem::rename(temp_path, path);
+}
+
+// Cursor over the arrays of a mapped snapshot that checks every section fits
+class SnapshotReader {
+public:
+    SnapshotReader(const MappedFile& file, SnapshotKind kind) : file_(file) {
+        if (file.Size() < sizeof(SnapshotHeader)) {
+            throw std::invalid_argument("File is too small to be a symbol map snapshot");
+        }
+        std::memcpy(&header_, file.Data(), sizeof(header_));
+        if (std::memcmp(header_.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+            throw std::invalid_argument("File is not a symbol map snapshot");
+        }
+        if (header_.byte_order != kSnapshotByteOrder) {
+            throw std::invalid_argument("Symbol map snapshot was written with a different byte order");
+        }
+        if (header_.version != kSnapshotVersion) {
+            throw std::invalid_argument("Unsupported symbol map snapshot version " + std::to_string(header_.version));
+        }
+        if (header_.kind != static_cast<uint32_t>(kind)) {
+            throw std::invalid_argument(kind == SnapshotKind::TimeSeries
+                ? "Snapshot holds a point-in-time symbol map, not a time-series one"
+                : "Snapshot holds a time-series symbol map, not a point-in-time one");
+        }
+        pos_ = sizeof(SnapshotHeader);
+    }
+
+    const SnapshotHeader& Header() const { return header_; }
+
+    template <typename T>
+    const T* Section(uint64_t count) {
+        uint64_t bytes = count * sizeof(T);
+        if (count > file_.Size() || bytes > file_.Size() - pos_) {
+            throw std::invalid_argument("Symbol map snapshot is truncated");
+        }
+        const T* section = reinterpret_cast<const T*>(file_.Data() + pos_);
+        pos_ += static_cast<size_t>((bytes + 3) & ~uint64_t{3});
+        return section;
+    }
+
+    void Finish() const {
+        if (pos_ != file_.Size()) {
+            throw std::invalid_argument("Symbol map snapshot has trailing bytes");
+        }
+    }
+
+private:
+    const MappedFile& file_;
+    SnapshotHeader header_;
+    size_t pos_ = 0;
+};
+
+}  // namespace detail
+
+/**
+ * Write a time-series symbol map snapshot
+ */
+inline void SaveSnapshot(const FlatTsSymbolMap& map, const std::filesystem::path& path) {
+    const FlatTsSymbolMap::Sections& s = map.GetSections();
+    SnapshotHeader header = detail::NewSnapshotHeader(SnapshotKind::TimeSeries);
+    header.instrument_count = s.instrument_count;
+    header.size = s.size;
+    header.interval_count = s.interval_count;
+    header.symbol_count = s.symbol_count;
+    header.pool_size = s.pool_size;
+    detail::WriteSnapshotFile(path, [&](std::ofstream& out) {
+        detail::WriteSection(out, &header, sizeof(header));
+        detail::WriteSection(out, s.ids, s.instrument_count * sizeof(uint32_t));
+        detail::WriteSection(out, s.offsets, (s.instrument_count + 1) * sizeof(uint32_t));
+        detail::WriteSection(out, s.intervals, s.interval_count * sizeof(FlatTsSymbolMap::Interval));
+        detail::WriteSection(out, s.symbol_offsets, (s.symbol_count + 1) * sizeof(uint32_t));
+        detail::WriteSection(out, s.pool, s.pool_size);
+        const char padding[4] = {};
+        detail::WriteSection(out, padding, (4 - s.pool_size % 4) % 4);
+    });
+}
+
+/**
+ * Map a time-series snapshot read-only and serve lookups straight from it
+ * @throws std::invalid_argument if the file is not a valid time-series snapshot
+ */
+inline std::unique_ptr<FlatTsSymbolMap> LoadTsSnapshot(const std::filesystem::path& path) {
+    auto file = std::make_shared<const MappedFile>(path);
+    detail::SnapshotReader reader{*file, SnapshotKind::TimeSeries};
+    const SnapshotHeader& header = reader.Header();
+    FlatTsSymbolMap::Sections s;
+    s.size = header.size;
+    s.instrument_count = header.instrument_count;
+    s.interval_count = header.interval_count;
+    s.symbol_count = header.symbol_count;
+    s.pool_size = header.pool_size;
+    s.ids = reader.Section<uint32_t>(s.instrument_count);
+    s.offsets = reader.Section<uint32_t>(uint64_t{s.instrument_count} + 1);
+    s.intervals = reader.Section<FlatTsSymbolMap::Interval>(s.interval_count);
+    s.symbol_offsets = reader.Section<uint32_t>(uint64_t{s.symbol_count} + 1);
+    s.pool = reader.Section<char>(s.pool_size);
+    reader.Finish();
+    return std::make_unique<FlatTsSymbolMap>(s, file);
+}
+
+/**
+ * Write a point-in-time symbol map snapshot, including each mapping's expiry
+ */
+inline void SaveSnapshot(const InternedPitSymbolMap& map, const std::filesystem::path& path) {
+    std::vector<uint32_t> ids;
+    ids.reserve(map.Size());
+    for (const auto& entry : map.Map()) {
+        ids.push_back(entry.first);
+    }
+    std::sort(ids.begin(), ids.end());
+
+    // Renumber interned symbol IDs densely into the snapshot's pool
+    std::vector<uint64_t> expires(ids.size());
+    std::vector<uint32_t> symbols(ids.size());
+    std::vector<uint32_t> symbol_offsets;
+    std::string pool;
+    std::unordered_map<uint32_t, uint32_t> pool_indices;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const InternedPitSymbolMap::Entry& entry = *map.Find(ids[i]);
+        expires[i] = entry.expires;
+        auto [it, inserted] = pool_indices.try_emplace(entry.symbol_id, static_cast<uint32_t>(symbol_offsets.size()));
+        if (inserted) {
+            symbol_offsets.push_back(static_cast<uint32_t>(pool.size()));
+            pool.append(*map.Symbol(entry.symbol_id));
+            pool.push_back('\0');
+        }
+        symbols[i] = it->second;
+    }
+    symbol_offsets.push_back(static_cast<uint32_t>(pool.size()));
+
+    SnapshotHeader header = detail::NewSnapshotHeader(SnapshotKind::PointInTime);
+    header.instrument_count = static_cast<uint32_t>(ids.size());
+    header.size = ids.size();
+    header.symbol_count = static_cast<uint32_t>(symbol_offsets.size() - 1);
+    header.pool_size = static_cast<uint32_t>(pool.size());
+    detail::WriteSnapshotFile(path, [&](std::ofstream& out) {
+        detail::WriteSection(out, &header, sizeof(header));
+        detail::WriteSection(out, expires.data(), expires.size() * sizeof(uint64_t));
+        detail::WriteSection(out, ids.data(), ids.size() * sizeof(uint32_t));
+        detail::WriteSection(out, symbols.data(), symbols.size() * sizeof(uint32_t));
+        detail::WriteSection(out, symbol_offsets.data(), symbol_offsets.size() * sizeof(uint32_t));
+        detail::WriteSection(out, pool.data(), pool.size());
+        const char padding[4] = {};
+        detail::WriteSection(out, padding, (4 - pool.size() % 4) % 4);
+    });
+}
+
+/**
+ * Build a point-in-time symbol map from a snapshot
+ * @throws std::invalid_argument if the file is not a valid point-in-time snapshot
+ */
+inline std::unique_ptr<InternedPitSymbolMap> LoadPitSnapshot(const std::filesystem::path& path) {
+    MappedFile file{path};
+    file.Advise(MappedAccess::Sequential);
+    detail::SnapshotReader reader{file, SnapshotKind::PointInTime};
+    const SnapshotHeader& header = reader.Header();
+    uint32_t count = header.instrument_count;
+    const uint64_t* expires = reader.Section<uint64_t>(count);
+    const uint32_t* ids = reader.Section<uint32_t>(count);
+    const uint32_t* symbols = reader.Section<uint32_t>(count);
+    const uint32_t* symbol_offsets = reader.Section<uint32_t>(uint64_t{header.symbol_count} + 1);
+    const char* pool = reader.Section<char>(header.pool_size);
+    reader.Finish();
+
+    auto map = std::make_unique<InternedPitSymbolMap>();
+    map->Reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t symbol = symbols[i];
+        if (symbol >= header.symbol_count || symbol_offsets[symbol] >= symbol_offsets[symbol + 1] ||
+            symbol_offsets[symbol + 1] > header.pool_size || pool[symbol_offsets[symbol + 1] - 1] != '\0') {
+            throw std::invalid_argument("Symbol map snapshot string pool is inconsistent");
+        }
+        std::string_view text{pool + symbol_offsets[symbol], symbol_offsets[symbol + 1] - symbol_offsets[symbol] - 1};
+        map->Insert(ids[i], text, expires[i]);
+    }
+    return map;
+}
+
+}  // namespace databento_native
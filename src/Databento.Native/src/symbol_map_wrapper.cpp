@@ -1,11 +1,18 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
+#include "flat_ts_symbol_map.hpp"
 #include "handle_validation.hpp"
+#include "pit_symbol_map.hpp"
+#include "symbol_map_snapshot.hpp"
 #include <databento/symbol_map.hpp>
 #include <databento/dbn.hpp>
 #include <databento/record.hpp>
 #include <date/date.h>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <cstring>
 
@@ -17,16 +24,18 @@ using databento_native::SafeStrCopy;
 // ============================================================================
 
 struct TsSymbolMapWrapper {
-    std::unique_ptr<db::TsSymbolMap> map;
+    // Read-only after construction, so lookups need no lock
+    std::unique_ptr<databento_native::FlatTsSymbolMap> map;
 
-    explicit TsSymbolMapWrapper(std::unique_ptr<db::TsSymbolMap>&& m)
+    explicit TsSymbolMapWrapper(std::unique_ptr<databento_native::FlatTsSymbolMap>&& m)
         : map(std::move(m)) {}
 };
 
 struct PitSymbolMapWrapper {
-    std::unique_ptr<db::PitSymbolMap> map;
+    std::unique_ptr<databento_native::InternedPitSymbolMap> map;
+    std::mutex mutex;  // Guards map between updates and lookups
 
-    explicit PitSymbolMapWrapper(std::unique_ptr<db::PitSymbolMap>&& m)
+    explicit PitSymbolMapWrapper(std::unique_ptr<databento_native::InternedPitSymbolMap>&& m)
         : map(std::move(m)) {}
 };
 
@@ -41,6 +50,42 @@ struct MetadataWrapper {
 // Helper Functions
 // ============================================================================
 
+// Bulk lookups return the found count as an int, so their input is capped to fit it
+static bool ValidateBulkCount(size_t count, char* error_buffer, size_t error_buffer_size)
+{
+    if (count > static_cast<size_t>(INT_MAX)) {
+        SafeStrCopy(error_buffer, error_buffer_size, "Count exceeds INT_MAX entries");
+        return false;
+    }
+    return true;
+}
+
+// Copy symbols [first_index, end) of a bulk lookup table into a caller buffer
+static int CopySymbolTable(
+    const databento_native::FlatTsSymbolMap& map,
+    size_t first_index,
+    char* buffer,
+    size_t buffer_size,
+    size_t* symbol_count,
+    size_t* required_size)
+{
+    size_t first = std::min(first_index, map.SymbolCount());
+    std::string_view packed = map.PackedSymbols(first);
+    if (required_size) {
+        *required_size = packed.size();
+    }
+    if (symbol_count) {
+        *symbol_count = map.SymbolCount() - first;
+    }
+    if (packed.size() > buffer_size || (!buffer && !packed.empty())) {
+        return -3;  // Buffer too small
+    }
+    if (!packed.empty()) {
+        std::memcpy(buffer, packed.data(), packed.size());
+    }
+    return 0;
+}
+
 // ============================================================================
 // TsSymbolMap API Implementation
 // ============================================================================
@@ -60,10 +105,13 @@ DATABENTO_API DbentoTsSymbolMapHandle dbento_metadata_create_symbol_map(
             return nullptr;
         }
 
-        auto symbol_map = std::make_unique<db::TsSymbolMap>(metadata_wrapper->metadata);
-        auto* wrapper = new TsSymbolMapWrapper(std::move(symbol_map));
+        // databento::TsSymbolMap expands the metadata's intervals into daily entries,
+        // which the flat map compacts again; the tree map is dropped afterwards
+        db::TsSymbolMap source{metadata_wrapper->metadata};
+        auto symbol_map = std::make_unique<databento_native::FlatTsSymbolMap>(source);
+        auto wrapper = std::make_unique<TsSymbolMapWrapper>(std::move(symbol_map));
         return reinterpret_cast<DbentoTsSymbolMapHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::TsSymbolMap, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::TsSymbolMap, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -122,14 +170,41 @@ DATABENTO_API int dbento_ts_symbol_map_find(
             date::year{year} / date::month{month} / date::day{day}
         };
 
-        // Find in map
-        auto it = wrapper->map->Find(ymd, instrument_id);
-        if (it == wrapper->map->Map().end()) {
+        int32_t symbol = wrapper->map->Find(ymd, instrument_id);
+        if (symbol < 0) {
             return -2; // Not found
         }
 
         // Copy symbol to buffer
-        SafeStrCopy(symbol_buffer, symbol_buffer_size, it->second->c_str());
+        SafeStrCopy(symbol_buffer, symbol_buffer_size,
+            wrapper->map->Symbol(static_cast<uint32_t>(symbol)));
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_ts_symbol_map_find_ts(
+    DbentoTsSymbolMapHandle handle,
+    uint64_t ts_event,
+    uint32_t instrument_id,
+    char* symbol_buffer,
+    size_t symbol_buffer_size)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map) {
+            return -1;
+        }
+
+        int32_t symbol = wrapper->map->FindTs(ts_event, instrument_id);
+        if (symbol < 0) {
+            return -2; // Not found
+        }
+        SafeStrCopy(symbol_buffer, symbol_buffer_size,
+            wrapper->map->Symbol(static_cast<uint32_t>(symbol)));
         return 0;
     }
     catch (...) {
@@ -137,6 +212,188 @@ DATABENTO_API int dbento_ts_symbol_map_find(
     }
 }
 
+DATABENTO_API int dbento_ts_symbol_map_find_bulk(
+    DbentoTsSymbolMapHandle handle,
+    const uint64_t* ts_events,
+    const uint32_t* instrument_ids,
+    size_t count,
+    int32_t* symbol_indices,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (count > 0 && (!ts_events || !instrument_ids || !symbol_indices)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Input and output arrays cannot be null");
+            return -1;
+        }
+        if (!ValidateBulkCount(count, error_buffer, error_buffer_size)) {
+            return -1;
+        }
+
+        const auto& map = *wrapper->map;
+        int found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            symbol_indices[i] = map.FindTs(ts_events[i], instrument_ids[i]);
+            found += symbol_indices[i] >= 0 ? 1 : 0;
+        }
+        return found;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_ts_symbol_map_find_instrument_id(
+    DbentoTsSymbolMapHandle handle,
+    int year,
+    unsigned int month,
+    unsigned int day,
+    const char* symbol,
+    uint32_t* instrument_id)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map || !symbol || !instrument_id) {
+            return -1;
+        }
+
+        date::year_month_day ymd{
+            date::year{year} / date::month{month} / date::day{day}
+        };
+        return wrapper->map->FindInstrument(symbol, ymd, instrument_id) ? 0 : -2;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_ts_symbol_map_find_instrument_ids(
+    DbentoTsSymbolMapHandle handle,
+    const uint64_t* ts_events,
+    const char* const* symbols,
+    size_t count,
+    int64_t* instrument_ids,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (count > 0 && (!ts_events || !symbols || !instrument_ids)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Input and output arrays cannot be null");
+            return -1;
+        }
+        if (!ValidateBulkCount(count, error_buffer, error_buffer_size)) {
+            return -1;
+        }
+
+        const auto& map = *wrapper->map;
+        int found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t instrument_id;
+            if (symbols[i] && map.FindInstrumentTs(symbols[i], ts_events[i], &instrument_id)) {
+                instrument_ids[i] = instrument_id;
+                ++found;
+            } else {
+                instrument_ids[i] = -1;
+            }
+        }
+        return found;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_ts_symbol_map_get_symbols(
+    DbentoTsSymbolMapHandle handle,
+    size_t first_index,
+    char* buffer,
+    size_t buffer_size,
+    size_t* symbol_count,
+    size_t* required_size)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map) {
+            return -1;
+        }
+        return CopySymbolTable(*wrapper->map, first_index, buffer, buffer_size, symbol_count, required_size);
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_ts_symbol_map_save(
+    DbentoTsSymbolMapHandle handle,
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<TsSymbolMapWrapper>(
+            handle, databento_native::HandleType::TsSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return -1;
+        }
+
+        databento_native::SaveSnapshot(*wrapper->map, file_path);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API DbentoTsSymbolMapHandle dbento_ts_symbol_map_load(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+
+        // Lookups read the mapped file in place; it stays mapped until the handle is destroyed
+        auto wrapper = std::make_unique<TsSymbolMapWrapper>(databento_native::LoadTsSnapshot(file_path));
+        return reinterpret_cast<DbentoTsSymbolMapHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::TsSymbolMap, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
 DATABENTO_API void dbento_ts_symbol_map_destroy(DbentoTsSymbolMapHandle handle)
 {
     try {
@@ -179,10 +436,11 @@ DATABENTO_API DbentoPitSymbolMapHandle dbento_metadata_create_symbol_map_for_dat
             date::year{year} / date::month{month} / date::day{day}
         };
 
-        auto symbol_map = std::make_unique<db::PitSymbolMap>(metadata_wrapper->metadata, ymd);
-        auto* wrapper = new PitSymbolMapWrapper(std::move(symbol_map));
+        db::PitSymbolMap source{metadata_wrapper->metadata, ymd};
+        auto symbol_map = std::make_unique<databento_native::InternedPitSymbolMap>(source);
+        auto wrapper = std::make_unique<PitSymbolMapWrapper>(std::move(symbol_map));
         return reinterpret_cast<DbentoPitSymbolMapHandle>(
-            databento_native::CreateValidatedHandle(databento_native::HandleType::PitSymbolMap, wrapper));
+            databento_native::CreateValidatedHandle(databento_native::HandleType::PitSymbolMap, std::move(wrapper)));
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -198,6 +456,7 @@ DATABENTO_API int dbento_pit_symbol_map_is_empty(DbentoPitSymbolMapHandle handle
         if (!wrapper || !wrapper->map) {
             return -1;
         }
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
         return wrapper->map->IsEmpty() ? 1 : 0;
     }
     catch (...) {
@@ -213,6 +472,7 @@ DATABENTO_API size_t dbento_pit_symbol_map_size(DbentoPitSymbolMapHandle handle)
         if (!wrapper || !wrapper->map) {
             return 0;
         }
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
         return wrapper->map->Size();
     }
     catch (...) {
@@ -233,14 +493,195 @@ DATABENTO_API int dbento_pit_symbol_map_find(
             return -1;
         }
 
-        // Find in map
-        auto it = wrapper->map->Find(instrument_id);
-        if (it == wrapper->map->Map().end()) {
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        const auto* entry = wrapper->map->Find(instrument_id);
+        if (!entry) {
             return -2; // Not found
         }
 
         // Copy symbol to buffer
-        SafeStrCopy(symbol_buffer, symbol_buffer_size, it->second.c_str());
+        SafeStrCopy(symbol_buffer, symbol_buffer_size, wrapper->map->Symbol(entry->symbol_id)->c_str());
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_find_id(
+    DbentoPitSymbolMapHandle handle,
+    uint32_t instrument_id,
+    uint32_t* symbol_id)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map || !symbol_id) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        const auto* entry = wrapper->map->Find(instrument_id);
+        if (!entry) {
+            return -2; // Not found
+        }
+        *symbol_id = entry->symbol_id;
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_find_bulk(
+    DbentoPitSymbolMapHandle handle,
+    const uint32_t* instrument_ids,
+    size_t count,
+    int32_t* symbol_ids,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (count > 0 && (!instrument_ids || !symbol_ids)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Input and output arrays cannot be null");
+            return -1;
+        }
+        if (!ValidateBulkCount(count, error_buffer, error_buffer_size)) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        // Consecutive records often share an instrument
+        uint32_t last_instrument_id = 0;
+        int32_t last_symbol_id = -1;
+        bool have_last = false;
+        int found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!have_last || instrument_ids[i] != last_instrument_id) {
+                const auto* entry = wrapper->map->Find(instrument_ids[i]);
+                last_symbol_id = entry ? static_cast<int32_t>(entry->symbol_id) : -1;
+                last_instrument_id = instrument_ids[i];
+                have_last = true;
+            }
+            symbol_ids[i] = last_symbol_id;
+            found += last_symbol_id >= 0 ? 1 : 0;
+        }
+        return found;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_find_instrument_id(
+    DbentoPitSymbolMapHandle handle,
+    const char* symbol,
+    uint32_t* instrument_id)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map || !symbol || !instrument_id) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        return wrapper->map->FindInstrument(symbol, instrument_id) ? 0 : -2;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_find_instrument_ids(
+    DbentoPitSymbolMapHandle handle,
+    const char* const* symbols,
+    size_t count,
+    int64_t* instrument_ids,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (count > 0 && (!symbols || !instrument_ids)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Input and output arrays cannot be null");
+            return -1;
+        }
+        if (!ValidateBulkCount(count, error_buffer, error_buffer_size)) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        int found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t instrument_id;
+            if (symbols[i] && wrapper->map->FindInstrument(symbols[i], &instrument_id)) {
+                instrument_ids[i] = instrument_id;
+                ++found;
+            } else {
+                instrument_ids[i] = -1;
+            }
+        }
+        return found;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_get_symbols(
+    DbentoPitSymbolMapHandle handle,
+    const int32_t* symbol_ids,
+    size_t count,
+    char* buffer,
+    size_t buffer_size,
+    size_t* required_size)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map || (count > 0 && !symbol_ids)) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        size_t needed = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const std::string* symbol = wrapper->map->Symbol(static_cast<uint32_t>(symbol_ids[i]));
+            needed += (symbol ? symbol->size() : 0) + 1;
+        }
+        if (required_size) {
+            *required_size = needed;
+        }
+        if (needed > buffer_size || (!buffer && needed > 0)) {
+            return -3;  // Buffer too small
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const std::string* symbol = wrapper->map->Symbol(static_cast<uint32_t>(symbol_ids[i]));
+            size_t length = symbol ? symbol->size() : 0;
+            if (length > 0) {
+                std::memcpy(buffer, symbol->data(), length);
+            }
+            buffer[length] = '\0';
+            buffer += length + 1;
+        }
         return 0;
     }
     catch (...) {
@@ -260,23 +701,121 @@ DATABENTO_API int dbento_pit_symbol_map_on_record(
             return -1;
         }
 
-        // Create Record from bytes (Record constructor requires mutable pointer)
-        // Copy data to mutable buffer to avoid const_cast undefined behavior
-        std::vector<uint8_t> mutable_copy(record_bytes, record_bytes + record_length);
-        db::Record record(reinterpret_cast<db::RecordHeader*>(mutable_copy.data()));
+        // The map reads the fields it needs straight from the caller's buffer
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        wrapper->map->OnRecord(record_bytes, record_length);
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
 
-        // SAFETY: OnRecord processes the record synchronously and does not store
-        // the pointer. The mutable_copy vector remains alive until after OnRecord
-        // returns, ensuring no use-after-free. This is safe by design of databento-cpp.
-        wrapper->map->OnRecord(record);
+DATABENTO_API int64_t dbento_pit_symbol_map_on_records(
+    DbentoPitSymbolMapHandle handle,
+    const uint8_t* records,
+    size_t length,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!records && length > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Records buffer cannot be null");
+            return -1;
+        }
 
-        return 0;
+        // One lock for the whole batch; records are read in place
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        return static_cast<int64_t>(wrapper->map->OnRecords(records, length));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
     }
     catch (...) {
+        SafeStrCopy(error_buffer, error_buffer_size, "Unknown error");
         return -1;
     }
 }
 
+DATABENTO_API int64_t dbento_pit_symbol_map_evict_expired(
+    DbentoPitSymbolMapHandle handle,
+    uint64_t now_ns)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, nullptr);
+        if (!wrapper || !wrapper->map) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        return static_cast<int64_t>(wrapper->map->EvictExpired(now_ns));
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_pit_symbol_map_save(
+    DbentoPitSymbolMapHandle handle,
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<PitSymbolMapWrapper>(
+            handle, databento_native::HandleType::PitSymbolMap, &validation_error);
+        if (!wrapper || !wrapper->map) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+        databento_native::SaveSnapshot(*wrapper->map, file_path);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API DbentoPitSymbolMapHandle dbento_pit_symbol_map_load(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+
+        auto wrapper = std::make_unique<PitSymbolMapWrapper>(databento_native::LoadPitSnapshot(file_path));
+        return reinterpret_cast<DbentoPitSymbolMapHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::PitSymbolMap, std::move(wrapper)));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
 DATABENTO_API void dbento_pit_symbol_map_destroy(DbentoPitSymbolMapHandle handle)
 {
     try {
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Append-only table of distinct symbols, each with a stable index
+ *
+ * Used to number symbols densely while building a map. Not thread-safe.
+ */
+class SymbolTable {
+public:
+    /**
+     * Index of `symbol`, adding it to the table if new
+     */
+    uint32_t Intern(std::string_view symbol) {
+        auto it = ids_.find(symbol);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+        auto id = static_cast<uint32_t>(symbols_.size());
+        // Deque elements never move, so the key can view the stored string
+        const std::string& stored = symbols_.emplace_back(symbol);
+        ids_.emplace(std::string_view{stored}, id);
+        return id;
+    }
+
+    const std::string& At(uint32_t id) const { return symbols_.at(id); }
+
+    size_t Size() const { return symbols_.size(); }
+
+private:
+    std::deque<std::string> symbols_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+/**
+ * Reference-counted interned symbols with stable integer IDs
+ *
+ * Each distinct symbol is stored once; maps hold its ID and compare IDs instead of
+ * strings. A symbol is freed when its last reference is released, and its slot is
+ * reused under a new generation, so an ID never names two different symbols: callers
+ * may cache the string for an ID for as long as they like. A slot whose generation
+ * counter is exhausted is retired rather than reused. IDs are below 2^31, so they fit
+ * in an int32_t. Not thread-safe.
+ */
+class InternedSymbolTable {
+public:
+    static constexpr uint32_t kSlotBits = 24;
+    static constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1;
+    static constexpr uint32_t kMaxGeneration = (1u << (31 - kSlotBits)) - 1;
+
+    /**
+     * ID of `symbol` with one more reference, interning it if new
+     */
+    uint32_t Acquire(std::string_view symbol) {
+        auto it = ids_.find(symbol);
+        if (it != ids_.end()) {
+            ++slots_[it->second & kSlotMask].refs;
+            return it->second;
+        }
+        uint32_t slot_index;
+        if (!free_.empty()) {
+            slot_index = free_.back();
+            free_.pop_back();
+        } else {
+            if (slots_.size() > kSlotMask) {
+                throw std::length_error("Symbol table is full");
+            }
+            slot_index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        Slot& slot = slots_[slot_index];
+        slot.symbol.assign(symbol);
+        slot.refs = 1;
+        uint32_t id = (slot.generation << kSlotBits) | slot_index;
+        // Deque elements never move, so the key can view the stored string
+        ids_.emplace(std::string_view{slot.symbol}, id);
+        return id;
+    }
+
+    /**
+     * Drop a reference; the symbol is freed with its last reference
+     */
+    void Release(uint32_t id) {
+        auto* slot = const_cast<Slot*>(Live(id));
+        if (!slot || --slot->refs > 0) {
+            return;
+        }
+        ids_.erase(std::string_view{slot->symbol});
+        std::string{}.swap(slot->symbol);
+        if (slot->generation < kMaxGeneration) {
+            ++slot->generation;
+            free_.push_back(id & kSlotMask);
+        }
+    }
+
+    /**
+     * Symbol for `id`, or nullptr if it has been freed
+     */
+    const std::string* Find(uint32_t id) const {
+        const Slot* slot = Live(id);
+        return slot ? &slot->symbol : nullptr;
+    }
+
+    /**
+     * ID of an interned symbol without taking a reference
+     * @return false if the symbol is not interned
+     */
+    bool FindId(std::string_view symbol, uint32_t* id) const {
+        auto it = ids_.find(symbol);
+        if (it == ids_.end()) {
+            return false;
+        }
+        *id = it->second;
+        return true;
+    }
+
+    // Number of live symbols
+    size_t Size() const { return ids_.size(); }
+
+private:
+    struct Slot {
+        std::string symbol;
+        uint32_t refs = 0;
+        uint32_t generation = 0;
+    };
+
+    const Slot* Live(uint32_t id) const {
+        uint32_t slot_index = id & kSlotMask;
+        if (slot_index >= slots_.size()) {
+            return nullptr;
+        }
+        const Slot& slot = slots_[slot_index];
+        if (slot.refs == 0 || slot.generation != id >> kSlotBits) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    std::deque<Slot> slots_;
+    std::vector<uint32_t> free_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+}  // namespace databento_native
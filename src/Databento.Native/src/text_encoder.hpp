@@ -0,0 +1,566 @@
+#pragma once
+
+#include "record_fields.hpp"
+#include "record_utils.hpp"
+#include <databento/constants.hpp>
+#include <databento/datetime.hpp>
+#include <databento/dbn.hpp>
+#include <databento/record.hpp>
+#include <databento/symbol_map.hpp>
+#include <nlohmann/json.hpp>
+#include <date/date.h>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+namespace detail {
+
+template <typename T>
+T LoadField(const uint8_t* record, size_t offset) {
+    T value;
+    std::memcpy(&value, record + offset, sizeof(T));
+    return value;
+}
+
+inline void AppendUnsigned(std::string* out, uint64_t value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out->append(digits, result.ptr);
+}
+
+inline void AppendSigned(std::string* out, int64_t value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out->append(digits, result.ptr);
+}
+
+// Zero-padded decimal of exactly `width` digits
+inline void AppendPadded(std::string* out, uint64_t value, size_t width) {
+    char digits[24];
+    for (size_t i = width; i > 0; --i) {
+        digits[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    out->append(digits, width);
+}
+
+/**
+ * Fixed-point price with 9 decimals, e.g. 4512.250000000
+ */
+inline void AppendPrettyPrice(std::string* out, int64_t price) {
+    uint64_t magnitude = static_cast<uint64_t>(price);
+    if (price < 0) {
+        out->push_back('-');
+        magnitude = ~magnitude + 1;  // Also correct for INT64_MIN
+    }
+    AppendUnsigned(out, magnitude / databento::kFixedPriceScale);
+    out->push_back('.');
+    AppendPadded(out, magnitude % databento::kFixedPriceScale, 9);
+}
+
+/**
+ * ISO 8601 UTC timestamp with nanoseconds, e.g. 2024-01-02T14:30:00.123456789Z
+ */
+inline void AppendPrettyTimestamp(std::string* out, uint64_t ns) {
+    constexpr uint64_t kNanosPerSecond = 1'000'000'000ULL;
+    uint64_t seconds = ns / kNanosPerSecond;
+    uint64_t days = seconds / 86400;
+    uint64_t second_of_day = seconds % 86400;
+
+    // Civil date from days since 1970-01-01 (H. Hinnant's algorithm)
+    uint64_t z = days + 719468;
+    uint64_t era = z / 146097;
+    uint64_t doe = z - era * 146097;
+    uint64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint64_t mp = (5 * doy + 2) / 153;
+    uint64_t day = doy - (153 * mp + 2) / 5 + 1;
+    uint64_t month = mp < 10 ? mp + 3 : mp - 9;
+    uint64_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+
+    AppendPadded(out, year, 4);
+    out->push_back('-');
+    AppendPadded(out, month, 2);
+    out->push_back('-');
+    AppendPadded(out, day, 2);
+    out->push_back('T');
+    AppendPadded(out, second_of_day / 3600, 2);
+    out->push_back(':');
+    AppendPadded(out, second_of_day / 60 % 60, 2);
+    out->push_back(':');
+    AppendPadded(out, second_of_day % 60, 2);
+    out->push_back('.');
+    AppendPadded(out, ns % kNanosPerSecond, 9);
+    out->push_back('Z');
+}
+
+inline void AppendCsvString(std::string* out, const char* text, size_t length) {
+    bool quote = false;
+    for (size_t i = 0; i < length && !quote; ++i) {
+        char c = text[i];
+        quote = c == ',' || c == '"' || c == '\n' || c == '\r';
+    }
+    if (!quote) {
+        out->append(text, length);
+        return;
+    }
+    out->push_back('"');
+    for (size_t i = 0; i < length; ++i) {
+        if (text[i] == '"') {
+            out->push_back('"');
+        }
+        out->push_back(text[i]);
+    }
+    out->push_back('"');
+}
+
+inline void AppendJsonString(std::string* out, const char* text, size_t length) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    out->push_back('"');
+    for (size_t i = 0; i < length; ++i) {
+        auto c = static_cast<unsigned char>(text[i]);
+        if (c == '"' || c == '\\') {
+            out->push_back('\\');
+            out->push_back(static_cast<char>(c));
+        } else if (c < 0x20) {
+            out->append("\\u00");
+            out->push_back(kHex[c >> 4]);
+            out->push_back(kHex[c & 0xF]);
+        } else {
+            out->push_back(static_cast<char>(c));
+        }
+    }
+    out->push_back('"');
+}
+
+}  // namespace detail
+
+enum class TextFormat : uint8_t {
+    Csv = 0,
+    Json = 1  // JSON Lines: one object per record
+};
+
+struct TextEncodeOptions {
+    TextFormat format = TextFormat::Csv;
+    bool pretty_px = false;    // Prices as decimals instead of fixed-point integers
+    bool pretty_ts = false;    // Timestamps as ISO 8601 instead of epoch nanoseconds
+    bool map_symbols = false;  // Append the symbol of each record's instrument
+    bool csv_header = true;
+
+    /**
+     * {"encoding": "csv" | "json", "pretty_px": bool, "pretty_ts": bool,
+     *  "map_symbols": bool, "header": bool}
+     */
+    static TextEncodeOptions FromJson(const char* options_json) {
+        TextEncodeOptions options;
+        if (!options_json || options_json[0] == '\0') {
+            return options;
+        }
+        nlohmann::json j = nlohmann::json::parse(options_json);
+        if (!j.is_object()) {
+            throw std::invalid_argument("Text options must be a JSON object");
+        }
+        if (j.contains("encoding") && !j["encoding"].is_null()) {
+            std::string encoding = j["encoding"].get<std::string>();
+            if (encoding == "csv") {
+                options.format = TextFormat::Csv;
+            } else if (encoding == "json") {
+                options.format = TextFormat::Json;
+            } else {
+                throw std::invalid_argument("Unknown text encoding: " + encoding);
+            }
+        }
+        options.pretty_px = j.value("pretty_px", options.pretty_px);
+        options.pretty_ts = j.value("pretty_ts", options.pretty_ts);
+        options.map_symbols = j.value("map_symbols", options.map_symbols);
+        options.csv_header = j.value("header", options.csv_header);
+        return options;
+    }
+};
+
+/**
+ * Instrument ID to symbol, from file metadata or from the symbol mappings of a live stream
+ *
+ * With metadata mappings, lookups use the UTC date of the record's index timestamp.
+ * Without them, symbol mapping records seen by OnRecord are applied as they arrive.
+ */
+class TextSymbolResolver {
+public:
+    TextSymbolResolver() = default;
+
+    explicit TextSymbolResolver(const databento::Metadata& metadata) {
+        if (!metadata.mappings.empty()) {
+            ts_map_ = std::make_unique<databento::TsSymbolMap>(metadata);
+        }
+    }
+
+    void OnRecord(const databento::Record& record) {
+        if (!ts_map_ && record.RType() == databento::RType::SymbolMapping) {
+            pit_map_.OnRecord(record);
+        }
+    }
+
+    const std::string* Find(const databento::Record& record) const {
+        uint32_t instrument_id = record.Header().instrument_id;
+        if (ts_map_) {
+            constexpr uint64_t kNanosPerDay = 86'400'000'000'000ULL;
+            date::year_month_day day{date::sys_days{date::days{RecordIndexTs(record) / kNanosPerDay}}};
+            auto it = ts_map_->Find(day, instrument_id);
+            return it == ts_map_->Map().end() ? nullptr : it->second.get();
+        }
+        auto it = pit_map_.Find(instrument_id);
+        return it == pit_map_.Map().end() ? nullptr : &it->second;
+    }
+
+private:
+    std::unique_ptr<databento::TsSymbolMap> ts_map_;
+    databento::PitSymbolMap pit_map_;
+};
+
+/**
+ * Formats DBN v3 records as CSV rows or JSON lines without locale or iostreams
+ *
+ * CSV output has one column set, taken from the first record with a layout; records
+ * of other types are skipped. JSON lines are self-describing, so every record type
+ * with a layout is written. 64-bit integers are quoted in JSON so they survive
+ * parsers that read numbers as doubles. Undefined prices and timestamps are empty
+ * in CSV and null in JSON.
+ */
+class RecordTextEncoder {
+public:
+    /**
+     * @param ts_out Records carry a trailing ts_out (from the metadata or live session)
+     * @param symbols Symbol source; required when options.map_symbols is set
+     */
+    RecordTextEncoder(const TextEncodeOptions& options, bool ts_out, std::shared_ptr<TextSymbolResolver> symbols)
+        : options_(options), ts_out_(ts_out), symbols_(std::move(symbols))
+    {
+        if (options_.map_symbols && !symbols_) {
+            throw std::invalid_argument("Symbol mapping requires a symbol source");
+        }
+    }
+
+    /**
+     * Pin the CSV column set (e.g. to continue output started by another encoder)
+     * @param write_header Whether the next Encode call still writes the header row
+     */
+    void SetCsvLayout(const RecordLayout* layout, bool write_header) {
+        csv_layout_ = layout;
+        header_pending_ = write_header && options_.csv_header;
+    }
+
+    const RecordLayout* CsvLayout() const { return csv_layout_; }
+
+    /**
+     * Append one record as a line
+     * @return false if the record was skipped (no layout, wrong type for CSV, or truncated)
+     */
+    bool Encode(const databento::Record& record, std::string* out) {
+        if (symbols_) {
+            symbols_->OnRecord(record);
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&record.Header());
+        const RecordLayout* layout = RecordLayoutFor(bytes[1]);
+        size_t size = record.Size();
+        if (!layout || size < layout->record_size + (ts_out_ ? sizeof(uint64_t) : 0)) {
+            return false;
+        }
+        if (options_.format == TextFormat::Csv) {
+            if (!csv_layout_) {
+                SetCsvLayout(layout, true);
+            }
+            if (layout != csv_layout_) {
+                return false;
+            }
+            if (header_pending_) {
+                AppendCsvHeader(*layout, out);
+                header_pending_ = false;
+            }
+            AppendCsvRow(*layout, record, bytes, size, out);
+        } else {
+            AppendJsonLine(*layout, record, bytes, size, out);
+        }
+        return true;
+    }
+
+    /**
+     * Append the CSV header row for a layout
+     */
+    void AppendCsvHeader(const RecordLayout& layout, std::string* out) const {
+        for (size_t i = 0; i < layout.fields.size(); ++i) {
+            if (i > 0) {
+                out->push_back(',');
+            }
+            out->append(layout.fields[i].name);
+        }
+        if (ts_out_) {
+            out->append(",ts_out");
+        }
+        if (options_.map_symbols) {
+            out->append(",symbol");
+        }
+        out->push_back('\n');
+    }
+
+private:
+    void AppendCsvRow(const RecordLayout& layout, const databento::Record& record, const uint8_t* bytes,
+                      size_t size, std::string* out) const {
+        for (size_t i = 0; i < layout.fields.size(); ++i) {
+            if (i > 0) {
+                out->push_back(',');
+            }
+            AppendValue(layout.fields[i], bytes, out);
+        }
+        if (ts_out_) {
+            out->push_back(',');
+            AppendTimestamp(detail::LoadField<uint64_t>(bytes, size - sizeof(uint64_t)), out);
+        }
+        if (options_.map_symbols) {
+            out->push_back(',');
+            if (const std::string* symbol = symbols_->Find(record)) {
+                detail::AppendCsvString(out, symbol->data(), symbol->size());
+            }
+        }
+        out->push_back('\n');
+    }
+
+    void AppendJsonLine(const RecordLayout& layout, const databento::Record& record, const uint8_t* bytes,
+                        size_t size, std::string* out) const {
+        out->push_back('{');
+        bool in_header = false;
+        bool first = true;
+        for (const RecordField& field : layout.fields) {
+            if (field.in_header != in_header) {
+                if (field.in_header) {
+                    if (!first) {
+                        out->push_back(',');
+                    }
+                    out->append("\"hd\":{");
+                    first = true;
+                } else {
+                    out->push_back('}');
+                    first = false;
+                }
+                in_header = field.in_header;
+            }
+            if (!first) {
+                out->push_back(',');
+            }
+            first = false;
+            out->push_back('"');
+            out->append(field.name);
+            out->append("\":");
+            AppendValue(field, bytes, out);
+        }
+        if (in_header) {
+            out->push_back('}');
+        }
+        if (ts_out_) {
+            out->append(",\"ts_out\":");
+            AppendTimestamp(detail::LoadField<uint64_t>(bytes, size - sizeof(uint64_t)), out);
+        }
+        if (options_.map_symbols) {
+            out->append(",\"symbol\":");
+            if (const std::string* symbol = symbols_->Find(record)) {
+                detail::AppendJsonString(out, symbol->data(), symbol->size());
+            } else {
+                out->append("null");
+            }
+        }
+        out->append("}\n");
+    }
+
+    void AppendUndefined(std::string* out) const {
+        if (options_.format == TextFormat::Json) {
+            out->append("null");
+        }
+    }
+
+    void AppendTimestamp(uint64_t ns, std::string* out) const {
+        bool json = options_.format == TextFormat::Json;
+        if (ns == databento::kUndefTimestamp) {
+            AppendUndefined(out);
+            return;
+        }
+        if (json) {
+            out->push_back('"');
+        }
+        if (options_.pretty_ts) {
+            detail::AppendPrettyTimestamp(out, ns);
+        } else {
+            detail::AppendUnsigned(out, ns);
+        }
+        if (json) {
+            out->push_back('"');
+        }
+    }
+
+    void AppendValue(const RecordField& field, const uint8_t* bytes, std::string* out) const {
+        bool json = options_.format == TextFormat::Json;
+        switch (field.kind) {
+            case FieldKind::UInt: {
+                uint64_t value = 0;
+                switch (field.width) {
+                    case 1: value = bytes[field.offset]; break;
+                    case 2: value = detail::LoadField<uint16_t>(bytes, field.offset); break;
+                    case 4: value = detail::LoadField<uint32_t>(bytes, field.offset); break;
+                    default: value = detail::LoadField<uint64_t>(bytes, field.offset); break;
+                }
+                bool quote = json && field.width == 8;
+                if (quote) {
+                    out->push_back('"');
+                }
+                detail::AppendUnsigned(out, value);
+                if (quote) {
+                    out->push_back('"');
+                }
+                break;
+            }
+            case FieldKind::Int: {
+                int64_t value = 0;
+                switch (field.width) {
+                    case 1: value = static_cast<int8_t>(bytes[field.offset]); break;
+                    case 2: value = detail::LoadField<int16_t>(bytes, field.offset); break;
+                    case 4: value = detail::LoadField<int32_t>(bytes, field.offset); break;
+                    default: value = detail::LoadField<int64_t>(bytes, field.offset); break;
+                }
+                bool quote = json && field.width == 8;
+                if (quote) {
+                    out->push_back('"');
+                }
+                detail::AppendSigned(out, value);
+                if (quote) {
+                    out->push_back('"');
+                }
+                break;
+            }
+            case FieldKind::Price: {
+                auto price = detail::LoadField<int64_t>(bytes, field.offset);
+                if (price == databento::kUndefPrice) {
+                    AppendUndefined(out);
+                    break;
+                }
+                if (json) {
+                    out->push_back('"');
+                }
+                if (options_.pretty_px) {
+                    detail::AppendPrettyPrice(out, price);
+                } else {
+                    detail::AppendSigned(out, price);
+                }
+                if (json) {
+                    out->push_back('"');
+                }
+                break;
+            }
+            case FieldKind::Timestamp:
+                AppendTimestamp(detail::LoadField<uint64_t>(bytes, field.offset), out);
+                break;
+            case FieldKind::Char: {
+                char c = static_cast<char>(bytes[field.offset]);
+                size_t length = c == '\0' ? 0 : 1;
+                if (json) {
+                    detail::AppendJsonString(out, &c, length);
+                } else {
+                    detail::AppendCsvString(out, &c, length);
+                }
+                break;
+            }
+            case FieldKind::CString: {
+                const auto* text = reinterpret_cast<const char*>(bytes + field.offset);
+                size_t length = ::strnlen(text, field.width);
+                if (json) {
+                    detail::AppendJsonString(out, text, length);
+                } else {
+                    detail::AppendCsvString(out, text, length);
+                }
+                break;
+            }
+        }
+    }
+
+    TextEncodeOptions options_;
+    bool ts_out_;
+    std::shared_ptr<TextSymbolResolver> symbols_;
+    const RecordLayout* csv_layout_ = nullptr;
+    bool header_pending_ = false;
+};
+
+/**
+ * Appends the text of a record stream to a file, in blocks
+ *
+ * Used where records arrive one at a time (live sessions). Text is written once
+ * a block fills or flush_interval has passed since the last write, and on Flush().
+ */
+class TextFileSink {
+public:
+    TextFileSink(const std::filesystem::path& path, const TextEncodeOptions& options, bool ts_out,
+                 std::chrono::milliseconds flush_interval = std::chrono::milliseconds{100})
+        : encoder_(options, ts_out, options.map_symbols ? std::make_shared<TextSymbolResolver>() : nullptr)
+        , out_(path, std::ios::binary | std::ios::trunc)
+        , flush_interval_(flush_interval)
+        , last_flush_(std::chrono::steady_clock::now())
+    {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+        buffer_.reserve(kBlockSize);
+    }
+
+    ~TextFileSink() {
+        try {
+            Flush();
+        }
+        catch (...) {
+            // Destructors must not throw; call Flush() explicitly to observe errors
+        }
+    }
+
+    TextFileSink(const TextFileSink&) = delete;
+    TextFileSink& operator=(const TextFileSink&) = delete;
+
+    void Write(const databento::Record& record) {
+        encoder_.Encode(record, &buffer_);
+        if (buffer_.size() >= kBlockSize || std::chrono::steady_clock::now() - last_flush_ >= flush_interval_) {
+            Flush();
+        }
+    }
+
+    void Flush() {
+        if (!buffer_.empty()) {
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+        out_.flush();
+        last_flush_ = std::chrono::steady_clock::now();
+        if (!out_.good()) {
+            throw std::runtime_error("Failed to write text output");
+        }
+    }
+
+private:
+    static constexpr size_t kBlockSize = 256 * 1024;
+
+    RecordTextEncoder encoder_;
+    std::ofstream out_;
+    std::string buffer_;
+    std::chrono::milliseconds flush_interval_;
+    std::chrono::steady_clock::time_point last_flush_;
+};
+
+}  // namespace databento_native
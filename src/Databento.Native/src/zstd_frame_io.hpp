@@ -0,0 +1,647 @@
+#pragma once
+
+#include "mapped_file.hpp"
+#include <databento/ireadable.hpp>
+#include <databento/iwritable.hpp>
+#include <zstd.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+constexpr uint32_t kZstdFrameMagic = 0xFD2FB528;
+// Default uncompressed bytes per independent frame written by FramedZstdWritable
+constexpr size_t kDefaultZstdFrameSize = 4 * 1024 * 1024;
+
+/**
+ * Location of one zstd frame within a compressed file
+ */
+struct ZstdFrame {
+    size_t offset;
+    size_t size;
+};
+
+inline bool StartsWithZstdMagic(const uint8_t* data, size_t size) {
+    if (size < sizeof(uint32_t)) {
+        return false;
+    }
+    uint32_t magic;
+    std::memcpy(&magic, data, sizeof(magic));
+    return magic == kZstdFrameMagic;
+}
+
+/**
+ * Split a zstd stream into its data frames (skippable frames are dropped)
+ * Only frame and block headers are parsed, so this is cheap relative to decompression
+ */
+inline std::vector<ZstdFrame> ScanZstdFrames(const uint8_t* data, size_t size) {
+    std::vector<ZstdFrame> frames;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t frame_size = ZSTD_findFrameCompressedSize(data + pos, size - pos);
+        if (ZSTD_isError(frame_size)) {
+            throw std::runtime_error(std::string("Invalid zstd frame: ") + ZSTD_getErrorName(frame_size));
+        }
+        if (StartsWithZstdMagic(data + pos, size - pos)) {
+            frames.push_back({pos, frame_size});
+        }
+        pos += frame_size;
+    }
+    return frames;
+}
+
+/**
+ * Decompress a single complete zstd frame
+ */
+inline void DecompressZstdFrame(ZSTD_DCtx* dctx, const uint8_t* src, size_t src_size, std::vector<std::byte>* out) {
+    unsigned long long content_size = ZSTD_getFrameContentSize(src, src_size);
+    if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+        throw std::runtime_error("Invalid zstd frame header");
+    }
+
+    if (content_size != ZSTD_CONTENTSIZE_UNKNOWN) {
+        out->resize(static_cast<size_t>(content_size));
+        size_t result = ZSTD_decompressDCtx(dctx, out->data(), out->size(), src, src_size);
+        if (ZSTD_isError(result)) {
+            throw std::runtime_error(std::string("zstd decompression failed: ") + ZSTD_getErrorName(result));
+        }
+        out->resize(result);
+        return;
+    }
+
+    // Streaming writers don't record the content size; grow the output as needed
+    ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+    out->resize(std::max(src_size * 4, ZSTD_DStreamOutSize()));
+    ZSTD_inBuffer input{src, src_size, 0};
+    size_t produced = 0;
+    while (true) {
+        ZSTD_outBuffer output{out->data() + produced, out->size() - produced, 0};
+        size_t result = ZSTD_decompressStream(dctx, &output, &input);
+        if (ZSTD_isError(result)) {
+            throw std::runtime_error(std::string("zstd decompression failed: ") + ZSTD_getErrorName(result));
+        }
+        produced += output.pos;
+        if (result == 0) {
+            break;
+        }
+        if (input.pos == input.size && output.pos < output.size) {
+            throw std::runtime_error("Truncated zstd frame");
+        }
+        if (produced == out->size()) {
+            out->resize(out->size() * 2);
+        }
+    }
+    out->resize(produced);
+}
+
+/**
+ * Compress bytes into a single checksummed zstd frame
+ */
+inline void CompressZstdFrame(const std::byte* src, size_t src_size, int level, std::vector<std::byte>* out) {
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+    if (!cctx) {
+        throw std::bad_alloc();
+    }
+    ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, level);
+    ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_checksumFlag, 1);
+    out->resize(ZSTD_compressBound(src_size));
+    size_t size = ZSTD_compress2(cctx.get(), out->data(), out->size(), src, src_size);
+    if (ZSTD_isError(size)) {
+        throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+    }
+    out->resize(size);
+}
+
+/**
+ * IReadable over a multi-frame zstd file that decompresses frames in parallel
+ *
+ * The compressed file is memory-mapped and split into frames up front. Worker
+ * threads decompress up to two frames per worker ahead of the consumer, and the
+ * decoded bytes are handed out strictly in frame order.
+ */
+class ParallelZstdReadable : public databento::IReadable {
+public:
+    ParallelZstdReadable(std::shared_ptr<const MappedFile> file, std::vector<ZstdFrame> frames, size_t thread_count)
+        : file_(std::move(file))
+        , frames_(std::move(frames))
+        , window_(std::max<size_t>(thread_count, 1) * 2)
+        , slots_(window_)
+    {
+        size_t workers = std::min(std::max<size_t>(thread_count, 1), frames_.size());
+        workers_.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ~ParallelZstdReadable() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ParallelZstdReadable(const ParallelZstdReadable&) = delete;
+    ParallelZstdReadable& operator=(const ParallelZstdReadable&) = delete;
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t read = 0;
+        while (read < length) {
+            size_t n = ReadSome(buffer + read, length - read);
+            if (n == 0) {
+                throw std::runtime_error("Unexpected end of zstd stream");
+            }
+            read += n;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        while (current_pos_ == current_.size()) {
+            if (!AdvanceFrame()) {
+                return 0;
+            }
+        }
+        size_t n = std::min(max_length, current_.size() - current_pos_);
+        std::memcpy(buffer, current_.data() + current_pos_, n);
+        current_pos_ += n;
+        return n;
+    }
+
+private:
+    struct Slot {
+        std::vector<std::byte> data;
+        std::exception_ptr error;
+        bool ready = false;
+    };
+
+    void WorkerLoop() {
+        std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+        std::vector<std::byte> decoded;
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() {
+                    return stopping_ || next_to_schedule_ >= frames_.size() ||
+                           next_to_schedule_ < next_to_consume_ + window_;
+                });
+                if (stopping_ || next_to_schedule_ >= frames_.size()) {
+                    return;
+                }
+                index = next_to_schedule_++;
+            }
+
+            std::exception_ptr error;
+            try {
+                const ZstdFrame& frame = frames_[index];
+                if (!dctx) {
+                    throw std::bad_alloc();
+                }
+                DecompressZstdFrame(dctx.get(), file_->Data() + frame.offset, frame.size, &decoded);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                Slot& slot = slots_[index % window_];
+                slot.data.swap(decoded);
+                slot.error = error;
+                slot.ready = true;
+            }
+            cv_.notify_all();
+        }
+    }
+
+    // Moves the next frame's decoded bytes into current_; false at end of stream
+    bool AdvanceFrame() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (next_to_consume_ >= frames_.size()) {
+            return false;
+        }
+        Slot& slot = slots_[next_to_consume_ % window_];
+        cv_.wait(lock, [&slot]() { return slot.ready; });
+        if (slot.error) {
+            std::rethrow_exception(slot.error);
+        }
+        current_.swap(slot.data);  // Old buffer goes back to the slot for reuse
+        current_pos_ = 0;
+        slot.ready = false;
+        ++next_to_consume_;
+        lock.unlock();
+        cv_.notify_all();
+        return true;
+    }
+
+    std::shared_ptr<const MappedFile> file_;
+    std::vector<ZstdFrame> frames_;
+    size_t window_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Slot> slots_;
+    size_t next_to_schedule_ = 0;
+    size_t next_to_consume_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    // Consumer-only state
+    std::vector<std::byte> current_;
+    size_t current_pos_ = 0;
+};
+
+/**
+ * Open a zstd-compressed file for parallel decompression when it has multiple frames
+ * @return Parallel reader, or nullptr if the file is uncompressed or a single frame
+ */
+inline std::unique_ptr<databento::IReadable> OpenParallelZstd(const std::filesystem::path& path, size_t thread_count) {
+    if (thread_count < 2) {
+        return nullptr;
+    }
+    auto file = std::make_shared<MappedFile>(path);
+    if (!StartsWithZstdMagic(file->Data(), file->Size())) {
+        return nullptr;
+    }
+    auto frames = ScanZstdFrames(file->Data(), file->Size());
+    if (frames.size() < 2) {
+        return nullptr;
+    }
+    file->Advise(MappedAccess::Sequential);
+    return std::make_unique<ParallelZstdReadable>(std::move(file), std::move(frames), thread_count);
+}
+
+/**
+ * IReadable that stream-decompresses a mapped zstd file from a frame boundary
+ *
+ * Tracks where each frame starts both in the file and in the decompressed
+ * (logical) stream, so callers can map a logical offset back to its frame.
+ */
+class ZstdStreamReadable : public databento::IReadable {
+public:
+    /**
+     * @param file Mapped compressed file
+     * @param frame_file_offset File offset of the frame to start decoding from
+     * @param frame_logical_offset Logical offset of that frame's first byte
+     */
+    ZstdStreamReadable(std::shared_ptr<const MappedFile> file, uint64_t frame_file_offset, uint64_t frame_logical_offset)
+        : file_(std::move(file))
+        , dctx_(ZSTD_createDCtx(), &ZSTD_freeDCtx)
+        , input_{file_->Data(), file_->Size(), static_cast<size_t>(frame_file_offset)}
+        , logical_offset_(frame_logical_offset)
+    {
+        if (!dctx_) {
+            throw std::bad_alloc();
+        }
+        if (frame_file_offset > file_->Size()) {
+            throw std::out_of_range("zstd frame offset past end of file");
+        }
+        frame_starts_.push_back({frame_file_offset, frame_logical_offset});
+    }
+
+    ZstdStreamReadable(const ZstdStreamReadable&) = delete;
+    ZstdStreamReadable& operator=(const ZstdStreamReadable&) = delete;
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t read = 0;
+        while (read < length) {
+            size_t n = ReadSome(buffer + read, length - read);
+            if (n == 0) {
+                throw std::runtime_error("Unexpected end of zstd stream");
+            }
+            read += n;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        while (true) {
+            if (input_.pos >= input_.size) {
+                return 0;
+            }
+            ZSTD_outBuffer output{buffer, max_length, 0};
+            size_t result = ZSTD_decompressStream(dctx_.get(), &output, &input_);
+            if (ZSTD_isError(result)) {
+                throw std::runtime_error(std::string("zstd decompression failed: ") + ZSTD_getErrorName(result));
+            }
+            logical_offset_ += output.pos;
+            if (result == 0 && input_.pos < input_.size) {
+                // Frame complete; the next one starts here
+                frame_starts_.push_back({input_.pos, logical_offset_});
+            }
+            if (output.pos > 0) {
+                return output.pos;
+            }
+            if (result != 0 && input_.pos >= input_.size) {
+                throw std::runtime_error("Truncated zstd frame");
+            }
+        }
+    }
+
+    /**
+     * Frame containing a logical offset already produced by this reader
+     * @return (frame file offset, frame logical offset)
+     */
+    std::pair<uint64_t, uint64_t> FrameAt(uint64_t logical_offset) const {
+        auto it = std::upper_bound(frame_starts_.begin(), frame_starts_.end(), logical_offset,
+            [](uint64_t value, const FrameStart& frame) { return value < frame.logical_offset; });
+        const FrameStart& frame = *(it == frame_starts_.begin() ? it : it - 1);
+        return {frame.file_offset, frame.logical_offset};
+    }
+
+private:
+    struct FrameStart {
+        uint64_t file_offset;
+        uint64_t logical_offset;
+    };
+
+    std::shared_ptr<const MappedFile> file_;
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx_;
+    ZSTD_inBuffer input_;
+    uint64_t logical_offset_;
+    std::vector<FrameStart> frame_starts_;
+};
+
+/**
+ * IWritable that zstd-compresses into independent frames of a fixed uncompressed size
+ *
+ * Every frame records its content size, so readers can decompress frames in parallel.
+ * The trailing partial frame is written by Finish() or on destruction.
+ */
+class FramedZstdWritable : public databento::IWritable {
+public:
+    FramedZstdWritable(databento::IWritable* output, int level, size_t frame_size)
+        : output_(output)
+        , frame_size_(frame_size == 0 ? kDefaultZstdFrameSize : frame_size)
+        , cctx_(ZSTD_createCCtx(), &ZSTD_freeCCtx)
+    {
+        if (!cctx_) {
+            throw std::bad_alloc();
+        }
+        size_t result = ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_compressionLevel, level);
+        if (ZSTD_isError(result)) {
+            throw std::invalid_argument(std::string("Invalid zstd compression level: ") + ZSTD_getErrorName(result));
+        }
+        ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_checksumFlag, 1);
+        pending_.reserve(frame_size_);
+    }
+
+    ~FramedZstdWritable() override {
+        try {
+            Finish();
+        }
+        catch (...) {
+            // Destructors must not throw; call Finish() explicitly to observe errors
+        }
+    }
+
+    FramedZstdWritable(const FramedZstdWritable&) = delete;
+    FramedZstdWritable& operator=(const FramedZstdWritable&) = delete;
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        while (length > 0) {
+            size_t n = std::min(length, frame_size_ - pending_.size());
+            pending_.insert(pending_.end(), buffer, buffer + n);
+            buffer += n;
+            length -= n;
+            if (pending_.size() == frame_size_) {
+                WriteFrame();
+            }
+        }
+    }
+
+    /**
+     * Compress and write any buffered bytes as a final frame
+     */
+    void Finish() {
+        if (!pending_.empty()) {
+            WriteFrame();
+        }
+    }
+
+private:
+    void WriteFrame() {
+        compressed_.resize(ZSTD_compressBound(pending_.size()));
+        size_t size = ZSTD_compress2(cctx_.get(), compressed_.data(), compressed_.size(),
+            pending_.data(), pending_.size());
+        if (ZSTD_isError(size)) {
+            throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+        }
+        output_->WriteAll(compressed_.data(), size);
+        pending_.clear();
+    }
+
+    databento::IWritable* output_;
+    size_t frame_size_;
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx_;
+    std::vector<std::byte> pending_;
+    std::vector<std::byte> compressed_;
+};
+
+/**
+ * FramedZstdWritable that compresses frames on worker threads
+ *
+ * Full frames are handed to the workers and written to the output in order by the
+ * calling thread. At most two frames per worker are in flight, which bounds memory.
+ * The output is identical in layout to FramedZstdWritable's.
+ */
+class ParallelFramedZstdWritable : public databento::IWritable {
+public:
+    ParallelFramedZstdWritable(databento::IWritable* output, int level, size_t frame_size, size_t thread_count)
+        : output_(output)
+        , level_(level)
+        , frame_size_(frame_size == 0 ? kDefaultZstdFrameSize : frame_size)
+        , window_(std::max<size_t>(thread_count, 1) * 2)
+    {
+        // Reject a bad level up front rather than on the first frame
+        std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+        if (!cctx) {
+            throw std::bad_alloc();
+        }
+        size_t result = ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, level);
+        if (ZSTD_isError(result)) {
+            throw std::invalid_argument(std::string("Invalid zstd compression level: ") + ZSTD_getErrorName(result));
+        }
+        pending_.reserve(frame_size_);
+        size_t workers = std::max<size_t>(thread_count, 1);
+        workers_.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ~ParallelFramedZstdWritable() override {
+        try {
+            Finish();
+        }
+        catch (...) {
+            // Destructors must not throw; call Finish() explicitly to observe errors
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ParallelFramedZstdWritable(const ParallelFramedZstdWritable&) = delete;
+    ParallelFramedZstdWritable& operator=(const ParallelFramedZstdWritable&) = delete;
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        while (length > 0) {
+            size_t n = std::min(length, frame_size_ - pending_.size());
+            pending_.insert(pending_.end(), buffer, buffer + n);
+            buffer += n;
+            length -= n;
+            if (pending_.size() == frame_size_) {
+                Submit();
+            }
+        }
+    }
+
+    /**
+     * Compress any buffered bytes as a final frame and write every frame in flight
+     */
+    void Finish() {
+        if (!pending_.empty()) {
+            Submit();
+        }
+        while (WriteNext(true)) {
+        }
+    }
+
+private:
+    struct Job {
+        std::vector<std::byte> input;
+        std::vector<std::byte> output;
+        std::exception_ptr error;
+        bool done = false;
+    };
+
+    void Submit() {
+        auto job = std::make_unique<Job>();
+        job->input.swap(pending_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(job.get());
+            in_flight_.push_back(std::move(job));
+        }
+        work_cv_.notify_one();
+        pending_.reserve(frame_size_);
+
+        while (WriteNext(false)) {
+        }
+        while (InFlight() >= window_) {
+            WriteNext(true);
+        }
+    }
+
+    size_t InFlight() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return in_flight_.size();
+    }
+
+    /**
+     * Write the oldest frame if it is compressed
+     * @param wait Block until it is
+     * @return false if nothing was written
+     */
+    bool WriteNext(bool wait) {
+        std::unique_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (in_flight_.empty()) {
+                return false;
+            }
+            Job* front = in_flight_.front().get();
+            if (!front->done) {
+                if (!wait) {
+                    return false;
+                }
+                done_cv_.wait(lock, [front]() { return front->done; });
+            }
+            job = std::move(in_flight_.front());
+            in_flight_.pop_front();
+        }
+        if (job->error) {
+            std::rethrow_exception(job->error);
+        }
+        output_->WriteAll(job->output.data(), job->output.size());
+        return true;
+    }
+
+    void WorkerLoop() {
+        std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+        if (cctx) {
+            ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, level_);
+            ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_checksumFlag, 1);
+        }
+        while (true) {
+            Job* job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return;
+                }
+                job = queue_.front();
+                queue_.pop_front();
+            }
+            try {
+                if (!cctx) {
+                    throw std::bad_alloc();
+                }
+                job->output.resize(ZSTD_compressBound(job->input.size()));
+                size_t size = ZSTD_compress2(cctx.get(), job->output.data(), job->output.size(),
+                    job->input.data(), job->input.size());
+                if (ZSTD_isError(size)) {
+                    throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+                }
+                job->output.resize(size);
+            }
+            catch (...) {
+                job->error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                job->input = {};
+                job->done = true;
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    databento::IWritable* output_;
+    int level_;
+    size_t frame_size_;
+    size_t window_;
+    std::vector<std::byte> pending_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Job*> queue_;                       // Waiting for a worker
+    std::deque<std::unique_ptr<Job>> in_flight_;  // Submitted, in output order
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace databento_native
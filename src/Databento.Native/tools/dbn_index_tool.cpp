@@ -0,0 +1,117 @@
+// Builds `<file>.idx` index sidecars for many DBN files in parallel
+//
+// Usage: dbn-index [-j threads] [--records N] [--bytes N] [--force] <file>...
+
+#include "dbn_index.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "Usage: dbn-index [-j threads] [--records N] [--bytes N] [--force] <file>...\n"
+        "  -j threads    Files indexed concurrently (default: hardware threads)\n"
+        "  --records N   Records between checkpoints (default: %llu)\n"
+        "  --bytes N     Decompressed bytes between checkpoints (default: %llu)\n"
+        "  --force       Rebuild indexes that are already up to date\n",
+        static_cast<unsigned long long>(databento_native::kDefaultIndexRecordInterval),
+        static_cast<unsigned long long>(databento_native::kDefaultIndexByteInterval));
+}
+
+bool ParseCount(const char* text, uint64_t* value) {
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (!end || *end != '\0' || end == text) {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t record_interval = databento_native::kDefaultIndexRecordInterval;
+    uint64_t byte_interval = databento_native::kDefaultIndexByteInterval;
+    bool force = false;
+    std::vector<std::filesystem::path> files;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        uint64_t value = 0;
+        if ((arg == "-j" || arg == "--records" || arg == "--bytes") && i + 1 < argc) {
+            if (!ParseCount(argv[++i], &value)) {
+                PrintUsage();
+                return 2;
+            }
+            if (arg == "-j") {
+                threads = std::max<size_t>(1, static_cast<size_t>(value));
+            } else if (arg == "--records") {
+                record_interval = value;
+            } else {
+                byte_interval = value;
+            }
+        } else if (arg == "--force") {
+            force = true;
+        } else if (arg == "-h" || arg == "--help") {
+            PrintUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else {
+            files.emplace_back(arg);
+        }
+    }
+    if (files.empty() || (record_interval == 0 && byte_interval == 0)) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::atomic<size_t> next{0};
+    std::atomic<int> failures{0};
+    std::mutex output_mutex;
+    auto worker = [&]() {
+        for (size_t i = next++; i < files.size(); i = next++) {
+            const auto& path = files[i];
+            try {
+                if (!force && databento_native::DbnFileIndex::Load(path)) {
+                    std::lock_guard<std::mutex> lock(output_mutex);
+                    std::printf("%s: up to date\n", path.string().c_str());
+                    continue;
+                }
+                auto index = databento_native::DbnFileIndex::Build(path, record_interval, byte_interval);
+                index.Save(path);
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::printf("%s: %llu records, %zu checkpoints, %zu instruments\n", path.string().c_str(),
+                    static_cast<unsigned long long>(index.RecordCount()), index.Checkpoints().size(),
+                    index.InstrumentCount());
+            }
+            catch (const std::exception& e) {
+                ++failures;
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::fprintf(stderr, "%s: %s\n", path.string().c_str(), e.what());
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 0; i < std::min(threads, files.size()); ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return failures > 0 ? 1 : 0;
+}